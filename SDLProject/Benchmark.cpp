@@ -0,0 +1,465 @@
+/**
+ * @file Benchmark.cpp
+ * @brief The reports. Timings are the best of several passes over arrays
+ * small enough to stay in cache, in nanoseconds per element, so they
+ * compare the arithmetic rather than the memory system.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include "Benchmark.h"
+#include "MatrixBatch.h"
+#include "QuaternionBatch.h"
+#include "RenderQueue.h"
+#include "glm/gtx/batch_math.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    const size_t BENCHMARK_ELEMENTS = 16384;
+    const double MIN_PASS_SECONDS   = 0.05; // timing stops after this long and MIN_PASSES passes
+    const int    MIN_PASSES         = 5;
+
+    // Best time over several passes of function, per element
+    template <typename Function>
+    double nanoseconds_per_element(size_t count, Function function)
+    {
+        typedef std::chrono::steady_clock Clock;
+
+        function(); // warm the caches and the branch predictors
+        double best = 1e30, total = 0.0;
+        for (int pass = 0; pass < MIN_PASSES || total < MIN_PASS_SECONDS; pass++)
+        {
+            Clock::time_point start = Clock::now();
+            function();
+            double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+            best   = std::min(best, seconds);
+            total += seconds;
+        }
+        return best * 1e9 / (double) count;
+    }
+
+    // Floats as integers ordered like the values, so ulp distances subtract
+    int64_t ordered_bits(float value)
+    {
+        int32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits < 0 ? (int64_t) INT32_MIN - bits : bits;
+    }
+
+    int64_t ulp_distance(float value, double reference)
+    {
+        float rounded = (float) reference;
+        if (std::isnan(value) || std::isnan(rounded)) return std::isnan(value) == std::isnan(rounded) ? 0 : INT32_MAX;
+        return std::llabs(ordered_bits(value) - ordered_bits(rounded));
+    }
+
+    void print_timing(const char *label, double batch, double reference)
+    {
+        std::cout << "  " << std::left << std::setw(14) << label << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(7) << batch << " ns" << std::setw(8) << reference << " ns"
+                  << std::setw(7) << std::setprecision(1) << reference / batch << "x";
+    }
+
+    /* ---------------------------- batch_math ---------------------------- */
+
+    // Functions of x (and y, for atan2), the batch version writing a
+    // second result only for sincos
+    struct MathCase
+    {
+        const char *name;
+        float       low, high;     // inputs drawn uniformly from here
+        bool        near_zero_abs; // results near zero judged by absolute error (sin, cos)
+        void   (*batch)(const float *x, const float *y, float *out, float *second, size_t count);
+        float  (*libm)(float x, float y);
+        double (*reference)(double x, double y);
+        double (*second_reference)(double x, double y);
+    };
+
+    const MathCase MATH_CASES[] = {
+        { "sin", -8192.0f, 8192.0f, true,
+          [](const float *x, const float *, float *out, float *, size_t count) { glm::batchSin(x, out, count); },
+          [](float x, float) { return std::sin(x); },
+          [](double x, double) { return std::sin(x); }, nullptr },
+        { "cos", -8192.0f, 8192.0f, true,
+          [](const float *x, const float *, float *out, float *, size_t count) { glm::batchCos(x, out, count); },
+          [](float x, float) { return std::cos(x); },
+          [](double x, double) { return std::cos(x); }, nullptr },
+        { "sincos", -8192.0f, 8192.0f, true,
+          [](const float *x, const float *, float *out, float *second, size_t count) { glm::batchSinCos(x, out, second, count); },
+          [](float x, float) { return std::sin(x) + std::cos(x); }, // the two libm calls it replaces
+          [](double x, double) { return std::sin(x); },
+          [](double x, double) { return std::cos(x); } },
+        { "atan2", -100.0f, 100.0f, false,
+          [](const float *x, const float *y, float *out, float *, size_t count) { glm::batchAtan2(y, x, out, count); },
+          [](float x, float y) { return std::atan2(y, x); },
+          [](double x, double y) { return std::atan2(y, x); }, nullptr },
+        { "exp", -87.3f, 88.7f, false,
+          [](const float *x, const float *, float *out, float *, size_t count) { glm::batchExp(x, out, count); },
+          [](float x, float) { return std::exp(x); },
+          [](double x, double) { return std::exp(x); }, nullptr },
+        { "log", 1e-30f, 1e30f, false,
+          [](const float *x, const float *, float *out, float *, size_t count) { glm::batchLog(x, out, count); },
+          [](float x, float) { return std::log(x); },
+          [](double x, double) { return std::log(x); }, nullptr },
+    };
+
+    void batch_math_report()
+    {
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+        const char *path = "AVX2 kernels";
+#elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+        const char *path = "SSE2 kernels";
+#else
+        const char *path = "libm per element; define GLM_FORCE_INTRINSICS for the SIMD kernels";
+#endif
+        std::cout << "glm/gtx/batch_math against libm (" << path << "), "
+                  << BENCHMARK_ELEMENTS << " floats, per element:\n"
+                  << "                   batch      libm  speedup  max error\n";
+
+        const size_t count = BENCHMARK_ELEMENTS;
+        std::vector<float> x(count), y(count), out(count), second(count);
+        std::mt19937 random(1);
+
+        for (const MathCase &test : MATH_CASES)
+        {
+            std::uniform_real_distribution<float> distribution(test.low, test.high);
+            for (size_t i = 0; i < count; i++) x[i] = distribution(random), y[i] = distribution(random);
+
+            double batch = nanoseconds_per_element(count, [&]
+            {
+                test.batch(x.data(), y.data(), out.data(), second.data(), count);
+            });
+            double libm = nanoseconds_per_element(count, [&]
+            {
+                for (size_t i = 0; i < count; i++) second[i] = test.libm(x[i], y[i]);
+            });
+            test.batch(x.data(), y.data(), out.data(), second.data(), count);
+
+            // Close to the zeros of sin and cos an ulp is tiny, so there the
+            // documented bound is absolute
+            int64_t max_ulp = 0;
+            double  max_absolute = 0.0;
+            auto check = [&](const std::vector<float> &results, double (*reference)(double, double))
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    double expected = reference(x[i], y[i]);
+                    if (test.near_zero_abs && std::fabs(expected) < 1e-3)
+                        max_absolute = std::max(max_absolute, std::fabs(results[i] - expected));
+                    else
+                        max_ulp = std::max(max_ulp, ulp_distance(results[i], expected));
+                }
+            };
+            check(out, test.reference);
+            if (test.second_reference != nullptr) check(second, test.second_reference);
+
+            print_timing(test.name, batch, libm);
+            std::cout << "  " << max_ulp << " ulp";
+            if (test.near_zero_abs) std::cout << std::scientific << std::setprecision(1) << ", " << max_absolute << " near 0";
+            std::cout << std::defaultfloat << "\n";
+        }
+    }
+
+    /* --------------------------- MatrixBatch ---------------------------- */
+
+    // Each instruction set up to the best supported, then the original one
+    // restored
+    template <typename Function>
+    void for_each_isa(Function function)
+    {
+        MatrixBatchIsa original = get_matrix_batch_isa();
+        for (int isa = MATRIX_BATCH_SCALAR; isa <= get_supported_matrix_batch_isa(); isa++)
+            function(set_matrix_batch_isa((MatrixBatchIsa) isa));
+        set_matrix_batch_isa(original);
+    }
+
+    template <typename Value>
+    double max_difference(const Value *values, const Value *expected, size_t count)
+    {
+        const float *a = (const float *) values, *b = (const float *) expected;
+        double largest = 0.0;
+        for (size_t i = 0; i < count * sizeof(Value) / sizeof(float); i++)
+            largest = std::max(largest, (double) std::fabs(a[i] - b[i]) / (1.0 + std::fabs(b[i])));
+        return largest;
+    }
+
+    void matrix_batch_report()
+    {
+        std::cout << "MatrixBatch by instruction set (glm one at a time is SCALAR), "
+                  << BENCHMARK_ELEMENTS << " matrices or points, ns per element / largest relative error:\n"
+                  << "               multiply  parent *   inverse    points   vectors\n";
+
+        const size_t count = BENCHMARK_ELEMENTS;
+        std::vector<glm::mat4> a(count), b(count), out(count), expected(count);
+        std::vector<glm::vec3> points(count), transformed(count), expected_points(count);
+        std::mt19937 random(2);
+        std::uniform_real_distribution<float> distribution(-2.0f, 2.0f);
+        for (size_t i = 0; i < count; i++)
+        {
+            for (int column = 0; column < 4; column++)
+                for (int row = 0; row < 4; row++) a[i][column][row] = distribution(random), b[i][column][row] = distribution(random);
+
+            // Diagonally dominant, so every inverse is well conditioned and
+            // differences from glm reflect the kernels, not the input
+            for (int k = 0; k < 4; k++) a[i][k][k] += a[i][k][k] < 0.0f ? -8.0f : 8.0f;
+            points[i] = glm::vec3(distribution(random), distribution(random), distribution(random));
+        }
+        const glm::mat4 &parent = a[0];
+
+        for_each_isa([&](MatrixBatchIsa isa)
+        {
+            double times[5], errors[5];
+
+            times[0] = nanoseconds_per_element(count, [&] { multiply_matrices(a.data(), b.data(), out.data(), count); });
+            for (size_t i = 0; i < count; i++) expected[i] = a[i] * b[i];
+            errors[0] = max_difference(out.data(), expected.data(), count);
+
+            times[1] = nanoseconds_per_element(count, [&] { multiply_matrices(parent, b.data(), out.data(), count); });
+            for (size_t i = 0; i < count; i++) expected[i] = parent * b[i];
+            errors[1] = max_difference(out.data(), expected.data(), count);
+
+            times[2] = nanoseconds_per_element(count, [&] { invert_matrices(a.data(), out.data(), count); });
+            for (size_t i = 0; i < count; i++) expected[i] = glm::inverse(a[i]);
+            errors[2] = max_difference(out.data(), expected.data(), count);
+
+            times[3] = nanoseconds_per_element(count, [&] { transform_points(parent, points.data(), transformed.data(), count); });
+            for (size_t i = 0; i < count; i++) expected_points[i] = glm::vec3(parent * glm::vec4(points[i], 1.0f));
+            errors[3] = max_difference(transformed.data(), expected_points.data(), count);
+
+            times[4] = nanoseconds_per_element(count, [&] { transform_vectors(parent, points.data(), transformed.data(), count); });
+            for (size_t i = 0; i < count; i++) expected_points[i] = glm::vec3(parent * glm::vec4(points[i], 0.0f));
+            errors[4] = max_difference(transformed.data(), expected_points.data(), count);
+
+            std::cout << "  " << std::left << std::setw(10) << get_matrix_batch_isa_name(isa) << std::right;
+            for (double time : times) std::cout << std::fixed << std::setprecision(2) << std::setw(10) << time;
+            std::cout << "\n            ";
+            for (double error : errors) std::cout << std::scientific << std::setprecision(1) << std::setw(10) << error;
+            std::cout << std::defaultfloat << "\n";
+        });
+    }
+
+    /* ------------------------- QuaternionBatch -------------------------- */
+
+    // Component arrays owning their storage
+    struct QuaternionStorage
+    {
+        std::vector<float> w, x, y, z;
+
+        explicit QuaternionStorage(size_t count) : w(count), x(count), y(count), z(count) {}
+        QuaternionArrays arrays() { return { w.data(), x.data(), y.data(), z.data() }; }
+    };
+
+    // glm::slerp and glm::lerp take the longer arc when the dot product is
+    // negative; the batch functions never do
+    glm::quat shorter_arc(const glm::quat &a, const glm::quat &b)
+    {
+        return glm::dot(a, b) < 0.0f ? -b : b;
+    }
+
+    void quaternion_batch_report()
+    {
+        std::cout << "QuaternionBatch by instruction set against glm one quaternion at a time, "
+                  << BENCHMARK_ELEMENTS << " quaternions, ns per element / largest relative difference:\n"
+                  << "                  nlerp     slerp slerp fast  multiply    rotate    matrix\n";
+
+        const size_t count = BENCHMARK_ELEMENTS;
+        std::vector<glm::quat> a(count), b(count), joined(count), expected(count);
+        std::vector<glm::vec3> vectors(count), joined_vectors(count), expected_vectors(count);
+        std::vector<glm::mat4> matrices(count), expected_matrices(count);
+        std::vector<float>     t(count), vx(count), vy(count), vz(count), rx(count), ry(count), rz(count);
+        std::mt19937 random(3);
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        for (size_t i = 0; i < count; i++)
+        {
+            a[i] = glm::normalize(glm::quat(distribution(random), distribution(random), distribution(random), distribution(random)));
+            b[i] = glm::normalize(glm::quat(distribution(random), distribution(random), distribution(random), distribution(random)));
+            t[i] = distribution(random) * 0.5f + 0.5f;
+            vectors[i] = glm::vec3(distribution(random), distribution(random), distribution(random)) * 4.0f;
+            vx[i] = vectors[i].x, vy[i] = vectors[i].y, vz[i] = vectors[i].z;
+        }
+
+        QuaternionStorage a_storage(count), b_storage(count), out_storage(count);
+        split_quaternions(a.data(), a_storage.arrays(), count);
+        split_quaternions(b.data(), b_storage.arrays(), count);
+        ConstQuaternionArrays qa = a_storage.arrays(), qb = b_storage.arrays();
+        QuaternionArrays      out = out_storage.arrays();
+        ConstVec3Arrays       v(vx.data(), vy.data(), vz.data());
+        Vec3Arrays            rotated = { rx.data(), ry.data(), rz.data() };
+
+        // The glm timings do not depend on the instruction set, so they are
+        // taken once
+        double glm_times[6];
+        glm_times[0] = nanoseconds_per_element(count, [&]
+        {
+            for (size_t i = 0; i < count; i++) expected[i] = glm::normalize(glm::lerp(a[i], shorter_arc(a[i], b[i]), t[i]));
+        });
+        glm_times[1] = nanoseconds_per_element(count, [&]
+        {
+            for (size_t i = 0; i < count; i++) expected[i] = glm::slerp(a[i], shorter_arc(a[i], b[i]), t[i]);
+        });
+        glm_times[2] = glm_times[1];
+        glm_times[3] = nanoseconds_per_element(count, [&] { for (size_t i = 0; i < count; i++) expected[i] = a[i] * b[i]; });
+        glm_times[4] = nanoseconds_per_element(count, [&] { for (size_t i = 0; i < count; i++) expected_vectors[i] = a[i] * vectors[i]; });
+        glm_times[5] = nanoseconds_per_element(count, [&] { for (size_t i = 0; i < count; i++) expected_matrices[i] = glm::mat4_cast(a[i]); });
+
+        std::cout << "  " << std::left << std::setw(10) << "glm" << std::right;
+        for (double time : glm_times) std::cout << std::fixed << std::setprecision(2) << std::setw(10) << time;
+        std::cout << "\n";
+
+        for_each_isa([&](MatrixBatchIsa isa)
+        {
+            double times[6], errors[6];
+
+            times[0] = nanoseconds_per_element(count, [&] { nlerp_quaternions(qa, qb, t.data(), out, count); });
+            join_quaternions(out, joined.data(), count);
+            for (size_t i = 0; i < count; i++) expected[i] = glm::normalize(glm::lerp(a[i], shorter_arc(a[i], b[i]), t[i]));
+            errors[0] = max_difference(joined.data(), expected.data(), count);
+
+            for (int fast = 0; fast < 2; fast++)
+            {
+                SlerpPrecision precision = fast ? SLERP_FAST : SLERP_EXACT;
+                times[1 + fast] = nanoseconds_per_element(count, [&] { slerp_quaternions(qa, qb, t.data(), out, count, precision); });
+                join_quaternions(out, joined.data(), count);
+                for (size_t i = 0; i < count; i++) expected[i] = glm::slerp(a[i], shorter_arc(a[i], b[i]), t[i]);
+                errors[1 + fast] = max_difference(joined.data(), expected.data(), count);
+            }
+
+            times[3] = nanoseconds_per_element(count, [&] { multiply_quaternions(qa, qb, out, count); });
+            join_quaternions(out, joined.data(), count);
+            for (size_t i = 0; i < count; i++) expected[i] = a[i] * b[i];
+            errors[3] = max_difference(joined.data(), expected.data(), count);
+
+            times[4] = nanoseconds_per_element(count, [&] { rotate_vectors(qa, v, rotated, count); });
+            for (size_t i = 0; i < count; i++) joined_vectors[i] = glm::vec3(rx[i], ry[i], rz[i]), expected_vectors[i] = a[i] * vectors[i];
+            errors[4] = max_difference(joined_vectors.data(), expected_vectors.data(), count);
+
+            times[5] = nanoseconds_per_element(count, [&] { quaternions_to_matrices(qa, matrices.data(), count); });
+            for (size_t i = 0; i < count; i++) expected_matrices[i] = glm::mat4_cast(a[i]);
+            errors[5] = max_difference(matrices.data(), expected_matrices.data(), count);
+
+            std::cout << "  " << std::left << std::setw(10) << get_matrix_batch_isa_name(isa) << std::right;
+            for (double time : times) std::cout << std::fixed << std::setprecision(2) << std::setw(10) << time;
+            std::cout << "\n            ";
+            for (double error : errors) std::cout << std::scientific << std::setprecision(1) << std::setw(10) << error;
+            std::cout << std::defaultfloat << "\n";
+        });
+    }
+
+    /* --------------------------- RenderQueue ---------------------------- */
+
+    const size_t   RENDER_QUEUE_KEYS        = 500000;
+    const double   RENDER_QUEUE_TARGET_MS   = 1.0; // the goal: well under this on 8 cores
+    const unsigned RENDER_QUEUE_TARGET_CORES = 8;
+
+    // Best time over several runs of function, each after an untimed
+    // prepare(), in milliseconds
+    template <typename Prepare, typename Function>
+    double best_milliseconds(Prepare prepare, Function function)
+    {
+        typedef std::chrono::steady_clock Clock;
+
+        double best = 1e30, total = 0.0;
+        for (int pass = 0; pass < MIN_PASSES || total < MIN_PASS_SECONDS; pass++)
+        {
+            prepare();
+            Clock::time_point start = Clock::now();
+            function();
+            double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+            best   = std::min(best, seconds);
+            total += seconds;
+        }
+        return best * 1e3;
+    }
+
+    void render_queue_report()
+    {
+        const size_t count = RENDER_QUEUE_KEYS;
+        unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+        std::cout << "radix_sort_draw_items, " << count << " keys, " << cores << " hardware thread(s), "
+                  << "ms per sort (target: well under " << RENDER_QUEUE_TARGET_MS << " ms on "
+                  << RENDER_QUEUE_TARGET_CORES << " cores):\n";
+
+        // A frame's worth of sprites: a few layers and shaders, both blend
+        // states, a thousand textures and any depth
+        std::vector<DrawItem> keys(count), items(count), scratch(count), expected;
+        std::mt19937 random(4);
+        std::uniform_real_distribution<float> depth(0.0f, 1.0f);
+        for (size_t i = 0; i < count; i++)
+        {
+            keys[i].key   = make_draw_key(random() % 4, random() % 2 ? PREMULTIPLIED_ALPHA : STRAIGHT_ALPHA,
+                                          random() % 8, 1 + random() % 1000, depth(random));
+            keys[i].index = (uint32_t) i;
+        }
+        auto reset = [&] { std::copy(keys.begin(), keys.end(), items.begin()); };
+        auto by_key = [](const DrawItem &a, const DrawItem &b) { return a.key < b.key; };
+
+        double stable_sort = best_milliseconds(reset, [&] { std::stable_sort(items.begin(), items.end(), by_key); });
+        expected = items;
+        std::cout << "  std::stable_sort     " << std::fixed << std::setprecision(2) << std::setw(7) << stable_sort << " ms\n";
+
+        double at_target = -1.0;
+        for (unsigned threads : { 1u, 2u, 4u, 8u })
+        {
+            double time = best_milliseconds(reset, [&] { radix_sort_draw_items(items.data(), scratch.data(), count, threads); });
+            bool same = std::equal(items.begin(), items.end(), expected.begin(),
+                                   [](const DrawItem &a, const DrawItem &b) { return a.key == b.key && a.index == b.index; });
+            if (threads == RENDER_QUEUE_TARGET_CORES) at_target = time;
+
+            std::cout << "  " << threads << (threads == 1 ? " thread " : " threads") << "            " << std::setw(7) << time << " ms"
+                      << std::setw(7) << std::setprecision(1) << stable_sort / time << "x"
+                      << (same ? "" : "  DIFFERS from std::stable_sort") << std::setprecision(2) << "\n";
+        }
+
+        std::cout << "  " << RENDER_QUEUE_TARGET_CORES << " threads: " << at_target << " ms, "
+                  << (at_target < RENDER_QUEUE_TARGET_MS ? "meets" : "misses") << " the target";
+        if (cores < RENDER_QUEUE_TARGET_CORES) std::cout << " (only " << cores << " hardware thread(s) here, so not a fair test)";
+        std::cout << std::defaultfloat << "\n";
+    }
+
+    /* ----------------------------- Registry ----------------------------- */
+
+    struct Benchmark
+    {
+        const char *name;
+        void (*report)();
+    };
+
+    const Benchmark BENCHMARKS[] = {
+        { "batch-math",       batch_math_report       },
+        { "matrix-batch",     matrix_batch_report     },
+        { "quaternion-batch", quaternion_batch_report },
+        { "render-queue",     render_queue_report     },
+    };
+}
+
+bool run_benchmark(const char *name)
+{
+    bool found = false;
+    for (const Benchmark &benchmark : BENCHMARKS)
+    {
+        if (name != nullptr && std::strcmp(name, benchmark.name) != 0) continue;
+        benchmark.report();
+        std::cout << "\n";
+        found = true;
+    }
+
+    if (!found)
+    {
+        std::cout << "No benchmark called " << name << "; there are:";
+        for (const Benchmark &benchmark : BENCHMARKS) std::cout << " " << benchmark.name;
+        std::cout << "\n";
+    }
+    return found;
+}
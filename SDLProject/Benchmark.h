@@ -0,0 +1,20 @@
+/**
+ * @file Benchmark.h
+ * @brief Offline throughput and accuracy reports for the batch math and
+ * sorting modules: SDLProject --benchmark [name]. Each report times the
+ * batch functions against the per-element or standard library path they
+ * replace on the same data, and checks the results against it, so the
+ * bounds and targets documented in the headers can be rechecked on any
+ * machine.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+/**
+ * Runs the named report, or all of them for null. Returns false, after
+ * listing the names, if there is no report by that name.
+ */
+bool run_benchmark(const char *name);
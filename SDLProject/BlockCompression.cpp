@@ -0,0 +1,556 @@
+/**
+ * @file BlockCompression.cpp
+ * @brief BC1/BC3 encoder and decoder. Colour endpoints come from the
+ * principal axis of each 4x4 block followed by one least-squares refinement;
+ * the palette search that dominates encode time is done four texels at a
+ * time with SSE.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#define GL_SILENCE_DEPRECATION
+#include "BlockCompression.h"
+#include "ParallelJobs.h"
+#include <SDL2/SDL.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define BLOCK_COMPRESSION_USE_SSE 1
+#endif
+
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+    #define GL_COMPRESSED_RGB_S3TC_DXT1_EXT  0x83F0
+    #define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+namespace
+{
+    constexpr char CONTAINER_MAGIC[4] = { 'B', 'C', 'T', 'X' };
+
+    // 16 texels of one block, channels split out so four texels fit a register
+    struct Block
+    {
+        alignas(16) float red[16];
+        alignas(16) float green[16];
+        alignas(16) float blue[16];
+        unsigned char     alpha[16];
+    };
+
+    struct Colour { float red, green, blue; };
+
+    void gather_block(const unsigned char *rgba, int width, int height, int block_x, int block_y, Block &block)
+    {
+        // Edge blocks repeat the last row/column so padding texels don't
+        // pull the endpoints around
+        for (int i = 0; i < 16; i++)
+        {
+            int x = std::min(block_x * 4 + (i & 3), width - 1),
+                y = std::min(block_y * 4 + (i >> 2), height - 1);
+
+            const unsigned char *texel = rgba + ((size_t) y * width + x) * 4;
+            block.red[i]   = texel[0];
+            block.green[i] = texel[1];
+            block.blue[i]  = texel[2];
+            block.alpha[i] = texel[3];
+        }
+    }
+
+    uint16_t pack_565(Colour colour)
+    {
+        auto quantise = [](float value, int max) {
+            return (int) std::lround(std::min(std::max(value, 0.0f), 255.0f) * max / 255.0f);
+        };
+        return (uint16_t) ((quantise(colour.red, 31) << 11) | (quantise(colour.green, 63) << 5) | quantise(colour.blue, 31));
+    }
+
+    Colour unpack_565(uint16_t packed)
+    {
+        int red = (packed >> 11) & 31, green = (packed >> 5) & 63, blue = packed & 31;
+        return { (float) ((red << 3) | (red >> 2)), (float) ((green << 2) | (green >> 4)), (float) ((blue << 3) | (blue >> 2)) };
+    }
+
+    void make_palette(uint16_t endpoint_0, uint16_t endpoint_1, Colour palette[4])
+    {
+        palette[0] = unpack_565(endpoint_0);
+        palette[1] = unpack_565(endpoint_1);
+        palette[2] = { (2 * palette[0].red + palette[1].red) / 3, (2 * palette[0].green + palette[1].green) / 3, (2 * palette[0].blue + palette[1].blue) / 3 };
+        palette[3] = { (palette[0].red + 2 * palette[1].red) / 3, (palette[0].green + 2 * palette[1].green) / 3, (palette[0].blue + 2 * palette[1].blue) / 3 };
+    }
+
+    /**
+     * Picks the nearest palette entry for every texel. Returns the summed
+     * squared error so callers can compare candidate endpoints.
+     */
+    float choose_indices(const Block &block, const Colour palette[4], int indices[16])
+    {
+#ifdef BLOCK_COMPRESSION_USE_SSE
+        __m128 total = _mm_setzero_ps();
+        for (int i = 0; i < 16; i += 4)
+        {
+            __m128 red   = _mm_load_ps(block.red + i),
+                   green = _mm_load_ps(block.green + i),
+                   blue  = _mm_load_ps(block.blue + i);
+
+            __m128 best_error = _mm_set1_ps(1e30f),
+                   best_index = _mm_setzero_ps();
+
+            for (int entry = 0; entry < 4; entry++)
+            {
+                __m128 d_red   = _mm_sub_ps(red,   _mm_set1_ps(palette[entry].red)),
+                       d_green = _mm_sub_ps(green, _mm_set1_ps(palette[entry].green)),
+                       d_blue  = _mm_sub_ps(blue,  _mm_set1_ps(palette[entry].blue));
+
+                __m128 error = _mm_add_ps(_mm_add_ps(_mm_mul_ps(d_red, d_red), _mm_mul_ps(d_green, d_green)),
+                                          _mm_mul_ps(d_blue, d_blue));
+                __m128 closer = _mm_cmplt_ps(error, best_error);
+
+                best_error = _mm_min_ps(error, best_error);
+                best_index = _mm_or_ps(_mm_and_ps(closer, _mm_set1_ps((float) entry)), _mm_andnot_ps(closer, best_index));
+            }
+
+            _mm_storeu_si128((__m128i *) (indices + i), _mm_cvttps_epi32(best_index));
+            total = _mm_add_ps(total, best_error);
+        }
+
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, total);
+        return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#else
+        float total = 0.0f;
+        for (int i = 0; i < 16; i++)
+        {
+            float best_error = 1e30f;
+            for (int entry = 0; entry < 4; entry++)
+            {
+                float d_red   = block.red[i]   - palette[entry].red,
+                      d_green = block.green[i] - palette[entry].green,
+                      d_blue  = block.blue[i]  - palette[entry].blue;
+                float error = d_red * d_red + d_green * d_green + d_blue * d_blue;
+                if (error < best_error) { best_error = error; indices[i] = entry; }
+            }
+            total += best_error;
+        }
+        return total;
+#endif
+    }
+
+    void principal_endpoints(const Block &block, Colour &high, Colour &low)
+    {
+        Colour mean = { 0.0f, 0.0f, 0.0f };
+        for (int i = 0; i < 16; i++) { mean.red += block.red[i]; mean.green += block.green[i]; mean.blue += block.blue[i]; }
+        mean = { mean.red / 16, mean.green / 16, mean.blue / 16 };
+
+        float covariance[6] = {};
+        for (int i = 0; i < 16; i++)
+        {
+            float r = block.red[i] - mean.red, g = block.green[i] - mean.green, b = block.blue[i] - mean.blue;
+            covariance[0] += r * r; covariance[1] += r * g; covariance[2] += r * b;
+            covariance[3] += g * g; covariance[4] += g * b; covariance[5] += b * b;
+        }
+
+        // A few power iterations are plenty for a 3x3 matrix
+        float axis[3] = { 1.0f, 1.0f, 1.0f };
+        for (int iteration = 0; iteration < 4; iteration++)
+        {
+            float next[3] = { covariance[0] * axis[0] + covariance[1] * axis[1] + covariance[2] * axis[2],
+                              covariance[1] * axis[0] + covariance[3] * axis[1] + covariance[4] * axis[2],
+                              covariance[2] * axis[0] + covariance[4] * axis[1] + covariance[5] * axis[2] };
+            float length = std::max({ std::fabs(next[0]), std::fabs(next[1]), std::fabs(next[2]) });
+            if (length < 1e-6f) break;
+            for (int c = 0; c < 3; c++) axis[c] = next[c] / length;
+        }
+
+        float length_squared = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+        float min_t = 0.0f, max_t = 0.0f;
+        for (int i = 0; i < 16; i++)
+        {
+            float t = ((block.red[i] - mean.red) * axis[0] + (block.green[i] - mean.green) * axis[1] +
+                       (block.blue[i] - mean.blue) * axis[2]) / length_squared;
+            min_t = std::min(min_t, t);
+            max_t = std::max(max_t, t);
+        }
+
+        high = { mean.red + axis[0] * max_t, mean.green + axis[1] * max_t, mean.blue + axis[2] * max_t };
+        low  = { mean.red + axis[0] * min_t, mean.green + axis[1] * min_t, mean.blue + axis[2] * min_t };
+    }
+
+    /**
+     * Least-squares endpoints for a fixed index assignment. Returns false if
+     * the assignment is degenerate (every texel on one endpoint).
+     */
+    bool refine_endpoints(const Block &block, const int indices[16], Colour &high, Colour &low)
+    {
+        static const float WEIGHTS[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+
+        float alpha_2 = 0.0f, beta_2 = 0.0f, alpha_beta = 0.0f;
+        Colour alpha_x = { 0, 0, 0 }, beta_x = { 0, 0, 0 };
+        for (int i = 0; i < 16; i++)
+        {
+            float a = WEIGHTS[indices[i]], b = 1.0f - a;
+            alpha_2 += a * a; beta_2 += b * b; alpha_beta += a * b;
+            alpha_x = { alpha_x.red + a * block.red[i], alpha_x.green + a * block.green[i], alpha_x.blue + a * block.blue[i] };
+            beta_x  = { beta_x.red  + b * block.red[i], beta_x.green  + b * block.green[i], beta_x.blue  + b * block.blue[i] };
+        }
+
+        float determinant = alpha_2 * beta_2 - alpha_beta * alpha_beta;
+        if (std::fabs(determinant) < 1e-6f) return false;
+
+        float inverse = 1.0f / determinant;
+        high = { (alpha_x.red * beta_2 - beta_x.red * alpha_beta) * inverse,
+                 (alpha_x.green * beta_2 - beta_x.green * alpha_beta) * inverse,
+                 (alpha_x.blue * beta_2 - beta_x.blue * alpha_beta) * inverse };
+        low  = { (beta_x.red * alpha_2 - alpha_x.red * alpha_beta) * inverse,
+                 (beta_x.green * alpha_2 - alpha_x.green * alpha_beta) * inverse,
+                 (beta_x.blue * alpha_2 - alpha_x.blue * alpha_beta) * inverse };
+        return true;
+    }
+
+    float encode_endpoints(const Block &block, Colour high, Colour low, uint16_t &endpoint_0, uint16_t &endpoint_1, int indices[16])
+    {
+        endpoint_0 = pack_565(high);
+        endpoint_1 = pack_565(low);
+
+        // Four-colour mode needs endpoint_0 > endpoint_1; if they collapse to
+        // the same value every texel simply takes index 0
+        if (endpoint_0 < endpoint_1) std::swap(endpoint_0, endpoint_1);
+        if (endpoint_0 == endpoint_1)
+        {
+            Colour only = unpack_565(endpoint_0);
+            float  error = 0.0f;
+            for (int i = 0; i < 16; i++)
+            {
+                indices[i] = 0;
+                error += (block.red[i] - only.red) * (block.red[i] - only.red) +
+                         (block.green[i] - only.green) * (block.green[i] - only.green) +
+                         (block.blue[i] - only.blue) * (block.blue[i] - only.blue);
+            }
+            return error;
+        }
+
+        Colour palette[4];
+        make_palette(endpoint_0, endpoint_1, palette);
+        return choose_indices(block, palette, indices);
+    }
+
+    void encode_colour_block(const Block &block, unsigned char *target)
+    {
+        Colour   high, low;
+        uint16_t endpoint_0, endpoint_1;
+        int      indices[16];
+
+        principal_endpoints(block, high, low);
+        float error = encode_endpoints(block, high, low, endpoint_0, endpoint_1, indices);
+
+        uint16_t refined_0, refined_1;
+        int      refined_indices[16];
+        if (error > 0.0f && refine_endpoints(block, indices, high, low) &&
+            encode_endpoints(block, high, low, refined_0, refined_1, refined_indices) < error)
+        {
+            endpoint_0 = refined_0;
+            endpoint_1 = refined_1;
+            std::memcpy(indices, refined_indices, sizeof(indices));
+        }
+
+        uint32_t packed_indices = 0;
+        for (int i = 0; i < 16; i++) packed_indices |= (uint32_t) indices[i] << (i * 2);
+
+        target[0] = endpoint_0 & 0xFF; target[1] = endpoint_0 >> 8;
+        target[2] = endpoint_1 & 0xFF; target[3] = endpoint_1 >> 8;
+        for (int i = 0; i < 4; i++) target[4 + i] = (packed_indices >> (i * 8)) & 0xFF;
+    }
+
+    void make_alpha_palette(int alpha_0, int alpha_1, int palette[8])
+    {
+        palette[0] = alpha_0;
+        palette[1] = alpha_1;
+        for (int i = 1; i < 7; i++) palette[i + 1] = ((7 - i) * alpha_0 + i * alpha_1 + 3) / 7;
+    }
+
+    void encode_alpha_block(const Block &block, unsigned char *target)
+    {
+        int alpha_0 = *std::max_element(block.alpha, block.alpha + 16),
+            alpha_1 = *std::min_element(block.alpha, block.alpha + 16);
+
+        int palette[8];
+        make_alpha_palette(alpha_0, alpha_1, palette);
+
+        uint64_t packed_indices = 0;
+        if (alpha_0 != alpha_1)
+        {
+            for (int i = 0; i < 16; i++)
+            {
+                int best = 0;
+                for (int entry = 1; entry < 8; entry++)
+                    if (std::abs(palette[entry] - block.alpha[i]) < std::abs(palette[best] - block.alpha[i])) best = entry;
+                packed_indices |= (uint64_t) best << (i * 3);
+            }
+        }
+
+        target[0] = (unsigned char) alpha_0;
+        target[1] = (unsigned char) alpha_1;
+        for (int i = 0; i < 6; i++) target[2 + i] = (packed_indices >> (i * 8)) & 0xFF;
+    }
+
+    void decode_block(BlockFormat format, const unsigned char *source, unsigned char texels[16][4])
+    {
+        if (format == BLOCK_FORMAT_BC3)
+        {
+            int palette[8];
+            make_alpha_palette(source[0], source[1], palette);
+            if (source[0] <= source[1])
+            {
+                // Six-value mode with explicit 0 and 255
+                for (int i = 1; i < 5; i++) palette[i + 1] = ((5 - i) * source[0] + i * source[1] + 2) / 5;
+                palette[6] = 0;
+                palette[7] = 255;
+            }
+
+            uint64_t packed_indices = 0;
+            for (int i = 0; i < 6; i++) packed_indices |= (uint64_t) source[2 + i] << (i * 8);
+            for (int i = 0; i < 16; i++) texels[i][3] = (unsigned char) palette[(packed_indices >> (i * 3)) & 7];
+
+            source += 8;
+        }
+        else
+        {
+            for (int i = 0; i < 16; i++) texels[i][3] = 255;
+        }
+
+        uint16_t endpoint_0 = (uint16_t) (source[0] | (source[1] << 8)),
+                 endpoint_1 = (uint16_t) (source[2] | (source[3] << 8));
+
+        Colour palette[4];
+        make_palette(endpoint_0, endpoint_1, palette);
+        if (format == BLOCK_FORMAT_BC1 && endpoint_0 <= endpoint_1)
+        {
+            palette[2] = { (palette[0].red + palette[1].red) / 2, (palette[0].green + palette[1].green) / 2, (palette[0].blue + palette[1].blue) / 2 };
+            palette[3] = { 0.0f, 0.0f, 0.0f };
+        }
+
+        // Interpolated entries round to nearest, as GPUs decode them, rather
+        // than truncating to one below
+        uint32_t packed_indices = source[4] | (source[5] << 8) | (source[6] << 16) | ((uint32_t) source[7] << 24);
+        for (int i = 0; i < 16; i++)
+        {
+            const Colour &colour = palette[(packed_indices >> (i * 2)) & 3];
+            texels[i][0] = (unsigned char) std::lround(colour.red);
+            texels[i][1] = (unsigned char) std::lround(colour.green);
+            texels[i][2] = (unsigned char) std::lround(colour.blue);
+        }
+    }
+
+    double psnr(const unsigned char *expected, const unsigned char *actual, size_t texel_count, int channels)
+    {
+        double squared_error = 0.0;
+        for (size_t i = 0; i < texel_count * 4; i++)
+        {
+            if ((int) (i & 3) >= channels) continue;
+            double difference = (double) expected[i] - actual[i];
+            squared_error += difference * difference;
+        }
+        double mse = squared_error / (texel_count * channels);
+        return mse == 0.0 ? INFINITY : 10.0 * std::log10(255.0 * 255.0 / mse);
+    }
+}
+
+size_t block_bytes(BlockFormat format)
+{
+    return format == BLOCK_FORMAT_BC1 ? 8 : 16;
+}
+
+size_t compressed_level_size(BlockFormat format, int width, int height)
+{
+    return (size_t) ((width + 3) / 4) * ((height + 3) / 4) * block_bytes(format);
+}
+
+CompressedTexture compress_mip_chain(const MipChain &chain, BlockFormat format, AlphaMode alpha_mode,
+                                     unsigned thread_count)
+{
+    CompressedTexture texture = { format, alpha_mode, {}, {} };
+
+    // One job per block row across all levels
+    struct Job { size_t level; int block_y; };
+    std::vector<Job> jobs;
+
+    size_t total_bytes = 0;
+    for (size_t level = 0; level < chain.levels.size(); level++)
+    {
+        const MipLevel &mip = chain.levels[level];
+        texture.levels.push_back({ mip.width, mip.height, total_bytes });
+        total_bytes += compressed_level_size(format, mip.width, mip.height);
+
+        for (int block_y = 0; block_y < (mip.height + 3) / 4; block_y++) jobs.push_back({ level, block_y });
+    }
+    texture.blocks.resize(total_bytes);
+
+    run_parallel_jobs(thread_count, jobs.size(), [&](size_t job)
+    {
+        const MipLevel      &mip    = chain.levels[jobs[job].level];
+        const unsigned char *source = chain.level_data(jobs[job].level);
+        int                  blocks_wide = (mip.width + 3) / 4;
+
+        unsigned char *target = texture.blocks.data() + texture.levels[jobs[job].level].offset +
+                                (size_t) jobs[job].block_y * blocks_wide * block_bytes(format);
+
+        Block block;
+        for (int block_x = 0; block_x < blocks_wide; block_x++, target += block_bytes(format))
+        {
+            gather_block(source, mip.width, mip.height, block_x, jobs[job].block_y, block);
+            if (format == BLOCK_FORMAT_BC3)
+            {
+                encode_alpha_block(block, target);
+                encode_colour_block(block, target + 8);
+            }
+            else encode_colour_block(block, target);
+        }
+    });
+
+    return texture;
+}
+
+void decompress_blocks(BlockFormat format, const unsigned char *blocks, int width, int height, unsigned char *rgba)
+{
+    unsigned char texels[16][4];
+    for (int block_y = 0; block_y < (height + 3) / 4; block_y++)
+    {
+        for (int block_x = 0; block_x < (width + 3) / 4; block_x++, blocks += block_bytes(format))
+        {
+            decode_block(format, blocks, texels);
+
+            for (int i = 0; i < 16; i++)
+            {
+                int x = block_x * 4 + (i & 3), y = block_y * 4 + (i >> 2);
+                if (x < width && y < height) std::memcpy(rgba + ((size_t) y * width + x) * 4, texels[i], 4);
+            }
+        }
+    }
+}
+
+void decompress_level(const CompressedTexture &texture, size_t level, unsigned char *rgba)
+{
+    const MipLevel &mip = texture.levels[level];
+    decompress_blocks(texture.format, texture.level_data(level), mip.width, mip.height, rgba);
+}
+
+bool write_compressed_texture(const CompressedTexture &texture, const char *filepath)
+{
+    std::ofstream file(filepath, std::ios::binary);
+    if (!file) return false;
+
+    uint32_t header[3] = { (uint32_t) texture.format, (uint32_t) texture.alpha_mode, (uint32_t) texture.levels.size() };
+    file.write(CONTAINER_MAGIC, sizeof(CONTAINER_MAGIC));
+    file.write((const char *) header, sizeof(header));
+
+    for (const MipLevel &level : texture.levels)
+    {
+        int32_t size[2] = { level.width, level.height };
+        file.write((const char *) size, sizeof(size));
+    }
+    file.write((const char *) texture.blocks.data(), texture.blocks.size());
+
+    return (bool) file;
+}
+
+bool read_compressed_texture(CompressedTexture &texture, const char *filepath)
+{
+    std::ifstream file(filepath, std::ios::binary);
+    if (!file) return false;
+
+    char     magic[4];
+    uint32_t header[3];
+    file.read(magic, sizeof(magic));
+    file.read((char *) header, sizeof(header));
+    if (!file || std::memcmp(magic, CONTAINER_MAGIC, sizeof(magic)) != 0 ||
+        header[0] > BLOCK_FORMAT_BC3 || header[1] > ADDITIVE || header[2] == 0 || header[2] > 32) return false;
+
+    texture.format     = (BlockFormat) header[0];
+    texture.alpha_mode = (AlphaMode) header[1];
+    texture.levels.clear();
+
+    size_t total_bytes = 0;
+    for (uint32_t i = 0; i < header[2]; i++)
+    {
+        int32_t size[2];
+        file.read((char *) size, sizeof(size));
+        if (!file || size[0] <= 0 || size[1] <= 0) return false;
+
+        texture.levels.push_back({ size[0], size[1], total_bytes });
+        total_bytes += compressed_level_size(texture.format, size[0], size[1]);
+    }
+
+    texture.blocks.resize(total_bytes);
+    file.read((char *) texture.blocks.data(), total_bytes);
+
+    return (bool) file;
+}
+
+bool upload_compressed_levels(BlockFormat format, const std::vector<MipLevel> &levels, const unsigned char *blocks)
+{
+    bool supported = SDL_GL_ExtensionSupported("GL_EXT_texture_compression_s3tc");
+    GLenum internal_format = format == BLOCK_FORMAT_BC1 ? GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+                                                        : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+
+    std::vector<unsigned char> decoded;
+    for (size_t level = 0; level < levels.size(); level++)
+    {
+        const MipLevel &mip = levels[level];
+        if (supported)
+        {
+            glCompressedTexImage2D(GL_TEXTURE_2D, (GLint) level, internal_format, mip.width, mip.height, 0,
+                                   (GLsizei) compressed_level_size(format, mip.width, mip.height),
+                                   blocks + mip.offset);
+        }
+        else
+        {
+            decoded.resize((size_t) mip.width * mip.height * 4);
+            decompress_blocks(format, blocks + mip.offset, mip.width, mip.height, decoded.data());
+            glTexImage2D(GL_TEXTURE_2D, (GLint) level, GL_RGBA, mip.width, mip.height, 0,
+                         GL_RGBA, GL_UNSIGNED_BYTE, decoded.data());
+        }
+    }
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint) levels.size() - 1);
+    return supported;
+}
+
+bool upload_compressed_texture(const CompressedTexture &texture)
+{
+    return upload_compressed_levels(texture.format, texture.levels, texture.blocks.data());
+}
+
+void print_compression_report(const MipChain &chain, BlockFormat format, AlphaMode alpha_mode)
+{
+    const MipLevel &base        = chain.levels[0];
+    size_t          texel_count = chain.pixels.size() / 4;
+    int             channels    = format == BLOCK_FORMAT_BC1 ? 3 : 4;
+    std::vector<unsigned char> decoded(chain.pixels.size());
+
+    std::cout << "Block compression report for " << base.width << "x" << base.height << ", " << chain.levels.size()
+              << " levels, " << (format == BLOCK_FORMAT_BC1 ? "BC1" : "BC3") << ":\n";
+    for (unsigned thread_count : { 1u, 0u })
+    {
+        auto start = std::chrono::steady_clock::now();
+        CompressedTexture texture = compress_mip_chain(chain, format, alpha_mode, thread_count);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        // The encoder is deterministic, so either run's blocks will do
+        for (size_t level = 0; level < chain.levels.size(); level++)
+            decompress_level(texture, level, decoded.data() + chain.levels[level].offset);
+
+        std::cout << "  " << (thread_count == 1 ? "1 thread   " : "all threads")
+                  << "  " << seconds * 1000.0 << " ms"
+                  << "  " << (double) texel_count / seconds / 1e6 << " Mpix/s"
+                  << "  " << (double) decoded.size() / texture.blocks.size() << ":1\n";
+    }
+
+    std::cout << "  PSNR " << psnr(chain.pixels.data(), decoded.data(), texel_count, channels) << " dB over every level, "
+              << psnr(chain.pixels.data(), decoded.data(), (size_t) base.width * base.height, channels) << " dB at level 0\n";
+}
@@ -0,0 +1,71 @@
+/**
+ * @file BlockCompression.h
+ * @brief BC1/BC3 (S3TC/DXT) texture compression. The encoder runs offline
+ * on decoded sprites and writes a small container that load_texture() can
+ * upload directly with glCompressedTexImage2D, or decode on the CPU when the
+ * driver lacks GL_EXT_texture_compression_s3tc.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+#include "Mipmap.h"
+#include "Texture.h"
+
+enum BlockFormat
+{
+    BLOCK_FORMAT_BC1, // 4 bpp, rgb only; for opaque sprites
+    BLOCK_FORMAT_BC3  // 8 bpp, BC1 colour plus an interpolated alpha block
+};
+
+struct CompressedTexture
+{
+    BlockFormat                format;
+    AlphaMode                  alpha_mode;
+    std::vector<MipLevel>      levels; // offsets index into blocks
+    std::vector<unsigned char> blocks;
+
+    const unsigned char *level_data(size_t level) const { return blocks.data() + levels[level].offset; }
+};
+
+size_t block_bytes(BlockFormat format);
+size_t compressed_level_size(BlockFormat format, int width, int height);
+
+/**
+ * Compresses every level of the chain. Block rows are shared out between
+ * thread_count workers (0 picks one per hardware thread).
+ */
+CompressedTexture compress_mip_chain(const MipChain &chain, BlockFormat format, AlphaMode alpha_mode,
+                                     unsigned thread_count = 0);
+
+/**
+ * Decodes one level back to RGBA8. rgba must hold width * height * 4 bytes.
+ */
+void decompress_level(const CompressedTexture &texture, size_t level, unsigned char *rgba);
+void decompress_blocks(BlockFormat format, const unsigned char *blocks, int width, int height, unsigned char *rgba);
+
+bool write_compressed_texture(const CompressedTexture &texture, const char *filepath);
+bool read_compressed_texture(CompressedTexture &texture, const char *filepath);
+
+/**
+ * Uploads every level to the texture bound to GL_TEXTURE_2D, compressed if
+ * the driver supports S3TC and decoded to RGBA8 otherwise. Returns whether
+ * the compressed path was taken.
+ */
+bool upload_compressed_texture(const CompressedTexture &texture);
+
+/**
+ * Same, for levels whose blocks live elsewhere (e.g. a memory-mapped file).
+ * Level offsets index into blocks.
+ */
+bool upload_compressed_levels(BlockFormat format, const std::vector<MipLevel> &levels, const unsigned char *blocks);
+
+/**
+ * Encodes the chain as compress_mip_chain() would, on one thread and on all,
+ * and prints encode time, throughput and PSNR of the decoded levels against
+ * the chain (rgb only for BC1) to stdout. Pass the chain as it is stored,
+ * i.e. after premultiply_alpha() for premultiplied textures.
+ */
+void print_compression_report(const MipChain &chain, BlockFormat format, AlphaMode alpha_mode);
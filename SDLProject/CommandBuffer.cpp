@@ -0,0 +1,190 @@
+/**
+ * @file CommandBuffer.cpp
+ * @brief Recording, the parallel split and the replay loop. Payloads are
+ * stored as raw 32-bit words, floats copied in bit for bit, so a buffer is
+ * plain memory that can be written on one thread and read on another.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#define GL_SILENCE_DEPRECATION
+#define GLM_ENABLE_EXPERIMENTAL
+#include "CommandBuffer.h"
+#include "ParallelJobs.h"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace
+{
+    // See parallel_thread_count()
+    const size_t MIN_ITEMS_PER_THREAD = 2048;
+
+    // Each thread records several shares, taken from a counter, so one slow
+    // share does not leave the other threads idle
+    const size_t SHARES_PER_THREAD = 4;
+
+    const uint32_t TYPE_MASK    = 0xFF;
+    const unsigned LENGTH_SHIFT = 8;
+
+    inline uint32_t float_bits(float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    inline float bits_float(uint32_t bits)
+    {
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+}
+
+/* ------------------------------ Recording ----------------------------- */
+
+inline uint32_t *CommandBuffer::append(DrawCommandType type, size_t payload_words)
+{
+    size_t start = m_words.size();
+    m_words.resize(start + 1 + payload_words);
+    m_words[start] = (uint32_t) type | (uint32_t) (payload_words << LENGTH_SHIFT);
+    m_command_count++;
+    return &m_words[start + 1];
+}
+
+void CommandBuffer::bind_texture(GLuint texture_id)
+{
+    append(DRAW_COMMAND_BIND_TEXTURE, 1)[0] = texture_id;
+}
+
+void CommandBuffer::set_blend_state(AlphaMode alpha_mode)
+{
+    append(DRAW_COMMAND_SET_BLEND_STATE, 1)[0] = (uint32_t) alpha_mode;
+}
+
+void CommandBuffer::set_model_matrix(const glm::affine2d &model_matrix)
+{
+    uint32_t *payload = append(DRAW_COMMAND_SET_MODEL_MATRIX, 6);
+    for (int column = 0; column < 3; column++)
+    {
+        payload[column * 2]     = float_bits(model_matrix[column].x);
+        payload[column * 2 + 1] = float_bits(model_matrix[column].y);
+    }
+}
+
+void CommandBuffer::set_colour(float red, float green, float blue, float alpha)
+{
+    uint32_t *payload = append(DRAW_COMMAND_SET_COLOUR, 4);
+    payload[0] = float_bits(red);
+    payload[1] = float_bits(green);
+    payload[2] = float_bits(blue);
+    payload[3] = float_bits(alpha);
+}
+
+void CommandBuffer::draw_arrays(GLenum mode, uint32_t first, uint32_t count)
+{
+    uint32_t *payload = append(DRAW_COMMAND_DRAW_ARRAYS, 3);
+    payload[0] = (uint32_t) mode;
+    payload[1] = first;
+    payload[2] = count;
+}
+
+/* ---------------------------- Command list ---------------------------- */
+
+void CommandList::record(size_t item_count, const RecordFunction &record, unsigned thread_count)
+{
+    thread_count = parallel_thread_count(thread_count, item_count, MIN_ITEMS_PER_THREAD);
+
+    m_share_count = thread_count == 1 ? 1 : thread_count * SHARES_PER_THREAD;
+    if (m_buffers.size() < m_share_count) m_buffers.resize(m_share_count);
+
+    auto record_share = [&](size_t share)
+    {
+        CommandBuffer &buffer = m_buffers[share];
+        buffer.clear();
+        record(buffer, item_count * share / m_share_count, item_count * (share + 1) / m_share_count);
+    };
+
+    if (thread_count == 1)
+    {
+        record_share(0);
+        return;
+    }
+
+    run_parallel_jobs(thread_count, m_share_count, record_share);
+}
+
+void CommandList::replay(ShaderProgram &program, CommandReplayState &state)
+{
+    m_skipped_count = 0;
+
+    for (size_t share = 0; share < m_share_count; share++)
+    {
+        const uint32_t *word = m_buffers[share].get_words(),
+                       *end  = word + m_buffers[share].get_word_count();
+        while (word < end)
+        {
+            DrawCommandType type = (DrawCommandType) (*word & TYPE_MASK);
+            const uint32_t *payload = word + 1;
+            word = payload + (*word >> LENGTH_SHIFT);
+            assert(word <= end);
+
+            switch (type)
+            {
+                case DRAW_COMMAND_BIND_TEXTURE:
+                    if (payload[0] == state.texture_id) { m_skipped_count++; break; }
+                    state.texture_id = payload[0];
+                    glBindTexture(GL_TEXTURE_2D, state.texture_id);
+                    break;
+
+                case DRAW_COMMAND_SET_BLEND_STATE:
+                {
+                    AlphaMode blend_state = (AlphaMode) payload[0] == STRAIGHT_ALPHA ? STRAIGHT_ALPHA
+                                                                                    : PREMULTIPLIED_ALPHA;
+                    if (blend_state == state.blend_state) { m_skipped_count++; break; }
+                    state.blend_state = blend_state;
+                    apply_blend_state(blend_state);
+                    break;
+                }
+
+                case DRAW_COMMAND_SET_MODEL_MATRIX:
+                {
+                    glm::affine2d model_matrix;
+                    for (int column = 0; column < 3; column++)
+                        model_matrix[column] = glm::vec2(bits_float(payload[column * 2]),
+                                                         bits_float(payload[column * 2 + 1]));
+                    program.set_model_matrix(glm::toMat4(model_matrix));
+                    break;
+                }
+
+                case DRAW_COMMAND_SET_COLOUR:
+                {
+                    float colour[4];
+                    for (int i = 0; i < 4; i++) colour[i] = bits_float(payload[i]);
+                    if (state.has_colour && std::memcmp(colour, state.colour, sizeof(colour)) == 0)
+                    {
+                        m_skipped_count++;
+                        break;
+                    }
+                    state.has_colour = true;
+                    std::memcpy(state.colour, colour, sizeof(colour));
+                    program.set_colour(colour[0], colour[1], colour[2], colour[3]);
+                    break;
+                }
+
+                case DRAW_COMMAND_DRAW_ARRAYS:
+                    glDrawArrays((GLenum) payload[0], (GLint) payload[1], (GLsizei) payload[2]);
+                    break;
+            }
+        }
+    }
+}
+
+size_t CommandList::get_command_count() const
+{
+    size_t count = 0;
+    for (size_t share = 0; share < m_share_count; share++) count += m_buffers[share].get_command_count();
+    return count;
+}
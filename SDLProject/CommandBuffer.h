@@ -0,0 +1,105 @@
+/**
+ * @file CommandBuffer.h
+ * @brief Draw commands recorded off the GL thread. A CommandBuffer is a
+ * linear array of small POD records (bind a texture, set the blend state,
+ * set the model matrix or colour, draw a range of vertices) that any thread
+ * can fill without touching GL. A CommandList splits the work of recording
+ * a frame between threads, one buffer per contiguous share of the items,
+ * then replays the buffers in order on the thread that owns the context,
+ * dropping state changes that would set what is already set.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "glm/gtx/affine_2d.hpp"
+#include "ShaderProgram.h"
+#include "Texture.h"
+
+enum DrawCommandType
+{
+    DRAW_COMMAND_BIND_TEXTURE,     // texture id
+    DRAW_COMMAND_SET_BLEND_STATE,  // AlphaMode
+    DRAW_COMMAND_SET_MODEL_MATRIX, // the 2x3 of an affine2d
+    DRAW_COMMAND_SET_COLOUR,       // rgba
+    DRAW_COMMAND_DRAW_ARRAYS       // primitive mode, first vertex, vertex count
+};
+
+/**
+ * Commands in recording order. Each takes a header word (type in the low
+ * byte, payload length in words above it) followed by its payload, so a
+ * sprite's matrix and draw take 11 words. Clearing keeps the memory, so a
+ * buffer reused every frame stops allocating once it has grown.
+ */
+class CommandBuffer
+{
+private:
+    std::vector<uint32_t> m_words;
+    size_t                m_command_count = 0;
+
+    uint32_t *append(DrawCommandType type, size_t payload_words);
+
+public:
+    void clear() { m_words.clear(); m_command_count = 0; }
+
+    void bind_texture(GLuint texture_id);
+    void set_blend_state(AlphaMode alpha_mode);
+    void set_model_matrix(const glm::affine2d &model_matrix);
+    void set_colour(float red, float green, float blue, float alpha);
+    void draw_arrays(GLenum mode, uint32_t first, uint32_t count);
+
+    const uint32_t *get_words()         const { return m_words.data(); }
+    size_t          get_word_count()    const { return m_words.size(); }
+    size_t          get_command_count() const { return m_command_count; }
+};
+
+/**
+ * GL state as replay leaves it, and as the caller last set it before.
+ * Commands setting what this already holds are skipped.
+ */
+struct CommandReplayState
+{
+    GLuint    texture_id = 0;
+    AlphaMode blend_state = PREMULTIPLIED_ALPHA; // ADDITIVE is never stored: it shares this state
+    bool      has_colour = false;                // the colour uniform is unknown until set
+    float     colour[4]  = { 1.0f, 1.0f, 1.0f, 1.0f };
+};
+
+class CommandList
+{
+public:
+    /**
+     * Records the commands for items [begin, end) into buffer.
+     */
+    typedef std::function<void(CommandBuffer &buffer, size_t begin, size_t end)> RecordFunction;
+
+private:
+    std::vector<CommandBuffer> m_buffers; // one per share, kept between frames
+    size_t                     m_share_count = 0;
+    size_t                     m_skipped_count = 0;
+
+public:
+    /**
+     * Splits [0, item_count) into contiguous shares and records them with
+     * up to thread_count threads (0 for one per hardware thread), the
+     * calling thread included. Small counts are recorded on the calling
+     * thread alone. record must not call GL.
+     */
+    void record(size_t item_count, const RecordFunction &record, unsigned thread_count = 0);
+
+    /**
+     * Issues the recorded commands, share by share in item order, on the
+     * calling thread, which must have the context current. state is what
+     * the caller has set and is updated to what replay leaves set.
+     */
+    void replay(ShaderProgram &program, CommandReplayState &state);
+
+    size_t get_command_count() const;
+    size_t get_skipped_count() const { return m_skipped_count; } // redundant state changes dropped by the last replay()
+};
@@ -0,0 +1,238 @@
+/**
+ * @file Curve.cpp
+ * @brief Table construction and the batched lookups. Every table entry
+ * carries the step to the next one, so a lookup is one load per lane, a
+ * transpose and a multiply-add.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include "Curve.h"
+#include "glm/glm.hpp"
+#include "glm/gtx/easing.hpp"
+#include "glm/gtx/spline.hpp"
+#include <cassert>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define CURVE_USE_SSE2 1
+#endif
+
+namespace
+{
+    // Spline points per segment used to measure the arc length; the table
+    // is then resampled from these
+    const size_t ARC_SAMPLES_PER_SEGMENT = 64;
+
+    typedef float (*EasingFunction)(const float &);
+
+    const EasingFunction EASING_FUNCTIONS[] =
+    {
+        glm::linearInterpolation<float>,
+        glm::quadraticEaseIn<float>,   glm::quadraticEaseOut<float>,   glm::quadraticEaseInOut<float>,
+        glm::cubicEaseIn<float>,       glm::cubicEaseOut<float>,       glm::cubicEaseInOut<float>,
+        glm::sineEaseIn<float>,        glm::sineEaseOut<float>,        glm::sineEaseInOut<float>,
+        glm::exponentialEaseIn<float>, glm::exponentialEaseOut<float>, glm::exponentialEaseInOut<float>,
+        glm::elasticEaseIn<float>,     glm::elasticEaseOut<float>,     glm::elasticEaseInOut<float>,
+        glm::backEaseIn<float>,        glm::backEaseOut<float>,        glm::backEaseInOut<float>,
+        glm::bounceEaseIn<float>,      glm::bounceEaseOut<float>,      glm::bounceEaseInOut<float>
+    };
+
+    static_assert(sizeof(EASING_FUNCTIONS) / sizeof(EASING_FUNCTIONS[0]) == EASE_BOUNCE_IN_OUT + 1,
+                  "one easing function per EasingCurve");
+
+    // Maps a parameter to a position in [0, interval_count] in the table.
+    // NaN lands on the first entry rather than outside the table.
+    inline float table_position(float t, float interval_count, CurveWrap wrap)
+    {
+        if (wrap == CURVE_REPEAT) t -= std::floor(t);
+        float position = t * interval_count;
+        position = position > 0.0f ? position : 0.0f;
+        return position < interval_count ? position : interval_count;
+    }
+
+#ifdef CURVE_USE_SSE2
+    // std::floor without SSE4.1, as in NoiseField: truncate, then step down
+    // where that rounded up. Values from 2^23 on are already whole.
+    inline __m128 round_down(__m128 x)
+    {
+        __m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+        __m128 floored   = _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, x), _mm_set1_ps(1.0f)));
+        __m128 is_small  = _mm_cmplt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), x), _mm_set1_ps(8388608.0f));
+        return _mm_or_ps(_mm_and_ps(is_small, floored), _mm_andnot_ps(is_small, x));
+    }
+
+    // table_position() for four parameters; max() before min() so NaN ends up at 0
+    inline __m128 table_positions(__m128 t, float interval_count, CurveWrap wrap)
+    {
+        if (wrap == CURVE_REPEAT) t = _mm_sub_ps(t, round_down(t));
+        __m128 position = _mm_max_ps(_mm_mul_ps(t, _mm_set1_ps(interval_count)), _mm_setzero_ps());
+        return _mm_min_ps(position, _mm_set1_ps(interval_count));
+    }
+#endif
+}
+
+/* ---------------------------- CurveTable ---------------------------- */
+
+void CurveTable::build(const std::function<float(float)> &function, size_t interval_count, CurveWrap wrap)
+{
+    assert(interval_count > 0);
+
+    m_entries.resize(interval_count + 1);
+    m_interval_count = (float) interval_count;
+    m_wrap = wrap;
+
+    for (size_t i = 0; i <= interval_count; i++) m_entries[i].x = function((float) i / (float) interval_count);
+
+    // The last entry has no successor, so lookups exactly at 1 add nothing
+    for (size_t i = 0; i < interval_count; i++) m_entries[i].y = m_entries[i + 1].x - m_entries[i].x;
+    m_entries[interval_count].y = 0.0f;
+}
+
+void CurveTable::build(EasingCurve curve, size_t interval_count)
+{
+    EasingFunction easing = EASING_FUNCTIONS[curve];
+    build([easing](float t) { return easing(t); }, interval_count, CURVE_CLAMP);
+}
+
+float CurveTable::evaluate(float t) const
+{
+    float position = table_position(t, m_interval_count, m_wrap);
+    int index = (int) position;
+    const glm::vec2 &entry = m_entries[index];
+    return entry.x + (position - (float) index) * entry.y;
+}
+
+void CurveTable::evaluate(const float *t, float *out, size_t count) const
+{
+    size_t i = 0;
+
+#ifdef CURVE_USE_SSE2
+    const float *entries = &m_entries[0].x;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128  position = table_positions(_mm_loadu_ps(t + i), m_interval_count, m_wrap);
+        __m128i index    = _mm_cvttps_epi32(position);
+        __m128  fraction = _mm_sub_ps(position, _mm_cvtepi32_ps(index));
+
+        alignas(16) int indices[4];
+        _mm_store_si128((__m128i *) indices, index);
+
+        // (value, step) pairs for lanes 0 and 1, then 2 and 3
+        __m128 low  = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *) (entries + 2 * indices[0])),
+                                   (const __m64 *) (entries + 2 * indices[1]));
+        __m128 high = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *) (entries + 2 * indices[2])),
+                                   (const __m64 *) (entries + 2 * indices[3]));
+        __m128 value = _mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 step  = _mm_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1));
+
+        _mm_storeu_ps(out + i, _mm_add_ps(value, _mm_mul_ps(fraction, step)));
+    }
+#endif
+
+    for (; i < count; i++) out[i] = evaluate(t[i]);
+}
+
+/* ---------------------------- SplinePath ---------------------------- */
+
+void SplinePath::build(const glm::vec2 *points, size_t point_count, bool closed, size_t interval_count)
+{
+    assert(point_count >= 2 && interval_count > 0);
+
+    // Control point i, with the ends reflected (open) or wrapped (closed)
+    auto control = [&](long i) -> glm::vec2
+    {
+        long n = (long) point_count;
+        if (closed) return points[((i % n) + n) % n];
+        if (i < 0)  return 2.0f * points[0] - points[1];
+        if (i >= n) return 2.0f * points[n - 1] - points[n - 2];
+        return points[i];
+    };
+
+    // Measure the spline finely, keeping the cumulative length at each sample
+    size_t segment_count = closed ? point_count : point_count - 1;
+    size_t sample_count  = segment_count * ARC_SAMPLES_PER_SEGMENT;
+
+    std::vector<glm::vec2> samples(sample_count + 1);
+    std::vector<float>     lengths(sample_count + 1);
+    for (size_t segment = 0; segment < segment_count; segment++)
+    {
+        glm::vec2 p0 = control((long) segment - 1), p1 = control((long) segment),
+                  p2 = control((long) segment + 1), p3 = control((long) segment + 2);
+        for (size_t j = 0; j < ARC_SAMPLES_PER_SEGMENT; j++)
+        {
+            float s = (float) j / (float) ARC_SAMPLES_PER_SEGMENT;
+            samples[segment * ARC_SAMPLES_PER_SEGMENT + j] = glm::catmullRom(p0, p1, p2, p3, s);
+        }
+    }
+    samples[sample_count] = control((long) segment_count);
+
+    lengths[0] = 0.0f;
+    for (size_t i = 1; i <= sample_count; i++) lengths[i] = lengths[i - 1] + glm::distance(samples[i - 1], samples[i]);
+
+    m_length = lengths[sample_count];
+    m_closed = closed;
+    m_interval_count = (float) interval_count;
+
+    // Resample at even steps of length
+    std::vector<glm::vec2> positions(interval_count + 1);
+    size_t sample = 0;
+    for (size_t i = 0; i <= interval_count; i++)
+    {
+        float target = m_length * (float) i / (float) interval_count;
+        while (sample + 1 < sample_count && lengths[sample + 1] < target) sample++;
+
+        float span = lengths[sample + 1] - lengths[sample];
+        float t = span > 0.0f ? glm::clamp((target - lengths[sample]) / span, 0.0f, 1.0f) : 0.0f;
+        positions[i] = glm::mix(samples[sample], samples[sample + 1], t);
+    }
+    positions[interval_count] = samples[sample_count];
+
+    m_entries.resize(interval_count + 1);
+    for (size_t i = 0; i < interval_count; i++) m_entries[i] = glm::vec4(positions[i], positions[i + 1] - positions[i]);
+    m_entries[interval_count] = glm::vec4(positions[interval_count], 0.0f, 0.0f);
+}
+
+glm::vec2 SplinePath::evaluate(float s) const
+{
+    float position = table_position(s, m_interval_count, m_closed ? CURVE_REPEAT : CURVE_CLAMP);
+    int index = (int) position;
+    const glm::vec4 &entry = m_entries[index];
+    float fraction = position - (float) index;
+    return glm::vec2(entry.x + fraction * entry.z, entry.y + fraction * entry.w);
+}
+
+void SplinePath::evaluate(const float *s, glm::vec2 *out, size_t count) const
+{
+    size_t i = 0;
+
+#ifdef CURVE_USE_SSE2
+    const float *entries = &m_entries[0].x;
+    float *destination = &out[0].x;
+    CurveWrap wrap = m_closed ? CURVE_REPEAT : CURVE_CLAMP;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128  position = table_positions(_mm_loadu_ps(s + i), m_interval_count, wrap);
+        __m128i index    = _mm_cvttps_epi32(position);
+        __m128  fraction = _mm_sub_ps(position, _mm_cvtepi32_ps(index));
+
+        alignas(16) int indices[4];
+        _mm_store_si128((__m128i *) indices, index);
+
+        // One (x, y, dx, dy) entry per lane, transposed to x, y, dx, dy lanes
+        __m128 x  = _mm_loadu_ps(entries + 4 * indices[0]), y  = _mm_loadu_ps(entries + 4 * indices[1]),
+               dx = _mm_loadu_ps(entries + 4 * indices[2]), dy = _mm_loadu_ps(entries + 4 * indices[3]);
+        _MM_TRANSPOSE4_PS(x, y, dx, dy);
+
+        x = _mm_add_ps(x, _mm_mul_ps(fraction, dx));
+        y = _mm_add_ps(y, _mm_mul_ps(fraction, dy));
+        _mm_storeu_ps(destination + 2 * i,     _mm_unpacklo_ps(x, y));
+        _mm_storeu_ps(destination + 2 * i + 4, _mm_unpackhi_ps(x, y));
+    }
+#endif
+
+    for (; i < count; i++) out[i] = evaluate(s[i]);
+}
@@ -0,0 +1,212 @@
+/**
+ * @file FramePipeline.cpp
+ * @brief Frame hand-over between the simulation and render threads. Frame
+ * n goes in slot n % get_slot_count(); two counters, frames submitted and
+ * frames rendered, say which slots each side may touch, and one condition
+ * variable wakes either side when they move.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#include "FramePipeline.h"
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+
+namespace
+{
+    // How long the simulating thread waits for the renderer between calls
+    // to while_waiting
+    const std::chrono::milliseconds WAIT_SLICE(1);
+
+    template <typename Duration>
+    double to_milliseconds(Duration duration)
+    {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+}
+
+/* ------------------------------ Lifetime ------------------------------ */
+
+void FramePipeline::start(unsigned depth, const RenderFunction &render,
+                          const ThreadFunction &on_start, const ThreadFunction &on_stop,
+                          const ThreadFunction &while_waiting)
+{
+    assert(render);
+    stop();
+
+    m_depth         = std::min(depth, FRAME_PIPELINE_MAX_DEPTH);
+    m_slot_count    = std::max(1u, m_depth);
+    m_render        = render;
+    m_on_start      = on_start;
+    m_on_stop       = on_stop;
+    m_while_waiting = while_waiting;
+
+    m_begin_times.assign(m_slot_count, Clock::time_point());
+    m_submitted = m_rendered = 0;
+    m_stopping  = m_finished = false;
+    m_latency_milliseconds = m_max_latency_milliseconds = m_last_latency_milliseconds = 0.0;
+    m_wait_milliseconds = m_idle_milliseconds = 0.0;
+    m_running = true;
+
+    if (m_depth == 0)
+    {
+        if (m_on_start) m_on_start();
+        return;
+    }
+    m_thread = std::thread(&FramePipeline::render_loop, this);
+}
+
+void FramePipeline::stop()
+{
+    if (!m_running) return;
+    m_running = false;
+
+    if (m_depth == 0)
+    {
+        if (m_on_stop) m_on_stop();
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_stopping = true;
+        m_changed.notify_all();
+
+        // The last frames and on_stop may still need this thread's events
+        wait_for_renderer(lock, [this] { return m_finished; });
+    }
+    m_thread.join();
+}
+
+/* ----------------------------- Simulation ----------------------------- */
+
+size_t FramePipeline::begin_frame()
+{
+    assert(m_running);
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    // The slot is free once the frame that last used it has been drawn
+    if (m_submitted >= m_rendered + m_slot_count)
+    {
+        Clock::time_point waited = Clock::now();
+        wait_for_renderer(lock, [this] { return m_submitted < m_rendered + m_slot_count; });
+        m_wait_milliseconds += to_milliseconds(Clock::now() - waited);
+    }
+
+    size_t slot = m_submitted % m_slot_count;
+    m_begin_times[slot] = Clock::now();
+    return slot;
+}
+
+void FramePipeline::submit_frame()
+{
+    assert(m_running);
+    if (m_depth == 0)
+    {
+        m_submitted++;
+        render_frame(m_rendered);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_submitted++;
+    }
+    m_changed.notify_all();
+}
+
+// Waits until ready(), running while_waiting unlocked between slices
+void FramePipeline::wait_for_renderer(std::unique_lock<std::mutex> &lock, const std::function<bool()> &ready)
+{
+    while (!m_changed.wait_for(lock, WAIT_SLICE, ready))
+    {
+        if (!m_while_waiting) continue;
+        lock.unlock();
+        m_while_waiting();
+        lock.lock();
+    }
+}
+
+/* ------------------------------ Rendering ----------------------------- */
+
+// Called without the lock: only the renderer moves m_rendered, and the
+// simulation leaves the slot alone until it has
+void FramePipeline::render_frame(size_t frame)
+{
+    size_t slot = frame % m_slot_count;
+    Clock::time_point begun;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        begun = m_begin_times[slot];
+    }
+
+    m_render(slot);
+    double latency = to_milliseconds(Clock::now() - begun);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_latency_milliseconds     += latency;
+        m_max_latency_milliseconds  = std::max(m_max_latency_milliseconds, latency);
+        m_last_latency_milliseconds = latency;
+        m_rendered++;
+    }
+    m_changed.notify_all();
+}
+
+void FramePipeline::render_loop()
+{
+    if (m_on_start) m_on_start();
+
+    for (;;)
+    {
+        size_t frame;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            Clock::time_point idle = Clock::now();
+            m_changed.wait(lock, [this] { return m_stopping || m_submitted > m_rendered; });
+            m_idle_milliseconds += to_milliseconds(Clock::now() - idle);
+
+            // Stopping still draws whatever was submitted first
+            if (m_submitted == m_rendered) break;
+            frame = m_rendered;
+        }
+        render_frame(frame);
+    }
+
+    if (m_on_stop) m_on_stop();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_finished = true;
+    }
+    m_changed.notify_all();
+}
+
+/* ------------------------------- Report ------------------------------- */
+
+double FramePipeline::get_last_latency() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_last_latency_milliseconds;
+}
+
+double FramePipeline::get_average_latency() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_rendered == 0 ? 0.0 : m_latency_milliseconds / m_rendered;
+}
+
+void FramePipeline::print_report() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    double average = m_rendered == 0 ? 0.0 : m_latency_milliseconds / m_rendered;
+
+    std::cout << "Frame pipeline (depth " << m_depth << (m_depth == 0 ? ", no render thread" : "") << "):\n"
+              << "  " << m_rendered << " frames, latency " << average << " ms average, "
+              << m_max_latency_milliseconds << " ms worst\n"
+              << "  simulation waited " << m_wait_milliseconds << " ms";
+    if (m_depth > 0) std::cout << ", renderer idle " << m_idle_milliseconds << " ms";
+    std::cout << "\n";
+}
@@ -0,0 +1,119 @@
+/**
+ * @file FramePipeline.h
+ * @brief Overlaps simulation with rendering. The main thread simulates
+ * frame N+1 into one slot of render state while a render thread, which
+ * owns the GL context, draws frame N from another. Slots are handed over
+ * in turn and never shared: the simulation only writes a slot the renderer
+ * has finished with, and the renderer only reads a slot once it has been
+ * submitted, so each frame it draws is an immutable snapshot.
+ *
+ * The depth is how many frames the simulation may have submitted and not
+ * yet seen drawn. 1 keeps the two in lockstep, 2 double-buffers and 3
+ * triple-buffers: each step lets the simulation run on instead of waiting
+ * for the renderer (e.g. on vsync) but shows its frames later. 0 renders on
+ * the calling thread with no render thread at all, as a baseline. The
+ * latency from begin_frame() until the frame's render function returns
+ * (after the swap) is measured so the depth can be chosen.
+ *
+ * The simulating thread never blocks on the renderer outright: it waits in
+ * short slices and runs a caller-supplied function between them. On macOS
+ * SDL finishes some GL calls made off the main thread (context updates in
+ * SDL_GL_MakeCurrent and SDL_GL_SwapWindow) on the main queue, so the main
+ * thread must keep pumping events while the renderer needs it.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+const unsigned FRAME_PIPELINE_MAX_DEPTH = 3;
+
+class FramePipeline
+{
+public:
+    typedef std::function<void()>            ThreadFunction;
+    typedef std::function<void(size_t slot)> RenderFunction;
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    unsigned       m_depth = 0;
+    size_t         m_slot_count = 1;
+    RenderFunction m_render;
+    ThreadFunction m_on_start, m_on_stop, m_while_waiting;
+    std::thread    m_thread;
+    bool           m_running = false;
+
+    // Guarded by m_mutex once the render thread runs
+    mutable std::mutex             m_mutex;
+    std::condition_variable        m_changed;
+    std::vector<Clock::time_point> m_begin_times; // per slot
+    size_t                         m_submitted = 0;
+    size_t                         m_rendered  = 0;
+    bool                           m_stopping  = false;
+    bool                           m_finished  = false; // render thread past on_stop
+
+    double m_latency_milliseconds     = 0.0; // summed over every frame
+    double m_max_latency_milliseconds = 0.0;
+    double m_last_latency_milliseconds = 0.0;
+    double m_wait_milliseconds        = 0.0; // simulation blocked in begin_frame()
+    double m_idle_milliseconds        = 0.0; // render thread waiting for a frame
+
+    void render_frame(size_t frame);
+    void render_loop();
+    void wait_for_renderer(std::unique_lock<std::mutex> &lock, const std::function<bool()> &ready);
+
+public:
+    ~FramePipeline() { stop(); }
+
+    /**
+     * Starts the pipeline, clamping depth to FRAME_PIPELINE_MAX_DEPTH.
+     * render draws the frame in the given slot, which is below
+     * get_slot_count(). on_start and on_stop run on the thread that will
+     * render before the first frame and after the last: the place to make
+     * the GL context current there, and to release what needs it.
+     * while_waiting runs on the calling thread every few milliseconds that
+     * begin_frame() or stop() spends waiting for the render thread.
+     */
+    void start(unsigned depth, const RenderFunction &render,
+               const ThreadFunction &on_start = ThreadFunction(), const ThreadFunction &on_stop = ThreadFunction(),
+               const ThreadFunction &while_waiting = ThreadFunction());
+
+    /**
+     * Renders every frame submitted, then stops the render thread.
+     */
+    void stop();
+
+    /**
+     * The slot to write the next frame's render state into, waiting first
+     * if depth frames are already in flight.
+     */
+    size_t begin_frame();
+
+    /**
+     * Hands the slot from begin_frame() to the renderer. With depth 0 the
+     * frame is rendered before this returns.
+     */
+    void submit_frame();
+
+    unsigned get_depth()      const { return m_depth; }
+    size_t   get_slot_count() const { return m_slot_count; }
+
+    /**
+     * Milliseconds from begin_frame() to the end of rendering, for the
+     * last frame drawn and averaged over all of them.
+     */
+    double get_last_latency()    const;
+    double get_average_latency() const;
+
+    void print_report() const;
+};
@@ -0,0 +1,495 @@
+/**
+ * @file GifStream.cpp
+ * @brief GIF89a block parser and LZW decoder. stb_image only ever hands out
+ * the first frame, so this is a small standalone decoder that writes each
+ * frame's indices straight into the composition canvas.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#define GL_SILENCE_DEPRECATION
+#include "GifStream.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    constexpr int MAX_LZW_CODES     = 4096,
+                  MIN_FRAME_DELAY   = 20, // ms; browsers treat anything faster as 100 ms-ish noise
+                  DEFAULT_DELAY_MS  = 100;
+
+    constexpr int EXTENSION_INTRODUCER = 0x21,
+                  IMAGE_SEPARATOR      = 0x2C,
+                  TRAILER              = 0x3B,
+                  GRAPHIC_CONTROL      = 0xF9;
+
+    int delay_to_ms(int centiseconds)
+    {
+        int delay = centiseconds * 10;
+        return delay < MIN_FRAME_DELAY ? DEFAULT_DELAY_MS : delay;
+    }
+}
+
+int GifStream::read_byte()
+{
+    if (m_buffer_position == m_buffer_size)
+    {
+        m_file.read((char *) m_buffer, sizeof(m_buffer));
+        m_buffer_size     = (size_t) m_file.gcount();
+        m_buffer_position = 0;
+
+        if (m_buffer_size == 0)
+        {
+            m_failed = true;
+            return 0;
+        }
+    }
+    return m_buffer[m_buffer_position++];
+}
+
+int GifStream::read_u16()
+{
+    int low = read_byte();
+    return low | (read_byte() << 8);
+}
+
+void GifStream::skip_sub_blocks()
+{
+    for (int length = read_byte(); length != 0 && !m_failed; length = read_byte())
+        for (int i = 0; i < length; i++) read_byte();
+}
+
+void GifStream::read_extension(int &disposal, int &delay_cs, int &transparent_index)
+{
+    if (read_byte() == GRAPHIC_CONTROL)
+    {
+        int length = read_byte();
+        if (length == 4)
+        {
+            int packed = read_byte();
+            delay_cs   = read_u16();
+            int index  = read_byte();
+
+            disposal          = (packed >> 2) & 7;
+            transparent_index = (packed & 1) ? index : -1;
+        }
+        else for (int i = 0; i < length; i++) read_byte();
+    }
+
+    // Everything else (comments, NETSCAPE looping, ...) is skipped
+    skip_sub_blocks();
+}
+
+bool GifStream::open(const char *filepath)
+{
+    m_file.close();
+    m_file.clear();
+    m_file.open(filepath, std::ios::binary);
+    m_buffer_size = m_buffer_position = 0;
+    m_failed = !m_file;
+    if (m_failed) return false;
+
+    char signature[6];
+    for (char &c : signature) c = (char) read_byte();
+    if (std::memcmp(signature, "GIF87a", 6) != 0 && std::memcmp(signature, "GIF89a", 6) != 0)
+    {
+        m_failed = true;
+        return false;
+    }
+
+    m_width  = read_u16();
+    m_height = read_u16();
+    int flags = read_byte();
+    read_byte(); // background index; we dispose to transparent like browsers do
+    read_byte(); // pixel aspect ratio
+
+    m_global_palette_size = (flags & 0x80) ? 2 << (flags & 7) : 0;
+    for (int i = 0; i < m_global_palette_size; i++)
+        for (int c = 0; c < 3; c++) m_global_palette[i][c] = (unsigned char) read_byte();
+
+    if (m_failed || m_width == 0 || m_height == 0) return false;
+
+    // Small files hit EOF on the first buffered read, which makes tellg() fail
+    m_file.clear();
+    m_first_block = m_file.tellg() - (std::streamoff) (m_buffer_size - m_buffer_position);
+    m_canvas.assign((size_t) m_width * m_height * 4, 0);
+    rewind();
+
+    return true;
+}
+
+void GifStream::rewind()
+{
+    m_file.clear();
+    m_file.seekg(m_first_block);
+    m_buffer_size = m_buffer_position = 0;
+    m_failed = false;
+
+    std::fill(m_canvas.begin(), m_canvas.end(), 0);
+    m_frame_index       = 0;
+    m_previous_disposal = 0;
+}
+
+void GifStream::dispose_previous_frame()
+{
+    const int left  = m_previous_rect[0], top    = m_previous_rect[1],
+              right = m_previous_rect[2], bottom = m_previous_rect[3];
+
+    for (int y = top; y < bottom; y++)
+    {
+        unsigned char *row = &m_canvas[((size_t) y * m_width + left) * 4];
+        size_t         row_bytes = (size_t) (right - left) * 4;
+
+        if (m_previous_disposal == DISPOSE_BACKGROUND)
+            std::memset(row, 0, row_bytes);
+        else if (m_previous_disposal == DISPOSE_PREVIOUS && !m_restore.empty())
+            std::memcpy(row, &m_restore[(size_t) (y - top) * row_bytes], row_bytes);
+    }
+}
+
+bool GifStream::decode_image(int left, int top, int width, int height, bool interlaced,
+                             const unsigned char (*palette)[3], int transparent_index)
+{
+    int min_code_size = read_byte();
+    if (min_code_size < 2 || min_code_size > 11) return false;
+
+    const int clear_code = 1 << min_code_size,
+              end_code   = clear_code + 1;
+
+    for (int i = 0; i < clear_code; i++)
+    {
+        m_prefix[i] = 0;
+        m_suffix[i] = (unsigned char) i;
+    }
+
+    int code_size = min_code_size + 1,
+        next_code = end_code + 1,
+        previous  = -1,
+        first     = 0;
+
+    uint32_t bit_buffer = 0;
+    int      bit_count = 0, block_left = 0;
+    bool     data_ended = false;
+
+    // Interlaced frames store rows in four passes
+    static const int PASS_START[4] = { 0, 4, 2, 1 },
+                     PASS_STEP[4]  = { 8, 8, 4, 2 };
+    int x = 0, y = 0, pass = 0;
+    const size_t pixel_total = (size_t) width * height;
+    size_t       pixel_count = 0;
+
+    auto emit = [&](int index)
+    {
+        if (pixel_count++ >= pixel_total) return;
+
+        int canvas_x = left + x, canvas_y = top + y;
+        if (index != transparent_index && canvas_x < m_width && canvas_y < m_height)
+        {
+            unsigned char *pixel = &m_canvas[((size_t) canvas_y * m_width + canvas_x) * 4];
+            pixel[0] = palette[index][0];
+            pixel[1] = palette[index][1];
+            pixel[2] = palette[index][2];
+            pixel[3] = 255;
+        }
+
+        if (++x < width) return;
+        x = 0;
+        if (!interlaced) { y++; return; }
+
+        y += PASS_STEP[pass];
+        while (y >= height && pass < 3) y = PASS_START[++pass];
+    };
+
+    while (!m_failed)
+    {
+        while (bit_count < code_size)
+        {
+            if (block_left == 0)
+            {
+                block_left = read_byte();
+                if (block_left == 0) { data_ended = true; break; }
+            }
+            bit_buffer |= (uint32_t) read_byte() << bit_count;
+            bit_count  += 8;
+            block_left--;
+        }
+        if (data_ended || m_failed) break;
+
+        int code = bit_buffer & ((1 << code_size) - 1);
+        bit_buffer >>= code_size;
+        bit_count   -= code_size;
+
+        if (code == clear_code)
+        {
+            code_size = min_code_size + 1;
+            next_code = end_code + 1;
+            previous  = -1;
+            continue;
+        }
+        if (code == end_code) break;
+
+        if (previous == -1)
+        {
+            if (code > clear_code) return false;
+            emit(code);
+            previous = first = code;
+            continue;
+        }
+        if (code > next_code) return false;
+
+        int in_code = code, stack_size = 0;
+        if (code == next_code)
+        {
+            m_stack[stack_size++] = (unsigned char) first;
+            code = previous;
+        }
+        while (code >= clear_code)
+        {
+            m_stack[stack_size++] = m_suffix[code];
+            code = m_prefix[code];
+        }
+        first = code;
+        m_stack[stack_size++] = (unsigned char) code;
+
+        if (next_code < MAX_LZW_CODES)
+        {
+            m_prefix[next_code] = (uint16_t) previous;
+            m_suffix[next_code] = (unsigned char) first;
+            if (++next_code == (1 << code_size) && code_size < 12) code_size++;
+        }
+        previous = in_code;
+
+        while (stack_size > 0) emit(m_stack[--stack_size]);
+    }
+
+    // Drop whatever is left of the image data
+    if (!data_ended && !m_failed)
+    {
+        while (block_left-- > 0) read_byte();
+        skip_sub_blocks();
+    }
+
+    return !m_failed;
+}
+
+bool GifStream::next_frame(GifFrame &frame)
+{
+    int delay_cs = 0, transparent_index = -1, disposal = 0;
+
+    while (!m_failed)
+    {
+        int block = read_byte();
+        if (m_failed || block == TRAILER) return false;
+
+        if (block == EXTENSION_INTRODUCER)
+        {
+            read_extension(disposal, delay_cs, transparent_index);
+            continue;
+        }
+
+        if (block != IMAGE_SEPARATOR)
+        {
+            m_failed = true;
+            return false;
+        }
+
+        int left = read_u16(), top = read_u16(), width = read_u16(), height = read_u16();
+        int flags = read_byte();
+
+        unsigned char local_palette[256][3];
+        const unsigned char (*palette)[3] = m_global_palette;
+        int palette_size = m_global_palette_size;
+        if (flags & 0x80)
+        {
+            palette_size = 2 << (flags & 7);
+            for (int i = 0; i < palette_size; i++)
+                for (int c = 0; c < 3; c++) local_palette[i][c] = (unsigned char) read_byte();
+            palette = local_palette;
+        }
+        // Out-of-range indices read black rather than past the table
+        if (palette == m_global_palette && palette_size < 256)
+            std::memset(m_global_palette[palette_size], 0, (256 - palette_size) * 3);
+        else if (palette == local_palette && palette_size < 256)
+            std::memset(local_palette[palette_size], 0, (256 - palette_size) * 3);
+
+        // The previous frame's disposal applies now, before we draw over it
+        dispose_previous_frame();
+
+        int clipped[4] = { std::min(left, m_width), std::min(top, m_height),
+                           std::min(left + width, m_width), std::min(top + height, m_height) };
+
+        if (disposal == DISPOSE_PREVIOUS)
+        {
+            size_t row_bytes = (size_t) (clipped[2] - clipped[0]) * 4;
+            m_restore.resize(row_bytes * (clipped[3] - clipped[1]));
+            for (int y = clipped[1]; y < clipped[3]; y++)
+                std::memcpy(&m_restore[(size_t) (y - clipped[1]) * row_bytes],
+                            &m_canvas[((size_t) y * m_width + clipped[0]) * 4], row_bytes);
+        }
+
+        if (!decode_image(left, top, width, height, (flags & 0x40) != 0, palette, transparent_index))
+        {
+            m_failed = true;
+            return false;
+        }
+
+        m_previous_disposal = disposal;
+        std::copy(clipped, clipped + 4, m_previous_rect);
+
+        frame.pixels   = m_canvas.data();
+        frame.delay_ms = delay_to_ms(delay_cs);
+        frame.index    = m_frame_index++;
+        return true;
+    }
+
+    return false;
+}
+
+int GifStream::scan_frames(std::vector<int> &delays_ms)
+{
+    rewind();
+    delays_ms.clear();
+
+    int delay_cs = 0, disposal = 0, transparent_index = -1;
+    while (!m_failed)
+    {
+        int block = read_byte();
+        if (m_failed || block == TRAILER) break;
+
+        if (block == EXTENSION_INTRODUCER)
+        {
+            read_extension(disposal, delay_cs, transparent_index);
+        }
+        else if (block == IMAGE_SEPARATOR)
+        {
+            for (int i = 0; i < 8; i++) read_byte();
+            int flags = read_byte();
+            if (flags & 0x80)
+                for (int i = 0; i < (2 << (flags & 7)) * 3; i++) read_byte();
+
+            read_byte(); // LZW minimum code size
+            skip_sub_blocks();
+
+            delays_ms.push_back(delay_to_ms(delay_cs));
+            delay_cs = 0;
+        }
+        else break;
+    }
+
+    rewind();
+    return (int) delays_ms.size();
+}
+
+bool GifPlayer::load(const char *filepath, AlphaMode alpha_mode)
+{
+    GifFrame frame;
+    if (!m_stream.open(filepath) || !m_stream.next_frame(frame)) return false;
+
+    m_alpha_mode = alpha_mode;
+
+    glGenTextures(1, &m_texture_id);
+    glBindTexture(GL_TEXTURE_2D, m_texture_id);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_stream.get_width(), m_stream.get_height(), 0,
+                 GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    set_texture_alpha_mode(m_texture_id, alpha_mode);
+
+    upload(frame);
+    return true;
+}
+
+void GifPlayer::upload(const GifFrame &frame)
+{
+    // The canvas has to stay straight alpha for the next frame to compose
+    // over, so premultiply into a separate, reused staging copy
+    m_upload.assign(frame.pixels, frame.pixels + (size_t) m_stream.get_width() * m_stream.get_height() * 4);
+    if (m_alpha_mode == PREMULTIPLIED_ALPHA) premultiply_alpha(m_upload.data(), m_upload.size() / 4);
+    else if (m_alpha_mode == ADDITIVE)       premultiply_additive(m_upload.data(), m_upload.size() / 4);
+
+    glBindTexture(GL_TEXTURE_2D, m_texture_id);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, m_stream.get_width(), m_stream.get_height(),
+                    GL_RGBA, GL_UNSIGNED_BYTE, m_upload.data());
+
+    m_time_left += frame.delay_ms / 1000.0f;
+}
+
+void GifPlayer::update(float delta_time)
+{
+    if (m_texture_id == 0) return;
+
+    m_time_left -= delta_time;
+    if (m_time_left > 0.0f) return;
+
+    // If we fell behind, skip straight to the frame that should be showing
+    // but only upload that one
+    GifFrame frame;
+    bool     have_frame = false;
+    while (m_time_left <= 0.0f)
+    {
+        if (!m_stream.next_frame(frame))
+        {
+            m_stream.rewind();
+            if (!m_stream.next_frame(frame)) return;
+        }
+        have_frame = true;
+        if (m_time_left + frame.delay_ms / 1000.0f > 0.0f) break;
+        m_time_left += frame.delay_ms / 1000.0f;
+    }
+
+    if (have_frame) upload(frame);
+}
+
+void GifAtlas::frame_uvs(int frame, float uvs[4]) const
+{
+    int column = frame % columns, row = frame / columns;
+    uvs[0] = (float) column / columns;
+    uvs[1] = (float) row / rows;
+    uvs[2] = (float) (column + 1) / columns;
+    uvs[3] = (float) (row + 1) / rows;
+}
+
+GifAtlas build_gif_atlas(const char *filepath, AlphaMode alpha_mode)
+{
+    GifAtlas  atlas = { 0, 0, 0, 0, 0, {} };
+    GifStream stream;
+    if (!stream.open(filepath)) return atlas;
+
+    int frame_count = stream.scan_frames(atlas.delays_ms);
+    if (frame_count == 0) return atlas;
+
+    atlas.frame_width  = stream.get_width();
+    atlas.frame_height = stream.get_height();
+    atlas.columns      = (int) std::ceil(std::sqrt((float) frame_count));
+    atlas.rows         = (frame_count + atlas.columns - 1) / atlas.columns;
+
+    GLint max_size;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_size);
+    if (atlas.columns * atlas.frame_width > max_size || atlas.rows * atlas.frame_height > max_size) return atlas;
+
+    glGenTextures(1, &atlas.texture_id);
+    glBindTexture(GL_TEXTURE_2D, atlas.texture_id);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, atlas.columns * atlas.frame_width, atlas.rows * atlas.frame_height, 0,
+                 GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    set_texture_alpha_mode(atlas.texture_id, alpha_mode);
+
+    std::vector<unsigned char> staging;
+    GifFrame frame;
+    while (stream.next_frame(frame) && frame.index < frame_count)
+    {
+        staging.assign(frame.pixels, frame.pixels + (size_t) atlas.frame_width * atlas.frame_height * 4);
+        if (alpha_mode == PREMULTIPLIED_ALPHA) premultiply_alpha(staging.data(), staging.size() / 4);
+        else if (alpha_mode == ADDITIVE)       premultiply_additive(staging.data(), staging.size() / 4);
+
+        glTexSubImage2D(GL_TEXTURE_2D, 0,
+                        (frame.index % atlas.columns) * atlas.frame_width,
+                        (frame.index / atlas.columns) * atlas.frame_height,
+                        atlas.frame_width, atlas.frame_height, GL_RGBA, GL_UNSIGNED_BYTE, staging.data());
+    }
+
+    return atlas;
+}
@@ -0,0 +1,139 @@
+/**
+ * @file GifStream.h
+ * @brief Incremental animated GIF decoding. Frames are decoded one at a time
+ * into a single composition buffer, so memory stays at one canvas no matter
+ * how long the animation is. GifPlayer and build_gif_atlas() feed the frames
+ * to GL.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+#ifdef _WINDOWS
+    #include <GL/glew.h>
+#endif
+#define GL_GLEXT_PROTOTYPES 1
+#include <SDL_opengl.h>
+#include <cstdint>
+#include <fstream>
+#include <vector>
+#include "Texture.h"
+
+struct GifFrame
+{
+    const unsigned char *pixels;   // canvas-sized straight-alpha RGBA, owned by the stream
+    int                  delay_ms; // how long to show this frame
+    int                  index;
+};
+
+class GifStream
+{
+private:
+    enum Disposal { DISPOSE_NONE = 1, DISPOSE_BACKGROUND = 2, DISPOSE_PREVIOUS = 3 };
+
+    std::ifstream m_file;
+    unsigned char m_buffer[4096];
+    size_t        m_buffer_size     = 0;
+    size_t        m_buffer_position = 0;
+    bool          m_failed          = false;
+
+    int           m_width  = 0;
+    int           m_height = 0;
+    unsigned char m_global_palette[256][3];
+    int           m_global_palette_size = 0;
+    std::streampos m_first_block;
+
+    std::vector<unsigned char> m_canvas;  // the one composition buffer
+    std::vector<unsigned char> m_restore; // saved rect for DISPOSE_PREVIOUS, only if used
+
+    int m_frame_index       = 0;
+    int m_previous_disposal = 0;
+    int m_previous_rect[4]  = {};
+
+    // LZW tables, reused for every frame
+    uint16_t      m_prefix[4096];
+    unsigned char m_suffix[4096];
+    unsigned char m_stack[4097];
+
+    int  read_byte();
+    int  read_u16();
+    void skip_sub_blocks();
+    void read_extension(int &disposal, int &delay_cs, int &transparent_index);
+    void dispose_previous_frame();
+    bool decode_image(int left, int top, int width, int height, bool interlaced,
+                      const unsigned char (*palette)[3], int transparent_index);
+
+public:
+    bool open(const char *filepath);
+
+    /**
+     * Decodes the next frame into the composition buffer. Returns false at
+     * the end of the stream or on a corrupt file (see failed()).
+     */
+    bool next_frame(GifFrame &frame);
+
+    /**
+     * Seeks back to the first frame and clears the canvas, for looping.
+     */
+    void rewind();
+
+    /**
+     * Walks the block structure without decoding pixels, filling in each
+     * frame's delay. Leaves the stream rewound.
+     */
+    int scan_frames(std::vector<int> &delays_ms);
+
+    int  get_width()  const { return m_width;  };
+    int  get_height() const { return m_height; };
+    bool failed()     const { return m_failed; };
+};
+
+/**
+ * Streams a GIF into one texture, decoding the next frame only when the
+ * current one's delay has elapsed.
+ */
+class GifPlayer
+{
+private:
+    GifStream                  m_stream;
+    std::vector<unsigned char> m_upload; // premultiplied copy of the canvas
+    AlphaMode                  m_alpha_mode = PREMULTIPLIED_ALPHA;
+    GLuint                     m_texture_id = 0;
+    float                      m_time_left  = 0.0f;
+
+    void upload(const GifFrame &frame);
+
+public:
+    bool load(const char *filepath, AlphaMode alpha_mode = PREMULTIPLIED_ALPHA);
+    void update(float delta_time);
+
+    GLuint get_texture_id() const { return m_texture_id; };
+};
+
+/**
+ * All frames of a short animation packed into one texture, row-major.
+ */
+struct GifAtlas
+{
+    GLuint           texture_id;
+    int              frame_width;
+    int              frame_height;
+    int              columns;
+    int              rows;
+    std::vector<int> delays_ms;
+
+    /**
+     * Texture coordinates of a frame as (u0, v0, u1, v1).
+     */
+    void frame_uvs(int frame, float uvs[4]) const;
+};
+
+/**
+ * Decodes frames one at a time straight into an atlas texture with
+ * glTexSubImage2D; only one canvas is ever held on the CPU. Returns a
+ * texture_id of 0 if the file is unreadable or the atlas would exceed
+ * GL_MAX_TEXTURE_SIZE, in which case use GifPlayer instead.
+ */
+GifAtlas build_gif_atlas(const char *filepath, AlphaMode alpha_mode = PREMULTIPLIED_ALPHA);
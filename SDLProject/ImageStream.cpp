@@ -0,0 +1,1191 @@
+/**
+ * @file ImageStream.cpp
+ * @brief Streaming PNG and baseline JPEG decoders. The PNG path pulls bytes
+ * from a resumable inflater with a 32 KB window and unfilters one scanline
+ * against the previous one; the JPEG path decodes one MCU row at a time.
+ * Neither ever holds more than a row (PNG) or an MCU row (JPEG) of pixels.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#include "ImageStream.h"
+#include "stb_image.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+class ImageDecoder
+{
+public:
+    virtual ~ImageDecoder() {}
+
+    /**
+     * Returns false if the file is not in this decoder's format or uses a
+     * feature that can't be streamed; the caller then falls back to stb_image.
+     */
+    virtual bool read_header(int &width, int &height) = 0;
+    virtual bool read_row(unsigned char *rgba) = 0;
+};
+
+namespace
+{
+    class FileReader
+    {
+    private:
+        std::ifstream m_file;
+        unsigned char m_buffer[1 << 16];
+        size_t        m_size     = 0;
+        size_t        m_position = 0;
+        bool          m_short    = false; // a read ran into the end of the file
+
+        bool refill()
+        {
+            m_file.read((char *) m_buffer, sizeof(m_buffer));
+            m_size     = (size_t) m_file.gcount();
+            m_position = 0;
+            return m_size > 0;
+        }
+
+    public:
+        bool open(const char *filepath)
+        {
+            m_file.open(filepath, std::ios::binary);
+            return (bool) m_file;
+        }
+
+        // -1 at the end of the file
+        int read_byte()
+        {
+            if (m_position == m_size && !refill())
+            {
+                m_short = true;
+                return -1;
+            }
+            return m_buffer[m_position++];
+        }
+
+        size_t read(unsigned char *target, size_t count)
+        {
+            size_t done = 0;
+            while (done < count)
+            {
+                if (m_position == m_size && !refill())
+                {
+                    m_short = true;
+                    break;
+                }
+
+                size_t chunk = std::min(count - done, m_size - m_position);
+                std::memcpy(target + done, m_buffer + m_position, chunk);
+                m_position += chunk;
+                done       += chunk;
+            }
+            return done;
+        }
+
+        uint32_t read_u32_be()
+        {
+            unsigned char bytes[4] = {};
+            read(bytes, 4);
+            return ((uint32_t) bytes[0] << 24) | (bytes[1] << 16) | (bytes[2] << 8) | bytes[3];
+        }
+
+        // -1 at the end of the file
+        int read_u16_be()
+        {
+            int high = read_byte(), low = read_byte();
+            return high < 0 || low < 0 ? -1 : (high << 8) | low;
+        }
+
+        void skip(size_t count)
+        {
+            while (count-- > 0 && read_byte() >= 0) {}
+        }
+
+        // Whether any read so far came up short, the values it returned
+        // being padding rather than data
+        bool is_short() const { return m_short; }
+    };
+
+    // ---------------------------------------------------------------- inflate
+
+    constexpr int INFLATE_FAST_BITS = 9;
+
+    struct InflateHuffman
+    {
+        uint16_t fast[1 << INFLATE_FAST_BITS]; // (symbol << 4) | length, 0 = take the slow path
+        uint16_t count[16];
+        uint16_t symbol[288];
+
+        bool build(const unsigned char *lengths, int symbol_count)
+        {
+            std::memset(count, 0, sizeof(count));
+            std::memset(fast, 0, sizeof(fast));
+            for (int i = 0; i < symbol_count; i++) count[lengths[i]]++;
+            count[0] = 0;
+
+            int left = 1;
+            for (int length = 1; length < 16; length++)
+            {
+                left = (left << 1) - count[length];
+                if (left < 0) return false; // over-subscribed
+            }
+
+            uint16_t offsets[16] = {};
+            for (int length = 1; length < 15; length++) offsets[length + 1] = offsets[length] + count[length];
+
+            int next_code[16] = {}, code = 0;
+            for (int length = 1; length < 16; length++)
+            {
+                code = (code + count[length - 1]) << 1;
+                next_code[length] = code;
+            }
+
+            for (int i = 0; i < symbol_count; i++)
+            {
+                int length = lengths[i];
+                if (length == 0) continue;
+
+                symbol[offsets[length]++] = (uint16_t) i;
+
+                int canonical = next_code[length]++;
+                if (length > INFLATE_FAST_BITS) continue;
+
+                // Codes are stored most significant bit first, but the bit
+                // buffer hands them out least significant bit first
+                int reversed = 0;
+                for (int bit = 0; bit < length; bit++) reversed |= ((canonical >> bit) & 1) << (length - 1 - bit);
+                for (int entry = reversed; entry < (1 << INFLATE_FAST_BITS); entry += 1 << length)
+                    fast[entry] = (uint16_t) ((i << 4) | length);
+            }
+            return true;
+        }
+    };
+
+    const uint16_t LENGTH_BASE[29]  = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                        35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    const uint8_t  LENGTH_EXTRA[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                        3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    const uint16_t DISTANCE_BASE[30]  = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                          257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+                                          8193, 12289, 16385, 24577 };
+    const uint8_t  DISTANCE_EXTRA[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                          7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    /**
+     * zlib stream decoder that can stop after any output byte and resume,
+     * which is what lets the PNG decoder pull exactly one scanline at a time.
+     */
+    class Inflater
+    {
+    public:
+        typedef size_t (*Refill)(void *user, unsigned char *buffer, size_t capacity);
+
+    private:
+        enum State { ZLIB_HEADER, BLOCK_HEADER, STORED, CODES, COPY, DONE, FAILED };
+
+        Refill m_refill = nullptr;
+        void  *m_user   = nullptr;
+
+        unsigned char m_input[1 << 14];
+        size_t        m_input_size     = 0;
+        size_t        m_input_position = 0;
+        int           m_padding_bytes  = 0; // zero bytes invented past the end of input
+
+        uint64_t m_bits      = 0;
+        int      m_bit_count = 0;
+
+        unsigned char m_window[1 << 15];
+        uint64_t      m_total_out = 0;
+
+        State    m_state = ZLIB_HEADER;
+        bool     m_final = false;
+        uint32_t m_stored_left   = 0;
+        int      m_copy_left     = 0;
+        int      m_copy_distance = 0;
+
+        InflateHuffman m_literals, m_distances;
+
+        int next_input_byte()
+        {
+            if (m_input_position == m_input_size)
+            {
+                m_input_size     = m_refill(m_user, m_input, sizeof(m_input));
+                m_input_position = 0;
+                if (m_input_size == 0)
+                {
+                    m_padding_bytes++;
+                    return 0;
+                }
+            }
+            return m_input[m_input_position++];
+        }
+
+        void need(int bit_count)
+        {
+            while (m_bit_count < bit_count)
+            {
+                m_bits      |= (uint64_t) next_input_byte() << m_bit_count;
+                m_bit_count += 8;
+            }
+        }
+
+        int take(int bit_count)
+        {
+            need(bit_count);
+            int value = (int) (m_bits & ((1ull << bit_count) - 1));
+            m_bits      >>= bit_count;
+            m_bit_count  -= bit_count;
+            return value;
+        }
+
+        int decode(const InflateHuffman &huffman)
+        {
+            need(16);
+            uint16_t entry = huffman.fast[m_bits & ((1 << INFLATE_FAST_BITS) - 1)];
+            if (entry != 0)
+            {
+                m_bits      >>= entry & 15;
+                m_bit_count  -= entry & 15;
+                return entry >> 4;
+            }
+
+            int code = 0, first = 0, index = 0;
+            for (int length = 1; length < 16; length++)
+            {
+                code |= (int) (m_bits >> (length - 1)) & 1;
+                int count = huffman.count[length];
+                if (code - count < first)
+                {
+                    m_bits      >>= length;
+                    m_bit_count  -= length;
+                    return huffman.symbol[index + (code - first)];
+                }
+                index += count;
+                first  = (first + count) << 1;
+                code <<= 1;
+            }
+            return -1;
+        }
+
+        bool read_dynamic_tables()
+        {
+            static const uint8_t ORDER[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+            int literal_count  = take(5) + 257,
+                distance_count = take(5) + 1,
+                length_count   = take(4) + 4;
+
+            unsigned char lengths[288 + 32] = {};
+            for (int i = 0; i < length_count; i++) lengths[ORDER[i]] = (unsigned char) take(3);
+
+            InflateHuffman length_codes;
+            if (!length_codes.build(lengths, 19)) return false;
+
+            std::memset(lengths, 0, sizeof(lengths));
+            for (int i = 0; i < literal_count + distance_count;)
+            {
+                int symbol = decode(length_codes), repeat = 0, value = 0;
+                if (symbol < 0) return false;
+
+                if (symbol < 16)
+                {
+                    lengths[i++] = (unsigned char) symbol;
+                    continue;
+                }
+                if (symbol == 16)
+                {
+                    if (i == 0) return false;
+                    value  = lengths[i - 1];
+                    repeat = 3 + take(2);
+                }
+                else if (symbol == 17) repeat = 3 + take(3);
+                else                   repeat = 11 + take(7);
+
+                if (i + repeat > literal_count + distance_count) return false;
+                while (repeat-- > 0) lengths[i++] = (unsigned char) value;
+            }
+
+            return m_literals.build(lengths, literal_count) &&
+                   m_distances.build(lengths + literal_count, distance_count);
+        }
+
+        void use_fixed_tables()
+        {
+            unsigned char lengths[288];
+            std::fill(lengths,       lengths + 144, 8);
+            std::fill(lengths + 144, lengths + 256, 9);
+            std::fill(lengths + 256, lengths + 280, 7);
+            std::fill(lengths + 280, lengths + 288, 8);
+            m_literals.build(lengths, 288);
+
+            std::fill(lengths, lengths + 30, 5);
+            m_distances.build(lengths, 30);
+        }
+
+    public:
+        void reset(Refill refill, void *user)
+        {
+            m_refill = refill;
+            m_user   = user;
+            m_input_size = m_input_position = 0;
+            m_padding_bytes = 0;
+            m_bits = 0;
+            m_bit_count = 0;
+            m_total_out = 0;
+            m_state = ZLIB_HEADER;
+            m_final = false;
+        }
+
+        /**
+         * Produces up to count bytes. Returns fewer only at the end of the
+         * stream or if it is corrupt.
+         */
+        size_t read(unsigned char *out, size_t count)
+        {
+            size_t produced = 0;
+            auto emit = [&](unsigned char byte)
+            {
+                out[produced++] = byte;
+                m_window[m_total_out++ & (sizeof(m_window) - 1)] = byte;
+            };
+
+            while (produced < count)
+            {
+                // Running more than a few bytes past the end of the input
+                // means the stream was truncated
+                if (m_padding_bytes > 8) m_state = FAILED;
+
+                switch (m_state)
+                {
+                    case ZLIB_HEADER:
+                    {
+                        int method = take(8), flags = take(8);
+                        m_state = ((method & 15) != 8 || ((method << 8) | flags) % 31 != 0 || (flags & 0x20))
+                                ? FAILED : BLOCK_HEADER;
+                        break;
+                    }
+
+                    case BLOCK_HEADER:
+                    {
+                        if (m_final) { m_state = DONE; break; }
+
+                        m_final  = take(1) != 0;
+                        int type = take(2);
+
+                        if (type == 0)
+                        {
+                            take(m_bit_count & 7);
+                            int length = take(16), complement = take(16);
+                            if ((length ^ 0xFFFF) != complement) { m_state = FAILED; break; }
+                            m_stored_left = (uint32_t) length;
+                            m_state       = STORED;
+                        }
+                        else if (type == 1) { use_fixed_tables(); m_state = CODES; }
+                        else if (type == 2) m_state = read_dynamic_tables() ? CODES : FAILED;
+                        else                m_state = FAILED;
+                        break;
+                    }
+
+                    case STORED:
+                        while (m_stored_left > 0 && produced < count)
+                        {
+                            emit((unsigned char) take(8));
+                            m_stored_left--;
+                        }
+                        if (m_stored_left == 0) m_state = BLOCK_HEADER;
+                        break;
+
+                    case CODES:
+                        while (produced < count)
+                        {
+                            int symbol = decode(m_literals);
+                            if (symbol < 256)
+                            {
+                                if (symbol < 0) { m_state = FAILED; break; }
+                                emit((unsigned char) symbol);
+                                continue;
+                            }
+                            if (symbol == 256) { m_state = BLOCK_HEADER; break; }
+
+                            symbol -= 257;
+                            if (symbol >= 29) { m_state = FAILED; break; }
+                            m_copy_left = LENGTH_BASE[symbol] + take(LENGTH_EXTRA[symbol]);
+
+                            int distance_symbol = decode(m_distances);
+                            if (distance_symbol < 0 || distance_symbol >= 30) { m_state = FAILED; break; }
+                            m_copy_distance = DISTANCE_BASE[distance_symbol] + take(DISTANCE_EXTRA[distance_symbol]);
+                            m_state = (uint64_t) m_copy_distance > m_total_out ? FAILED : COPY;
+                            break;
+                        }
+                        break;
+
+                    case COPY:
+                        while (m_copy_left > 0 && produced < count)
+                        {
+                            emit(m_window[(m_total_out - m_copy_distance) & (sizeof(m_window) - 1)]);
+                            m_copy_left--;
+                        }
+                        if (m_copy_left == 0) m_state = CODES;
+                        break;
+
+                    case DONE:
+                    case FAILED:
+                        return produced;
+                }
+            }
+            return produced;
+        }
+    };
+
+    // -------------------------------------------------------------------- PNG
+
+    constexpr int PNG_MAX_DIMENSION = 1 << 24; // stb_image's STBI_MAX_DIMENSIONS
+
+    class PngDecoder : public ImageDecoder
+    {
+    private:
+        FileReader m_reader;
+        Inflater   m_inflater;
+        uint32_t   m_idat_left = 0;
+        bool       m_idat_done = false;
+
+        int    m_width = 0, m_height = 0, m_depth = 0, m_colour_type = 0, m_channels = 0;
+        size_t m_row_bytes = 0;
+        int    m_filter_stride = 0;
+
+        unsigned char m_palette[256][4];
+        int           m_transparent_key[3] = { -1, -1, -1 };
+
+        std::vector<unsigned char> m_previous, m_current;
+
+        static size_t refill(void *user, unsigned char *buffer, size_t capacity)
+        {
+            PngDecoder *decoder = (PngDecoder *) user;
+            while (decoder->m_idat_left == 0)
+            {
+                if (decoder->m_idat_done) return 0;
+
+                decoder->m_reader.skip(4); // CRC of the previous chunk
+                uint32_t length = decoder->m_reader.read_u32_be();
+                uint32_t type   = decoder->m_reader.read_u32_be();
+                if (type != 0x49444154) // IDAT
+                {
+                    decoder->m_idat_done = true;
+                    return 0;
+                }
+                decoder->m_idat_left = length;
+            }
+
+            size_t read = decoder->m_reader.read(buffer, std::min<size_t>(capacity, decoder->m_idat_left));
+            decoder->m_idat_left -= (uint32_t) read;
+            if (read == 0) decoder->m_idat_done = true;
+            return read;
+        }
+
+        int sample(const unsigned char *row, int index) const
+        {
+            if (m_depth == 8)  return row[index];
+            if (m_depth == 16) return (row[index * 2] << 8) | row[index * 2 + 1];
+
+            int bit = index * m_depth;
+            return (row[bit >> 3] >> (8 - m_depth - (bit & 7))) & ((1 << m_depth) - 1);
+        }
+
+        int to_8_bit(int value) const
+        {
+            if (m_depth == 16) return value >> 8;
+            if (m_depth == 8)  return value;
+            return value * 255 / ((1 << m_depth) - 1);
+        }
+
+        void unfilter(int filter)
+        {
+            unsigned char       *row   = m_current.data();
+            const unsigned char *above = m_previous.data();
+            const size_t         count = m_row_bytes;
+            const int            left  = m_filter_stride;
+
+            switch (filter)
+            {
+                case 1:
+                    for (size_t i = left; i < count; i++) row[i] += row[i - left];
+                    break;
+                case 2:
+                    for (size_t i = 0; i < count; i++) row[i] += above[i];
+                    break;
+                case 3:
+                    for (size_t i = 0; i < count; i++)
+                        row[i] += (unsigned char) (((i >= (size_t) left ? row[i - left] : 0) + above[i]) >> 1);
+                    break;
+                case 4:
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        int a = i >= (size_t) left ? row[i - left] : 0,
+                            b = above[i],
+                            c = i >= (size_t) left ? above[i - left] : 0;
+                        int p = a + b - c, pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+                        row[i] += (unsigned char) ((pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c));
+                    }
+                    break;
+            }
+        }
+
+    public:
+        bool open(const char *filepath) { return m_reader.open(filepath); }
+
+        bool read_header(int &width, int &height) override
+        {
+            static const unsigned char SIGNATURE[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+            unsigned char signature[8];
+            if (m_reader.read(signature, 8) != 8 || std::memcmp(signature, SIGNATURE, 8) != 0) return false;
+
+            for (int i = 0; i < 256; i++) m_palette[i][0] = m_palette[i][1] = m_palette[i][2] = 0, m_palette[i][3] = 255;
+
+            for (;;)
+            {
+                uint32_t length = m_reader.read_u32_be();
+                uint32_t type   = m_reader.read_u32_be();
+                if (m_reader.is_short()) return false; // cut off before any image data
+
+                if (type == 0x49484452) // IHDR
+                {
+                    m_width  = (int) m_reader.read_u32_be();
+                    m_height = (int) m_reader.read_u32_be();
+                    m_depth       = m_reader.read_byte();
+                    m_colour_type = m_reader.read_byte();
+                    int compression = m_reader.read_byte(), filter = m_reader.read_byte(), interlace = m_reader.read_byte();
+
+                    // Adam7 rows arrive out of order, so let stb_image have those.
+                    // Sizes are capped as stb_image caps them, so a corrupt
+                    // header cannot ask for gigabyte rows.
+                    if (compression != 0 || filter != 0 || interlace != 0 || m_width <= 0 || m_height <= 0 ||
+                        m_width > PNG_MAX_DIMENSION || m_height > PNG_MAX_DIMENSION) return false;
+
+                    static const int CHANNELS[7] = { 1, 0, 3, 1, 2, 0, 4 };
+                    if (m_colour_type < 0 || m_colour_type > 6 || CHANNELS[m_colour_type] == 0) return false;
+                    m_channels = CHANNELS[m_colour_type];
+
+                    // The depths the spec allows: 1, 2, 4 and 8 for greyscale
+                    // and palettes (and 16 for greyscale), 8 and 16 otherwise
+                    bool valid_depth;
+                    switch (m_depth)
+                    {
+                        case 1: case 2: case 4: valid_depth = m_colour_type == 0 || m_colour_type == 3; break;
+                        case 8:                 valid_depth = true;                                     break;
+                        case 16:                valid_depth = m_colour_type != 3;                       break;
+                        default:                valid_depth = false;                                    break;
+                    }
+                    if (!valid_depth) return false;
+                }
+                else if (type == 0x504C5445) // PLTE
+                {
+                    for (uint32_t i = 0; i < length / 3 && i < 256; i++)
+                        for (int c = 0; c < 3; c++) m_palette[i][c] = (unsigned char) m_reader.read_byte();
+                    m_reader.skip(length - std::min<uint32_t>(length / 3, 256) * 3);
+                }
+                else if (type == 0x74524E53) // tRNS
+                {
+                    if (m_colour_type == 3)
+                    {
+                        for (uint32_t i = 0; i < length; i++)
+                        {
+                            int alpha = m_reader.read_byte();
+                            if (i < 256) m_palette[i][3] = (unsigned char) alpha;
+                        }
+                    }
+                    else
+                    {
+                        for (uint32_t i = 0; i < length / 2 && i < 3; i++) m_transparent_key[i] = m_reader.read_u16_be();
+                        m_reader.skip(length - std::min<uint32_t>(length / 2, 3) * 2);
+                    }
+                }
+                else if (type == 0x49444154) // IDAT
+                {
+                    if (m_channels == 0) return false;
+                    m_idat_left = length;
+                    break;
+                }
+                else if (type == 0x49454E44 || length > (1u << 30)) return false; // IEND before any data
+                else m_reader.skip(length);
+
+                m_reader.skip(4); // CRC
+            }
+
+            m_row_bytes     = ((size_t) m_width * m_channels * m_depth + 7) / 8;
+            m_filter_stride = std::max(1, m_channels * m_depth / 8);
+            m_previous.assign(m_row_bytes, 0);
+            m_current.assign(m_row_bytes, 0);
+            m_inflater.reset(&PngDecoder::refill, this);
+
+            width  = m_width;
+            height = m_height;
+            return true;
+        }
+
+        bool read_row(unsigned char *rgba) override
+        {
+            unsigned char filter;
+            m_previous.swap(m_current);
+            if (m_inflater.read(&filter, 1) != 1 || filter > 4 ||
+                m_inflater.read(m_current.data(), m_row_bytes) != m_row_bytes) return false;
+
+            unfilter(filter);
+            const unsigned char *row = m_current.data();
+
+            if (m_depth == 8 && m_colour_type == 6)
+            {
+                std::memcpy(rgba, row, (size_t) m_width * 4);
+                return true;
+            }
+
+            for (int x = 0; x < m_width; x++, rgba += 4)
+            {
+                switch (m_colour_type)
+                {
+                    case 0:
+                    {
+                        int grey = sample(row, x);
+                        rgba[0] = rgba[1] = rgba[2] = (unsigned char) to_8_bit(grey);
+                        rgba[3] = grey == m_transparent_key[0] ? 0 : 255;
+                        break;
+                    }
+                    case 2:
+                    {
+                        int red = sample(row, x * 3), green = sample(row, x * 3 + 1), blue = sample(row, x * 3 + 2);
+                        rgba[0] = (unsigned char) to_8_bit(red);
+                        rgba[1] = (unsigned char) to_8_bit(green);
+                        rgba[2] = (unsigned char) to_8_bit(blue);
+                        rgba[3] = (red == m_transparent_key[0] && green == m_transparent_key[1] &&
+                                   blue == m_transparent_key[2]) ? 0 : 255;
+                        break;
+                    }
+                    case 3:
+                        std::memcpy(rgba, m_palette[sample(row, x)], 4);
+                        break;
+                    case 4:
+                        rgba[0] = rgba[1] = rgba[2] = (unsigned char) to_8_bit(sample(row, x * 2));
+                        rgba[3] = (unsigned char) to_8_bit(sample(row, x * 2 + 1));
+                        break;
+                    case 6:
+                        for (int c = 0; c < 4; c++) rgba[c] = (unsigned char) to_8_bit(sample(row, x * 4 + c));
+                        break;
+                }
+            }
+            return true;
+        }
+    };
+
+    // ------------------------------------------------------------------- JPEG
+
+    const uint8_t JPEG_ZIGZAG[64] = { 0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+                                      12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+                                      35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+                                      58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63 };
+
+    constexpr int JPEG_FAST_BITS = 9;
+
+    struct JpegHuffman
+    {
+        uint16_t fast[1 << JPEG_FAST_BITS]; // (value << 8) | length, 0xFFFF = slow path
+        uint8_t  values[256];
+        int      max_code[18];
+        int      value_offset[17];
+
+        // False if the code lengths ask for more codes than fit, which only
+        // a corrupt DHT segment does
+        bool build(const uint8_t counts[16], const uint8_t *symbols, int symbol_count)
+        {
+            std::memcpy(values, symbols, symbol_count);
+            std::fill(fast, fast + (1 << JPEG_FAST_BITS), 0xFFFF);
+
+            int code = 0, k = 0;
+            for (int length = 1; length <= 16; length++)
+            {
+                value_offset[length] = k - code;
+                for (int i = 0; i < counts[length - 1]; i++, k++, code++)
+                {
+                    if (code >= (1 << length)) return false;
+                    if (length > JPEG_FAST_BITS) continue;
+                    int shift = JPEG_FAST_BITS - length;
+                    for (int entry = code << shift; entry < (code + 1) << shift; entry++)
+                        fast[entry] = (uint16_t) ((values[k] << 8) | length);
+                }
+                max_code[length] = code - 1; // largest code of this length, or below the next one
+                code <<= 1;
+            }
+            max_code[17] = 0x7FFFFFFF;
+            return true;
+        }
+    };
+
+    class JpegDecoder : public ImageDecoder
+    {
+    private:
+        struct Component
+        {
+            int id, h, v, quant, dc_table, ac_table, dc_prediction;
+            int plane_width;
+            std::vector<uint8_t> plane; // one MCU row of this component
+        };
+
+        FileReader  m_reader;
+        Component   m_components[3];
+        int         m_component_count = 0;
+        uint16_t    m_quant[4][64];
+        JpegHuffman m_dc[4], m_ac[4];
+
+        int m_width = 0, m_height = 0;
+        int m_h_max = 1, m_v_max = 1, m_mcu_width = 8, m_mcu_height = 8, m_mcus_x = 0;
+        int m_restart_interval = 0, m_mcus_to_restart = 0;
+
+        uint32_t m_bits = 0;
+        int      m_bit_count = 0;
+        bool     m_hit_marker = false;
+
+        int m_rows_done = 0;      // image rows handed out so far
+        int m_buffer_row = 0;     // next row within the decoded MCU row
+        bool m_failed = false;
+        bool m_rgb    = false;    // components tagged 'R', 'G', 'B' skip the YCbCr transform
+
+        float m_idct_table[8][8];
+
+        void fill_bits()
+        {
+            while (m_bit_count <= 24)
+            {
+                int byte = 0;
+                if (!m_hit_marker)
+                {
+                    byte = m_reader.read_byte();
+                    if (byte == 0xFF)
+                    {
+                        int next = m_reader.read_byte();
+                        while (next == 0xFF) next = m_reader.read_byte();
+                        if (next != 0) { m_hit_marker = true; byte = 0; }
+                    }
+                    else if (byte < 0) { m_hit_marker = true; byte = 0; }
+                }
+                m_bits      |= (uint32_t) byte << (24 - m_bit_count);
+                m_bit_count += 8;
+            }
+        }
+
+        int get_bits(int count)
+        {
+            if (count == 0) return 0;
+            fill_bits();
+            int value = (int) (m_bits >> (32 - count));
+            m_bits      <<= count;
+            m_bit_count  -= count;
+            return value;
+        }
+
+        static int extend(int value, int bits)
+        {
+            return value < (1 << (bits - 1)) ? value - (1 << bits) + 1 : value;
+        }
+
+        int decode(const JpegHuffman &huffman)
+        {
+            fill_bits();
+            uint16_t entry = huffman.fast[m_bits >> (32 - JPEG_FAST_BITS)];
+            if (entry != 0xFFFF)
+            {
+                m_bits      <<= entry & 0xFF;
+                m_bit_count  -= entry & 0xFF;
+                return entry >> 8;
+            }
+
+            for (int length = JPEG_FAST_BITS + 1; length <= 16; length++)
+            {
+                int code = (int) (m_bits >> (32 - length));
+                if (code <= huffman.max_code[length])
+                {
+                    m_bits      <<= length;
+                    m_bit_count  -= length;
+                    return huffman.values[(code + huffman.value_offset[length]) & 0xFF];
+                }
+            }
+            m_failed = true;
+            return 0;
+        }
+
+        void idct(const float coefficients[64], uint8_t *target, int stride)
+        {
+            float temporary[64];
+            for (int v = 0; v < 8; v++)
+                for (int x = 0; x < 8; x++)
+                {
+                    float sum = 0.0f;
+                    for (int u = 0; u < 8; u++) sum += m_idct_table[x][u] * coefficients[v * 8 + u];
+                    temporary[v * 8 + x] = sum;
+                }
+
+            for (int y = 0; y < 8; y++)
+                for (int x = 0; x < 8; x++)
+                {
+                    float sum = 128.0f;
+                    for (int v = 0; v < 8; v++) sum += m_idct_table[y][v] * temporary[v * 8 + x];
+                    target[y * stride + x] = (uint8_t) std::min(std::max((int) std::lround(sum), 0), 255);
+                }
+        }
+
+        void decode_block(Component &component, uint8_t *target, int stride)
+        {
+            float coefficients[64] = {};
+            const uint16_t *quant = m_quant[component.quant];
+
+            // Baseline magnitudes take at most 11 bits for DC and 10 for AC;
+            // anything longer comes from a corrupt table
+            int size = decode(m_dc[component.dc_table]);
+            if (size > 11)
+            {
+                m_failed = true;
+                return;
+            }
+            component.dc_prediction += size ? extend(get_bits(size), size) : 0;
+            coefficients[0] = (float) (component.dc_prediction * quant[0]);
+
+            for (int k = 1; k < 64; k++)
+            {
+                int run_size = decode(m_ac[component.ac_table]);
+                int run = run_size >> 4, bits = run_size & 15;
+                if (bits == 0)
+                {
+                    if (run != 15) break; // end of block
+                    k += 15;
+                    continue;
+                }
+                k += run;
+                if (k > 63 || bits > 10) { m_failed = true; break; }
+                coefficients[JPEG_ZIGZAG[k]] = (float) (extend(get_bits(bits), bits) * quant[k]);
+            }
+
+            idct(coefficients, target, stride);
+        }
+
+        void handle_restart()
+        {
+            // Drop the bit buffer and find the RSTn marker
+            m_bits = 0;
+            m_bit_count = 0;
+            if (!m_hit_marker)
+            {
+                int byte;
+                do byte = m_reader.read_byte(); while (byte >= 0 && byte != 0xFF);
+                do byte = m_reader.read_byte(); while (byte == 0xFF);
+            }
+            m_hit_marker = false;
+            for (int i = 0; i < m_component_count; i++) m_components[i].dc_prediction = 0;
+            m_mcus_to_restart = m_restart_interval;
+        }
+
+        void decode_mcu_row()
+        {
+            for (int mcu_x = 0; mcu_x < m_mcus_x && !m_failed; mcu_x++)
+            {
+                if (m_restart_interval)
+                {
+                    if (m_mcus_to_restart == 0) handle_restart();
+                    m_mcus_to_restart--;
+                }
+
+                for (int i = 0; i < m_component_count; i++)
+                {
+                    Component &component = m_components[i];
+                    for (int block_y = 0; block_y < component.v; block_y++)
+                        for (int block_x = 0; block_x < component.h; block_x++)
+                            decode_block(component, &component.plane[(size_t) block_y * 8 * component.plane_width +
+                                                                     (mcu_x * component.h + block_x) * 8],
+                                         component.plane_width);
+                }
+            }
+        }
+
+        bool read_quant_tables(int length)
+        {
+            while (length > 0)
+            {
+                int info = m_reader.read_byte(), precision = info >> 4, table = info & 3;
+                for (int i = 0; i < 64; i++)
+                    m_quant[table][i] = (uint16_t) (precision ? m_reader.read_u16_be() : m_reader.read_byte());
+                length -= 1 + 64 * (precision ? 2 : 1);
+            }
+            return length == 0;
+        }
+
+        bool read_huffman_tables(int length)
+        {
+            while (length > 0)
+            {
+                int info = m_reader.read_byte(), table_class = info >> 4, table = info & 3;
+                uint8_t counts[16], symbols[256];
+                int total = 0;
+                for (int i = 0; i < 16; i++) total += counts[i] = (uint8_t) m_reader.read_byte();
+                if (total > 256) return false;
+                for (int i = 0; i < total; i++) symbols[i] = (uint8_t) m_reader.read_byte();
+
+                if (!(table_class ? m_ac : m_dc)[table].build(counts, symbols, total)) return false;
+                length -= 17 + total;
+            }
+            return length == 0;
+        }
+
+    public:
+        bool open(const char *filepath) { return m_reader.open(filepath); }
+
+        bool read_header(int &width, int &height) override
+        {
+            if (m_reader.read_byte() != 0xFF || m_reader.read_byte() != 0xD8) return false;
+
+            for (;;)
+            {
+                int byte = m_reader.read_byte();
+                if (byte != 0xFF) return false;
+                int marker = m_reader.read_byte();
+                while (marker == 0xFF) marker = m_reader.read_byte();
+                if (marker < 0 || marker == 0xD9) return false;
+
+                int length = m_reader.read_u16_be() - 2;
+                if (length < 0) return false; // cut off, or a corrupt length
+
+                if (marker == 0xC0 || marker == 0xC1)
+                {
+                    if (m_reader.read_byte() != 8) return false;
+                    m_height = m_reader.read_u16_be();
+                    m_width  = m_reader.read_u16_be();
+                    m_component_count = m_reader.read_byte();
+
+                    // DNL-sized images and CMYK go through stb_image
+                    if (m_height == 0 || m_width == 0 || (m_component_count != 1 && m_component_count != 3)) return false;
+
+                    for (int i = 0; i < m_component_count; i++)
+                    {
+                        Component &component = m_components[i];
+                        component.id = m_reader.read_byte();
+                        int sampling = m_reader.read_byte();
+                        component.h     = m_component_count == 1 ? 1 : sampling >> 4;
+                        component.v     = m_component_count == 1 ? 1 : sampling & 15;
+                        component.quant = m_reader.read_byte() & 3;
+                        if (component.h < 1 || component.h > 4 || component.v < 1 || component.v > 4) return false;
+                    }
+                }
+                else if (marker >= 0xC2 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC)
+                {
+                    return false; // progressive, lossless or arithmetic coded
+                }
+                else if (marker == 0xC4) { if (!read_huffman_tables(length)) return false; }
+                else if (marker == 0xDB) { if (!read_quant_tables(length)) return false; }
+                else if (marker == 0xDD)
+                {
+                    m_restart_interval = m_reader.read_u16_be();
+                    m_reader.skip(length - 2);
+                }
+                else if (marker == 0xDA)
+                {
+                    int scan_count = m_reader.read_byte();
+                    // Baseline files can split components over several scans;
+                    // only the usual single interleaved scan is streamed
+                    if (m_component_count == 0 || scan_count != m_component_count) return false;
+
+                    for (int i = 0; i < scan_count; i++)
+                    {
+                        int id = m_reader.read_byte(), tables = m_reader.read_byte();
+                        bool found = false;
+                        for (int c = 0; c < m_component_count; c++)
+                        {
+                            if (m_components[c].id != id) continue;
+                            m_components[c].dc_table = (tables >> 4) & 3;
+                            m_components[c].ac_table = tables & 3;
+                            found = true;
+                        }
+                        if (!found) return false;
+                    }
+                    m_reader.skip(3); // spectral selection and approximation, fixed for baseline
+                    if (m_reader.is_short()) return false;
+                    break;
+                }
+                else m_reader.skip(length);
+            }
+
+            for (int i = 0; i < m_component_count; i++)
+            {
+                m_h_max = std::max(m_h_max, m_components[i].h);
+                m_v_max = std::max(m_v_max, m_components[i].v);
+            }
+            m_mcu_width  = 8 * m_h_max;
+            m_mcu_height = 8 * m_v_max;
+            m_mcus_x     = (m_width + m_mcu_width - 1) / m_mcu_width;
+
+            for (int i = 0; i < m_component_count; i++)
+            {
+                Component &component = m_components[i];
+                component.plane_width   = m_mcus_x * component.h * 8;
+                component.dc_prediction = 0;
+                component.plane.assign((size_t) component.plane_width * component.v * 8, 0);
+            }
+
+            for (int x = 0; x < 8; x++)
+                for (int u = 0; u < 8; u++)
+                    m_idct_table[x][u] = (u == 0 ? std::sqrt(0.5f) : 1.0f) * 0.5f *
+                                         std::cos((2 * x + 1) * u * 3.14159265358979f / 16.0f);
+
+            m_rgb = m_component_count == 3 && m_components[0].id == 'R' &&
+                    m_components[1].id == 'G' && m_components[2].id == 'B';
+
+            m_mcus_to_restart = m_restart_interval;
+            m_buffer_row      = m_mcu_height; // forces a decode on the first read_row
+
+            width  = m_width;
+            height = m_height;
+            return true;
+        }
+
+        bool read_row(unsigned char *rgba) override
+        {
+            if (m_buffer_row == m_mcu_height)
+            {
+                decode_mcu_row();
+                m_buffer_row = 0;
+            }
+            if (m_failed) return false;
+
+            // Chroma is upsampled by replication
+            const int y = m_buffer_row++;
+            const Component &luma = m_components[0];
+            const uint8_t   *luma_row = &luma.plane[(size_t) (y * luma.v / m_v_max) * luma.plane_width];
+
+            if (m_component_count == 1)
+            {
+                for (int x = 0; x < m_width; x++, rgba += 4)
+                {
+                    rgba[0] = rgba[1] = rgba[2] = luma_row[x];
+                    rgba[3] = 255;
+                }
+            }
+            else
+            {
+                const Component &cb = m_components[1], &cr = m_components[2];
+                const uint8_t *cb_row = &cb.plane[(size_t) (y * cb.v / m_v_max) * cb.plane_width],
+                              *cr_row = &cr.plane[(size_t) (y * cr.v / m_v_max) * cr.plane_width];
+
+                for (int x = 0; x < m_width && m_rgb; x++, rgba += 4)
+                {
+                    rgba[0] = luma_row[x * luma.h / m_h_max];
+                    rgba[1] = cb_row[x * cb.h / m_h_max];
+                    rgba[2] = cr_row[x * cr.h / m_h_max];
+                    rgba[3] = 255;
+                }
+                for (int x = 0; x < m_width && !m_rgb; x++, rgba += 4)
+                {
+                    int luminance = luma_row[x * luma.h / m_h_max] << 16;
+                    int blue_diff = cb_row[x * cb.h / m_h_max] - 128,
+                        red_diff  = cr_row[x * cr.h / m_h_max] - 128;
+
+                    // JFIF YCbCr -> RGB in 16.16 fixed point
+                    int red   = (luminance + 91881 * red_diff + 32768) >> 16,
+                        green = (luminance - 22554 * blue_diff - 46802 * red_diff + 32768) >> 16,
+                        blue  = (luminance + 116130 * blue_diff + 32768) >> 16;
+
+                    rgba[0] = (unsigned char) std::min(std::max(red, 0), 255);
+                    rgba[1] = (unsigned char) std::min(std::max(green, 0), 255);
+                    rgba[2] = (unsigned char) std::min(std::max(blue, 0), 255);
+                    rgba[3] = 255;
+                }
+            }
+
+            m_rows_done++;
+            return true;
+        }
+    };
+}
+
+ImageStream::ImageStream() {}
+
+ImageStream::~ImageStream()
+{
+    close();
+}
+
+void ImageStream::close()
+{
+    m_decoder.reset();
+    if (m_whole_image) stbi_image_free(m_whole_image);
+    m_whole_image = nullptr;
+    m_width = m_height = m_rows_read = 0;
+    m_streaming = false;
+}
+
+bool ImageStream::open(const char *filepath)
+{
+    close();
+
+    {
+        std::unique_ptr<PngDecoder> png(new PngDecoder());
+        if (png->open(filepath) && png->read_header(m_width, m_height)) m_decoder = std::move(png);
+    }
+    if (!m_decoder)
+    {
+        std::unique_ptr<JpegDecoder> jpeg(new JpegDecoder());
+        if (jpeg->open(filepath) && jpeg->read_header(m_width, m_height)) m_decoder = std::move(jpeg);
+    }
+
+    if (m_decoder)
+    {
+        m_streaming = true;
+        return true;
+    }
+
+    int number_of_components;
+    m_whole_image = stbi_load(filepath, &m_width, &m_height, &number_of_components, STBI_rgb_alpha);
+    return m_whole_image != nullptr;
+}
+
+int ImageStream::read_rows(unsigned char *rgba, int max_rows)
+{
+    int rows = std::min(max_rows, m_height - m_rows_read);
+    if (rows <= 0) return 0;
+
+    if (m_whole_image)
+    {
+        std::memcpy(rgba, m_whole_image + (size_t) m_rows_read * m_width * 4, (size_t) rows * m_width * 4);
+        m_rows_read += rows;
+        return rows;
+    }
+
+    for (int row = 0; row < rows; row++)
+    {
+        if (!m_decoder->read_row(rgba + (size_t) row * m_width * 4))
+        {
+            m_rows_read = m_height; // don't try to carry on after corrupt data
+            return row;
+        }
+    }
+
+    m_rows_read += rows;
+    return rows;
+}
+
+bool stream_image(const char *filepath, int band_rows, const BandCallback &on_band,
+                  const std::function<void(int width, int height)> &on_size)
+{
+    ImageStream stream;
+    if (!stream.open(filepath)) return false;
+    if (on_size) on_size(stream.get_width(), stream.get_height());
+
+    std::vector<unsigned char> band((size_t) band_rows * stream.get_width() * 4);
+    while (stream.rows_read() < stream.get_height())
+    {
+        int first_row = stream.rows_read();
+        int rows      = stream.read_rows(band.data(), band_rows);
+        if (rows == 0) return false;
+
+        on_band(band.data(), first_row, rows);
+        if (stream.rows_read() < first_row + band_rows && stream.rows_read() < stream.get_height()) return false;
+    }
+    return true;
+}
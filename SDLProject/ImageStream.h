@@ -0,0 +1,69 @@
+/**
+ * @file ImageStream.h
+ * @brief Row-streaming image decoding. Non-interlaced PNG and baseline JPEG
+ * are decoded a few scanlines at a time, so peak memory depends on the image
+ * width and band height rather than on the full image size.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+class ImageDecoder; // format-specific state, see ImageStream.cpp
+
+class ImageStream
+{
+private:
+    std::unique_ptr<ImageDecoder> m_decoder;
+    int  m_width      = 0;
+    int  m_height     = 0;
+    int  m_rows_read  = 0;
+    bool m_streaming  = false;
+
+    // Only used when the file has to be decoded in one go (see open())
+    unsigned char *m_whole_image = nullptr;
+
+public:
+    ImageStream();
+    ~ImageStream();
+
+    ImageStream(const ImageStream &) = delete;
+    ImageStream &operator=(const ImageStream &) = delete;
+
+    /**
+     * Reads the header. Non-interlaced PNG and baseline JPEG are streamed;
+     * anything else (progressive JPEG, Adam7 PNG, other formats) falls back
+     * to a full stb_image decode, and is_streaming() reports false.
+     */
+    bool open(const char *filepath);
+
+    /**
+     * Decodes up to max_rows further scanlines as RGBA8 into rgba (which
+     * must hold max_rows * width * 4 bytes). Returns the number of rows
+     * written; 0 at the end of the image or on a decode error.
+     */
+    int read_rows(unsigned char *rgba, int max_rows);
+
+    void close();
+
+    int  get_width()    const { return m_width;     };
+    int  get_height()   const { return m_height;    };
+    int  rows_read()    const { return m_rows_read; };
+    bool is_streaming() const { return m_streaming; };
+};
+
+typedef std::function<void(const unsigned char *rgba, int first_row, int row_count)> BandCallback;
+
+/**
+ * Decodes the file band by band, calling on_band for each band of up to
+ * band_rows scanlines. on_size, if set, is called with the dimensions before
+ * the first band so the receiver can allocate. Returns false if the file
+ * can't be opened or is truncated.
+ */
+bool stream_image(const char *filepath, int band_rows, const BandCallback &on_band,
+                  const std::function<void(int width, int height)> &on_size = nullptr);
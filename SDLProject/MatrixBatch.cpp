@@ -0,0 +1,641 @@
+/**
+ * @file MatrixBatch.cpp
+ * @brief Batch matrix kernels, one set per instruction set, and the runtime
+ * dispatch between them. The wide kernels are compiled with per-function
+ * target attributes so the rest of the program keeps the baseline flags and
+ * still runs on machines without AVX.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#include "MatrixBatch.h"
+#include "glm/glm.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define MATRIX_BATCH_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define MATRIX_BATCH_TARGET_AVX2
+        #define MATRIX_BATCH_TARGET_AVX512
+    #else
+        #include <cpuid.h>
+        #define MATRIX_BATCH_TARGET_AVX2   __attribute__((target("avx2,fma")))
+        #define MATRIX_BATCH_TARGET_AVX512 __attribute__((target("avx512f")))
+    #endif
+#endif
+
+static_assert(sizeof(glm::mat4) == 16 * sizeof(float), "batch kernels expect tightly packed matrices");
+static_assert(sizeof(glm::vec3) == 3 * sizeof(float), "batch kernels expect tightly packed points");
+
+namespace
+{
+    // a is advanced by a_stride floats per matrix: 16, or 0 for one parent
+    typedef void (*MultiplyKernel)(const float *a, size_t a_stride, const float *b, float *out, size_t count);
+    typedef void (*InvertKernel)(const float *m, float *out, size_t count);
+    typedef void (*TransformKernel)(const float *m, const float *in, float *out, size_t count, float w);
+
+    struct Kernels
+    {
+        MultiplyKernel  multiply;
+        InvertKernel    invert;
+        TransformKernel transform;
+    };
+
+    /* ---------------------------- Plain glm ---------------------------- */
+
+    void multiply_scalar(const float *a, size_t a_stride, const float *b, float *out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++, a += a_stride, b += 16, out += 16)
+        {
+            glm::mat4 left, right;
+            std::memcpy(&left[0][0], a, sizeof(left));
+            std::memcpy(&right[0][0], b, sizeof(right));
+            glm::mat4 product = left * right;
+            std::memcpy(out, &product[0][0], sizeof(product));
+        }
+    }
+
+    void invert_scalar(const float *m, float *out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++, m += 16, out += 16)
+        {
+            glm::mat4 matrix;
+            std::memcpy(&matrix[0][0], m, sizeof(matrix));
+            matrix = glm::inverse(matrix);
+            std::memcpy(out, &matrix[0][0], sizeof(matrix));
+        }
+    }
+
+    void transform_scalar(const float *m, const float *in, float *out, size_t count, float w)
+    {
+        glm::mat4 matrix;
+        std::memcpy(&matrix[0][0], m, sizeof(matrix));
+        for (size_t i = 0; i < count; i++, in += 3, out += 3)
+        {
+            glm::vec4 result = matrix * glm::vec4(in[0], in[1], in[2], w);
+            out[0] = result.x;
+            out[1] = result.y;
+            out[2] = result.z;
+        }
+    }
+
+    const Kernels SCALAR_KERNELS = { multiply_scalar, invert_scalar, transform_scalar };
+
+#ifdef MATRIX_BATCH_X86
+    const float IDENTITY[16] = { 1, 0, 0, 0,  0, 1, 0, 0,  0, 0, 1, 0,  0, 0, 0, 1 };
+
+    // Runs a group kernel that inverts exactly group_size matrices over the
+    // array, padding the last partial group with identities.
+    template <size_t group_size, typename GroupKernel>
+    void invert_in_groups(const float *m, float *out, size_t count, GroupKernel invert_group)
+    {
+        size_t i = 0;
+        for (; i + group_size <= count; i += group_size) invert_group(m + 16 * i, out + 16 * i);
+        if (i == count) return;
+
+        float padded_in[16 * group_size], padded_out[16 * group_size];
+        for (size_t j = 0; j < group_size; j++) std::memcpy(padded_in + 16 * j, IDENTITY, sizeof(IDENTITY));
+        std::memcpy(padded_in, m + 16 * i, (count - i) * 16 * sizeof(float));
+        invert_group(padded_in, padded_out);
+        std::memcpy(out + 16 * i, padded_out, (count - i) * 16 * sizeof(float));
+    }
+
+    /* ------------------------------- SSE2 ------------------------------ */
+
+    /*
+     * The inverse works on structure-of-arrays lanes: a[4 * column + row]
+     * holds that element of 4, 8 or 16 matrices. It is the 2x2 sub-determinant
+     * (Laplace) expansion, spelled out per instruction set because a shared
+     * template would be compiled without the target attribute.
+     */
+
+    inline __m128 msub(__m128 a, __m128 b, __m128 c, __m128 d)
+    {
+        return _mm_sub_ps(_mm_mul_ps(a, b), _mm_mul_ps(c, d));
+    }
+
+    // x*p - y*q + z*r
+    inline __m128 cofactor(__m128 x, __m128 p, __m128 y, __m128 q, __m128 z, __m128 r)
+    {
+        return _mm_add_ps(msub(x, p, y, q), _mm_mul_ps(z, r));
+    }
+
+    inline void invert_lanes(const __m128 a[16], __m128 b[16])
+    {
+        __m128 s0 = msub(a[0], a[5], a[4], a[1]),    s1 = msub(a[0], a[6], a[4], a[2]),
+               s2 = msub(a[0], a[7], a[4], a[3]),    s3 = msub(a[1], a[6], a[5], a[2]),
+               s4 = msub(a[1], a[7], a[5], a[3]),    s5 = msub(a[2], a[7], a[6], a[3]);
+        __m128 c0 = msub(a[8], a[13], a[12], a[9]),  c1 = msub(a[8], a[14], a[12], a[10]),
+               c2 = msub(a[8], a[15], a[12], a[11]), c3 = msub(a[9], a[14], a[13], a[10]),
+               c4 = msub(a[9], a[15], a[13], a[11]), c5 = msub(a[10], a[15], a[14], a[11]);
+
+        __m128 det = _mm_add_ps(cofactor(s0, c5, s1, c4, s2, c3), cofactor(s3, c2, s4, c1, s5, c0));
+        __m128 inv = _mm_div_ps(_mm_set1_ps(1.0f), det);
+        __m128 neg = _mm_sub_ps(_mm_setzero_ps(), inv);
+
+        b[0]  = _mm_mul_ps(cofactor(a[5],  c5, a[6],  c4, a[7],  c3), inv);
+        b[1]  = _mm_mul_ps(cofactor(a[1],  c5, a[2],  c4, a[3],  c3), neg);
+        b[2]  = _mm_mul_ps(cofactor(a[13], s5, a[14], s4, a[15], s3), inv);
+        b[3]  = _mm_mul_ps(cofactor(a[9],  s5, a[10], s4, a[11], s3), neg);
+        b[4]  = _mm_mul_ps(cofactor(a[4],  c5, a[6],  c2, a[7],  c1), neg);
+        b[5]  = _mm_mul_ps(cofactor(a[0],  c5, a[2],  c2, a[3],  c1), inv);
+        b[6]  = _mm_mul_ps(cofactor(a[12], s5, a[14], s2, a[15], s1), neg);
+        b[7]  = _mm_mul_ps(cofactor(a[8],  s5, a[10], s2, a[11], s1), inv);
+        b[8]  = _mm_mul_ps(cofactor(a[4],  c4, a[5],  c2, a[7],  c0), inv);
+        b[9]  = _mm_mul_ps(cofactor(a[0],  c4, a[1],  c2, a[3],  c0), neg);
+        b[10] = _mm_mul_ps(cofactor(a[12], s4, a[13], s2, a[15], s0), inv);
+        b[11] = _mm_mul_ps(cofactor(a[8],  s4, a[9],  s2, a[11], s0), neg);
+        b[12] = _mm_mul_ps(cofactor(a[4],  c3, a[5],  c1, a[6],  c0), neg);
+        b[13] = _mm_mul_ps(cofactor(a[0],  c3, a[1],  c1, a[2],  c0), inv);
+        b[14] = _mm_mul_ps(cofactor(a[12], s3, a[13], s1, a[14], s0), neg);
+        b[15] = _mm_mul_ps(cofactor(a[8],  s3, a[9],  s1, a[10], s0), inv);
+    }
+
+    // column[0] * v.x + column[1] * v.y + column[2] * v.z + column[3] * v.w
+    inline __m128 combine_columns(__m128 c0, __m128 c1, __m128 c2, __m128 c3, __m128 v)
+    {
+        __m128 sum = _mm_mul_ps(c0, _mm_shuffle_ps(v, v, 0x00));
+        sum = _mm_add_ps(sum, _mm_mul_ps(c1, _mm_shuffle_ps(v, v, 0x55)));
+        sum = _mm_add_ps(sum, _mm_mul_ps(c2, _mm_shuffle_ps(v, v, 0xAA)));
+        return _mm_add_ps(sum, _mm_mul_ps(c3, _mm_shuffle_ps(v, v, 0xFF)));
+    }
+
+    void multiply_sse2(const float *a, size_t a_stride, const float *b, float *out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++, a += a_stride, b += 16, out += 16)
+        {
+            __m128 a0 = _mm_loadu_ps(a),     a1 = _mm_loadu_ps(a + 4),
+                   a2 = _mm_loadu_ps(a + 8), a3 = _mm_loadu_ps(a + 12);
+            __m128 b0 = _mm_loadu_ps(b),     b1 = _mm_loadu_ps(b + 4),
+                   b2 = _mm_loadu_ps(b + 8), b3 = _mm_loadu_ps(b + 12);
+
+            _mm_storeu_ps(out,      combine_columns(a0, a1, a2, a3, b0));
+            _mm_storeu_ps(out + 4,  combine_columns(a0, a1, a2, a3, b1));
+            _mm_storeu_ps(out + 8,  combine_columns(a0, a1, a2, a3, b2));
+            _mm_storeu_ps(out + 12, combine_columns(a0, a1, a2, a3, b3));
+        }
+    }
+
+    void invert_group_sse2(const float *m, float *out)
+    {
+        __m128 a[16], b[16];
+        for (int column = 0; column < 4; column++)
+        {
+            __m128 r0 = _mm_loadu_ps(m + 4 * column),      r1 = _mm_loadu_ps(m + 16 + 4 * column),
+                   r2 = _mm_loadu_ps(m + 32 + 4 * column), r3 = _mm_loadu_ps(m + 48 + 4 * column);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            a[4 * column] = r0; a[4 * column + 1] = r1; a[4 * column + 2] = r2; a[4 * column + 3] = r3;
+        }
+
+        invert_lanes(a, b);
+
+        for (int column = 0; column < 4; column++)
+        {
+            __m128 r0 = b[4 * column], r1 = b[4 * column + 1], r2 = b[4 * column + 2], r3 = b[4 * column + 3];
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_storeu_ps(out + 4 * column,      r0);
+            _mm_storeu_ps(out + 16 + 4 * column, r1);
+            _mm_storeu_ps(out + 32 + 4 * column, r2);
+            _mm_storeu_ps(out + 48 + 4 * column, r3);
+        }
+    }
+
+    void invert_sse2(const float *m, float *out, size_t count)
+    {
+        invert_in_groups<4>(m, out, count, invert_group_sse2);
+    }
+
+    void transform_sse2(const float *m, const float *in, float *out, size_t count, float w)
+    {
+        __m128 c0 = _mm_loadu_ps(m), c1 = _mm_loadu_ps(m + 4), c2 = _mm_loadu_ps(m + 8);
+        __m128 translation = _mm_mul_ps(_mm_loadu_ps(m + 12), _mm_set1_ps(w));
+
+        for (size_t i = 0; i < count; i++, in += 3, out += 3)
+        {
+            __m128 result = _mm_add_ps(translation, _mm_mul_ps(c0, _mm_set1_ps(in[0])));
+            result = _mm_add_ps(result, _mm_mul_ps(c1, _mm_set1_ps(in[1])));
+            result = _mm_add_ps(result, _mm_mul_ps(c2, _mm_set1_ps(in[2])));
+
+            _mm_storel_pi(reinterpret_cast<__m64 *>(out), result);
+            _mm_store_ss(out + 2, _mm_movehl_ps(result, result));
+        }
+    }
+
+    const Kernels SSE2_KERNELS = { multiply_sse2, invert_sse2, transform_sse2 };
+
+    /* ---------------------------- AVX2 + FMA --------------------------- */
+
+    MATRIX_BATCH_TARGET_AVX2 inline __m256 msub(__m256 a, __m256 b, __m256 c, __m256 d)
+    {
+        return _mm256_fmsub_ps(a, b, _mm256_mul_ps(c, d));
+    }
+
+    MATRIX_BATCH_TARGET_AVX2 inline __m256 cofactor(__m256 x, __m256 p, __m256 y, __m256 q, __m256 z, __m256 r)
+    {
+        return _mm256_fmadd_ps(z, r, msub(x, p, y, q));
+    }
+
+    MATRIX_BATCH_TARGET_AVX2 inline void invert_lanes(const __m256 a[16], __m256 b[16])
+    {
+        __m256 s0 = msub(a[0], a[5], a[4], a[1]),    s1 = msub(a[0], a[6], a[4], a[2]),
+               s2 = msub(a[0], a[7], a[4], a[3]),    s3 = msub(a[1], a[6], a[5], a[2]),
+               s4 = msub(a[1], a[7], a[5], a[3]),    s5 = msub(a[2], a[7], a[6], a[3]);
+        __m256 c0 = msub(a[8], a[13], a[12], a[9]),  c1 = msub(a[8], a[14], a[12], a[10]),
+               c2 = msub(a[8], a[15], a[12], a[11]), c3 = msub(a[9], a[14], a[13], a[10]),
+               c4 = msub(a[9], a[15], a[13], a[11]), c5 = msub(a[10], a[15], a[14], a[11]);
+
+        __m256 det = _mm256_add_ps(cofactor(s0, c5, s1, c4, s2, c3), cofactor(s3, c2, s4, c1, s5, c0));
+        __m256 inv = _mm256_div_ps(_mm256_set1_ps(1.0f), det);
+        __m256 neg = _mm256_sub_ps(_mm256_setzero_ps(), inv);
+
+        b[0]  = _mm256_mul_ps(cofactor(a[5],  c5, a[6],  c4, a[7],  c3), inv);
+        b[1]  = _mm256_mul_ps(cofactor(a[1],  c5, a[2],  c4, a[3],  c3), neg);
+        b[2]  = _mm256_mul_ps(cofactor(a[13], s5, a[14], s4, a[15], s3), inv);
+        b[3]  = _mm256_mul_ps(cofactor(a[9],  s5, a[10], s4, a[11], s3), neg);
+        b[4]  = _mm256_mul_ps(cofactor(a[4],  c5, a[6],  c2, a[7],  c1), neg);
+        b[5]  = _mm256_mul_ps(cofactor(a[0],  c5, a[2],  c2, a[3],  c1), inv);
+        b[6]  = _mm256_mul_ps(cofactor(a[12], s5, a[14], s2, a[15], s1), neg);
+        b[7]  = _mm256_mul_ps(cofactor(a[8],  s5, a[10], s2, a[11], s1), inv);
+        b[8]  = _mm256_mul_ps(cofactor(a[4],  c4, a[5],  c2, a[7],  c0), inv);
+        b[9]  = _mm256_mul_ps(cofactor(a[0],  c4, a[1],  c2, a[3],  c0), neg);
+        b[10] = _mm256_mul_ps(cofactor(a[12], s4, a[13], s2, a[15], s0), inv);
+        b[11] = _mm256_mul_ps(cofactor(a[8],  s4, a[9],  s2, a[11], s0), neg);
+        b[12] = _mm256_mul_ps(cofactor(a[4],  c3, a[5],  c1, a[6],  c0), neg);
+        b[13] = _mm256_mul_ps(cofactor(a[0],  c3, a[1],  c1, a[2],  c0), inv);
+        b[14] = _mm256_mul_ps(cofactor(a[12], s3, a[13], s1, a[14], s0), neg);
+        b[15] = _mm256_mul_ps(cofactor(a[8],  s3, a[9],  s1, a[10], s0), inv);
+    }
+
+    // In place: row i of the 8x8 block becomes column i
+    MATRIX_BATCH_TARGET_AVX2 inline void transpose8(__m256 r[8])
+    {
+        __m256 t0 = _mm256_unpacklo_ps(r[0], r[1]), t1 = _mm256_unpackhi_ps(r[0], r[1]),
+               t2 = _mm256_unpacklo_ps(r[2], r[3]), t3 = _mm256_unpackhi_ps(r[2], r[3]),
+               t4 = _mm256_unpacklo_ps(r[4], r[5]), t5 = _mm256_unpackhi_ps(r[4], r[5]),
+               t6 = _mm256_unpacklo_ps(r[6], r[7]), t7 = _mm256_unpackhi_ps(r[6], r[7]);
+        __m256 u0 = _mm256_shuffle_ps(t0, t2, 0x44), u1 = _mm256_shuffle_ps(t0, t2, 0xEE),
+               u2 = _mm256_shuffle_ps(t1, t3, 0x44), u3 = _mm256_shuffle_ps(t1, t3, 0xEE),
+               u4 = _mm256_shuffle_ps(t4, t6, 0x44), u5 = _mm256_shuffle_ps(t4, t6, 0xEE),
+               u6 = _mm256_shuffle_ps(t5, t7, 0x44), u7 = _mm256_shuffle_ps(t5, t7, 0xEE);
+        r[0] = _mm256_permute2f128_ps(u0, u4, 0x20);
+        r[1] = _mm256_permute2f128_ps(u1, u5, 0x20);
+        r[2] = _mm256_permute2f128_ps(u2, u6, 0x20);
+        r[3] = _mm256_permute2f128_ps(u3, u7, 0x20);
+        r[4] = _mm256_permute2f128_ps(u0, u4, 0x31);
+        r[5] = _mm256_permute2f128_ps(u1, u5, 0x31);
+        r[6] = _mm256_permute2f128_ps(u2, u6, 0x31);
+        r[7] = _mm256_permute2f128_ps(u3, u7, 0x31);
+    }
+
+    // Two columns of b per register, each multiplied by the same four columns of a
+    MATRIX_BATCH_TARGET_AVX2 void multiply_avx2(const float *a, size_t a_stride, const float *b, float *out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++, a += a_stride, b += 16, out += 16)
+        {
+            __m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(a)),
+                   a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(a + 4)),
+                   a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(a + 8)),
+                   a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(a + 12));
+            __m256 b01 = _mm256_loadu_ps(b), b23 = _mm256_loadu_ps(b + 8);
+
+            __m256 o01 = _mm256_mul_ps(a0, _mm256_permute_ps(b01, 0x00));
+            __m256 o23 = _mm256_mul_ps(a0, _mm256_permute_ps(b23, 0x00));
+            o01 = _mm256_fmadd_ps(a1, _mm256_permute_ps(b01, 0x55), o01);
+            o23 = _mm256_fmadd_ps(a1, _mm256_permute_ps(b23, 0x55), o23);
+            o01 = _mm256_fmadd_ps(a2, _mm256_permute_ps(b01, 0xAA), o01);
+            o23 = _mm256_fmadd_ps(a2, _mm256_permute_ps(b23, 0xAA), o23);
+            o01 = _mm256_fmadd_ps(a3, _mm256_permute_ps(b01, 0xFF), o01);
+            o23 = _mm256_fmadd_ps(a3, _mm256_permute_ps(b23, 0xFF), o23);
+
+            _mm256_storeu_ps(out, o01);
+            _mm256_storeu_ps(out + 8, o23);
+        }
+    }
+
+    MATRIX_BATCH_TARGET_AVX2 void invert_group_avx2(const float *m, float *out)
+    {
+        __m256 a[16], b[16];
+        for (int half = 0; half < 2; half++)
+        {
+            for (int j = 0; j < 8; j++) a[8 * half + j] = _mm256_loadu_ps(m + 16 * j + 8 * half);
+            transpose8(a + 8 * half);
+        }
+
+        invert_lanes(a, b);
+
+        for (int half = 0; half < 2; half++)
+        {
+            transpose8(b + 8 * half);
+            for (int j = 0; j < 8; j++) _mm256_storeu_ps(out + 16 * j + 8 * half, b[8 * half + j]);
+        }
+    }
+
+    void invert_avx2(const float *m, float *out, size_t count)
+    {
+        invert_in_groups<8>(m, out, count, invert_group_avx2);
+    }
+
+    // Two points per register: the 6 floats are loaded with a mask, spread
+    // into x, y and z per 128-bit half, and packed back before storing
+    MATRIX_BATCH_TARGET_AVX2 void transform_avx2(const float *m, const float *in, float *out, size_t count, float w)
+    {
+        __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(m)),
+               c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(m + 4)),
+               c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(m + 8));
+        __m256 translation = _mm256_mul_ps(_mm256_broadcast_ps(reinterpret_cast<const __m128 *>(m + 12)),
+                                           _mm256_set1_ps(w));
+
+        __m256i mask = _mm256_setr_epi32(-1, -1, -1, -1, -1, -1, 0, 0);
+        __m256i x    = _mm256_setr_epi32(0, 0, 0, 0, 3, 3, 3, 3),
+                y    = _mm256_setr_epi32(1, 1, 1, 1, 4, 4, 4, 4),
+                z    = _mm256_setr_epi32(2, 2, 2, 2, 5, 5, 5, 5),
+                pack = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+
+        size_t i = 0;
+        for (; i + 2 <= count; i += 2, in += 6, out += 6)
+        {
+            __m256 points = _mm256_maskload_ps(in, mask);
+            __m256 result = _mm256_fmadd_ps(c0, _mm256_permutevar8x32_ps(points, x), translation);
+            result = _mm256_fmadd_ps(c1, _mm256_permutevar8x32_ps(points, y), result);
+            result = _mm256_fmadd_ps(c2, _mm256_permutevar8x32_ps(points, z), result);
+            _mm256_maskstore_ps(out, mask, _mm256_permutevar8x32_ps(result, pack));
+        }
+        if (i < count) transform_sse2(m, in, out, count - i, w);
+    }
+
+    const Kernels AVX2_KERNELS = { multiply_avx2, invert_avx2, transform_avx2 };
+
+    /* ------------------------------ AVX-512 ---------------------------- */
+
+    MATRIX_BATCH_TARGET_AVX512 inline __m512 msub(__m512 a, __m512 b, __m512 c, __m512 d)
+    {
+        return _mm512_fmsub_ps(a, b, _mm512_mul_ps(c, d));
+    }
+
+    MATRIX_BATCH_TARGET_AVX512 inline __m512 cofactor(__m512 x, __m512 p, __m512 y, __m512 q, __m512 z, __m512 r)
+    {
+        return _mm512_fmadd_ps(z, r, msub(x, p, y, q));
+    }
+
+    MATRIX_BATCH_TARGET_AVX512 inline void invert_lanes(const __m512 a[16], __m512 b[16])
+    {
+        __m512 s0 = msub(a[0], a[5], a[4], a[1]),    s1 = msub(a[0], a[6], a[4], a[2]),
+               s2 = msub(a[0], a[7], a[4], a[3]),    s3 = msub(a[1], a[6], a[5], a[2]),
+               s4 = msub(a[1], a[7], a[5], a[3]),    s5 = msub(a[2], a[7], a[6], a[3]);
+        __m512 c0 = msub(a[8], a[13], a[12], a[9]),  c1 = msub(a[8], a[14], a[12], a[10]),
+               c2 = msub(a[8], a[15], a[12], a[11]), c3 = msub(a[9], a[14], a[13], a[10]),
+               c4 = msub(a[9], a[15], a[13], a[11]), c5 = msub(a[10], a[15], a[14], a[11]);
+
+        __m512 det = _mm512_add_ps(cofactor(s0, c5, s1, c4, s2, c3), cofactor(s3, c2, s4, c1, s5, c0));
+        __m512 inv = _mm512_div_ps(_mm512_set1_ps(1.0f), det);
+        __m512 neg = _mm512_sub_ps(_mm512_setzero_ps(), inv);
+
+        b[0]  = _mm512_mul_ps(cofactor(a[5],  c5, a[6],  c4, a[7],  c3), inv);
+        b[1]  = _mm512_mul_ps(cofactor(a[1],  c5, a[2],  c4, a[3],  c3), neg);
+        b[2]  = _mm512_mul_ps(cofactor(a[13], s5, a[14], s4, a[15], s3), inv);
+        b[3]  = _mm512_mul_ps(cofactor(a[9],  s5, a[10], s4, a[11], s3), neg);
+        b[4]  = _mm512_mul_ps(cofactor(a[4],  c5, a[6],  c2, a[7],  c1), neg);
+        b[5]  = _mm512_mul_ps(cofactor(a[0],  c5, a[2],  c2, a[3],  c1), inv);
+        b[6]  = _mm512_mul_ps(cofactor(a[12], s5, a[14], s2, a[15], s1), neg);
+        b[7]  = _mm512_mul_ps(cofactor(a[8],  s5, a[10], s2, a[11], s1), inv);
+        b[8]  = _mm512_mul_ps(cofactor(a[4],  c4, a[5],  c2, a[7],  c0), inv);
+        b[9]  = _mm512_mul_ps(cofactor(a[0],  c4, a[1],  c2, a[3],  c0), neg);
+        b[10] = _mm512_mul_ps(cofactor(a[12], s4, a[13], s2, a[15], s0), inv);
+        b[11] = _mm512_mul_ps(cofactor(a[8],  s4, a[9],  s2, a[11], s0), neg);
+        b[12] = _mm512_mul_ps(cofactor(a[4],  c3, a[5],  c1, a[6],  c0), neg);
+        b[13] = _mm512_mul_ps(cofactor(a[0],  c3, a[1],  c1, a[2],  c0), inv);
+        b[14] = _mm512_mul_ps(cofactor(a[12], s3, a[13], s1, a[14], s0), neg);
+        b[15] = _mm512_mul_ps(cofactor(a[8],  s3, a[9],  s1, a[10], s0), inv);
+    }
+
+    // The whole of b in one register, each column multiplied by the four columns of a
+    MATRIX_BATCH_TARGET_AVX512 void multiply_avx512(const float *a, size_t a_stride, const float *b, float *out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++, a += a_stride, b += 16, out += 16)
+        {
+            __m512 a0 = _mm512_broadcast_f32x4(_mm_loadu_ps(a)),     a1 = _mm512_broadcast_f32x4(_mm_loadu_ps(a + 4)),
+                   a2 = _mm512_broadcast_f32x4(_mm_loadu_ps(a + 8)), a3 = _mm512_broadcast_f32x4(_mm_loadu_ps(a + 12));
+            __m512 columns = _mm512_loadu_ps(b);
+
+            __m512 result = _mm512_mul_ps(a0, _mm512_permute_ps(columns, 0x00));
+            result = _mm512_fmadd_ps(a1, _mm512_permute_ps(columns, 0x55), result);
+            result = _mm512_fmadd_ps(a2, _mm512_permute_ps(columns, 0xAA), result);
+            result = _mm512_fmadd_ps(a3, _mm512_permute_ps(columns, 0xFF), result);
+            _mm512_storeu_ps(out, result);
+        }
+    }
+
+    // In place: row i of the 16x16 block becomes column i
+    MATRIX_BATCH_TARGET_AVX512 inline void transpose16(__m512 r[16])
+    {
+        __m512 t[16], u[16];
+        for (int i = 0; i < 16; i += 2)
+        {
+            t[i]     = _mm512_unpacklo_ps(r[i], r[i + 1]);
+            t[i + 1] = _mm512_unpackhi_ps(r[i], r[i + 1]);
+        }
+        for (int i = 0; i < 16; i += 4)
+        {
+            u[i]     = _mm512_shuffle_ps(t[i],     t[i + 2], 0x44);
+            u[i + 1] = _mm512_shuffle_ps(t[i],     t[i + 2], 0xEE);
+            u[i + 2] = _mm512_shuffle_ps(t[i + 1], t[i + 3], 0x44);
+            u[i + 3] = _mm512_shuffle_ps(t[i + 1], t[i + 3], 0xEE);
+        }
+        // Each 128-bit lane now holds a 4x4 block; move the blocks into place
+        for (int j = 0; j < 4; j++)
+        {
+            t[j]      = _mm512_shuffle_f32x4(u[j],     u[4 + j],  0x88);
+            t[4 + j]  = _mm512_shuffle_f32x4(u[j],     u[4 + j],  0xDD);
+            t[8 + j]  = _mm512_shuffle_f32x4(u[8 + j], u[12 + j], 0x88);
+            t[12 + j] = _mm512_shuffle_f32x4(u[8 + j], u[12 + j], 0xDD);
+        }
+        for (int j = 0; j < 4; j++)
+        {
+            r[j]      = _mm512_shuffle_f32x4(t[j],     t[8 + j],  0x88);
+            r[4 + j]  = _mm512_shuffle_f32x4(t[4 + j], t[12 + j], 0x88);
+            r[8 + j]  = _mm512_shuffle_f32x4(t[j],     t[8 + j],  0xDD);
+            r[12 + j] = _mm512_shuffle_f32x4(t[4 + j], t[12 + j], 0xDD);
+        }
+    }
+
+    MATRIX_BATCH_TARGET_AVX512 void invert_group_avx512(const float *m, float *out)
+    {
+        __m512 a[16], b[16];
+        for (int j = 0; j < 16; j++) a[j] = _mm512_loadu_ps(m + 16 * j);
+        transpose16(a);
+
+        invert_lanes(a, b);
+
+        transpose16(b);
+        for (int j = 0; j < 16; j++) _mm512_storeu_ps(out + 16 * j, b[j]);
+    }
+
+    void invert_avx512(const float *m, float *out, size_t count)
+    {
+        invert_in_groups<16>(m, out, count, invert_group_avx512);
+    }
+
+    // Four points per register; the masked load and store also handle the tail
+    MATRIX_BATCH_TARGET_AVX512 void transform_avx512(const float *m, const float *in, float *out, size_t count, float w)
+    {
+        __m512 c0 = _mm512_broadcast_f32x4(_mm_loadu_ps(m)),
+               c1 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 4)),
+               c2 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 8));
+        __m512 translation = _mm512_mul_ps(_mm512_broadcast_f32x4(_mm_loadu_ps(m + 12)), _mm512_set1_ps(w));
+
+        __m512i x    = _mm512_setr_epi32(0, 0, 0, 0, 3, 3, 3, 3, 6, 6, 6, 6, 9, 9, 9, 9),
+                y    = _mm512_add_epi32(x, _mm512_set1_epi32(1)),
+                z    = _mm512_add_epi32(x, _mm512_set1_epi32(2)),
+                pack = _mm512_setr_epi32(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 15, 15, 15, 15);
+
+        for (size_t i = 0; i < count; i += 4, in += 12, out += 12)
+        {
+            size_t points = std::min<size_t>(4, count - i);
+            __mmask16 mask = (__mmask16) ((1u << (3 * points)) - 1);
+
+            __m512 source = _mm512_maskz_loadu_ps(mask, in);
+            __m512 result = _mm512_fmadd_ps(c0, _mm512_permutexvar_ps(x, source), translation);
+            result = _mm512_fmadd_ps(c1, _mm512_permutexvar_ps(y, source), result);
+            result = _mm512_fmadd_ps(c2, _mm512_permutexvar_ps(z, source), result);
+            _mm512_mask_storeu_ps(out, mask, _mm512_permutexvar_ps(pack, result));
+        }
+    }
+
+    const Kernels AVX512_KERNELS = { multiply_avx512, invert_avx512, transform_avx512 };
+
+    /* ----------------------------- Detection --------------------------- */
+
+    void cpuid(unsigned leaf, unsigned subleaf, unsigned registers[4])
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int values[4];
+        __cpuidex(values, (int) leaf, (int) subleaf);
+        for (int i = 0; i < 4; i++) registers[i] = (unsigned) values[i];
+#else
+        __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+    }
+
+    // Which register files the OS saves on a context switch (XCR0)
+    uint64_t enabled_register_state()
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        return _xgetbv(0);
+#else
+        unsigned low, high;
+        __asm__ volatile ("xgetbv" : "=a" (low), "=d" (high) : "c" (0));
+        return ((uint64_t) high << 32) | low;
+#endif
+    }
+
+    MatrixBatchIsa detect_isa()
+    {
+        unsigned registers[4];
+        cpuid(0, 0, registers);
+        unsigned highest_leaf = registers[0];
+
+        cpuid(1, 0, registers);
+        bool osxsave = registers[2] & (1u << 27),
+             avx     = registers[2] & (1u << 28),
+             fma     = registers[2] & (1u << 12);
+        if (!osxsave || !avx || !fma || highest_leaf < 7) return MATRIX_BATCH_SSE2;
+
+        uint64_t state = enabled_register_state();
+        if ((state & 0x06) != 0x06) return MATRIX_BATCH_SSE2; // XMM and YMM
+
+        cpuid(7, 0, registers);
+        bool avx2    = registers[1] & (1u << 5),
+             avx512f = registers[1] & (1u << 16);
+        if (avx2 && avx512f && (state & 0xE6) == 0xE6) return MATRIX_BATCH_AVX512; // plus opmask and ZMM
+        return avx2 ? MATRIX_BATCH_AVX2 : MATRIX_BATCH_SSE2;
+    }
+#else
+    MatrixBatchIsa detect_isa() { return MATRIX_BATCH_SCALAR; }
+#endif
+
+    const Kernels &kernels_for(MatrixBatchIsa isa)
+    {
+        switch (isa)
+        {
+#ifdef MATRIX_BATCH_X86
+            case MATRIX_BATCH_AVX512: return AVX512_KERNELS;
+            case MATRIX_BATCH_AVX2:   return AVX2_KERNELS;
+            case MATRIX_BATCH_SSE2:   return SSE2_KERNELS;
+#endif
+            default:                  return SCALAR_KERNELS;
+        }
+    }
+
+    struct Dispatch
+    {
+        MatrixBatchIsa supported;
+        MatrixBatchIsa selected;
+        const Kernels *kernels;
+    };
+
+    Dispatch make_dispatch()
+    {
+        MatrixBatchIsa isa = detect_isa();
+        return { isa, isa, &kernels_for(isa) };
+    }
+
+    // Detected on first use rather than during static initialisation
+    Dispatch &dispatch()
+    {
+        static Dispatch state = make_dispatch();
+        return state;
+    }
+}
+
+MatrixBatchIsa get_matrix_batch_isa()           { return dispatch().selected;  }
+MatrixBatchIsa get_supported_matrix_batch_isa() { return dispatch().supported; }
+
+MatrixBatchIsa set_matrix_batch_isa(MatrixBatchIsa isa)
+{
+    Dispatch &state = dispatch();
+    state.selected = std::min(isa, state.supported);
+    state.kernels  = &kernels_for(state.selected);
+    return state.selected;
+}
+
+const char *get_matrix_batch_isa_name(MatrixBatchIsa isa)
+{
+    switch (isa)
+    {
+        case MATRIX_BATCH_SCALAR: return "scalar";
+        case MATRIX_BATCH_SSE2:   return "SSE2";
+        case MATRIX_BATCH_AVX2:   return "AVX2";
+        case MATRIX_BATCH_AVX512: return "AVX-512";
+    }
+    return "unknown";
+}
+
+void multiply_matrices(const glm::mat4 *a, const glm::mat4 *b, glm::mat4 *out, size_t count)
+{
+    dispatch().kernels->multiply(reinterpret_cast<const float *>(a), 16, reinterpret_cast<const float *>(b), reinterpret_cast<float *>(out), count);
+}
+
+void multiply_matrices(const glm::mat4 &parent, const glm::mat4 *b, glm::mat4 *out, size_t count)
+{
+    dispatch().kernels->multiply(&parent[0][0], 0, reinterpret_cast<const float *>(b), reinterpret_cast<float *>(out), count);
+}
+
+void invert_matrices(const glm::mat4 *m, glm::mat4 *out, size_t count)
+{
+    dispatch().kernels->invert(reinterpret_cast<const float *>(m), reinterpret_cast<float *>(out), count);
+}
+
+void transform_points(const glm::mat4 &m, const glm::vec3 *in, glm::vec3 *out, size_t count)
+{
+    dispatch().kernels->transform(&m[0][0], reinterpret_cast<const float *>(in), reinterpret_cast<float *>(out), count, 1.0f);
+}
+
+void transform_vectors(const glm::mat4 &m, const glm::vec3 *in, glm::vec3 *out, size_t count)
+{
+    dispatch().kernels->transform(&m[0][0], reinterpret_cast<const float *>(in), reinterpret_cast<float *>(out), count, 0.0f);
+}
@@ -0,0 +1,72 @@
+/**
+ * @file MatrixBatch.h
+ * @brief Array-at-a-time mat4 multiply, inverse and point/vector transform for
+ * transform hierarchies and skinning. The widest instruction set the CPU and
+ * OS support (SSE2, AVX2 + FMA or AVX-512) is picked once at startup; on
+ * other architectures everything runs through plain glm.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+#include <cstddef>
+#include "glm/mat4x4.hpp"
+#include "glm/vec3.hpp"
+
+enum MatrixBatchIsa
+{
+    MATRIX_BATCH_SCALAR, // plain glm, one matrix at a time
+    MATRIX_BATCH_SSE2,   // 128-bit: one column per register
+    MATRIX_BATCH_AVX2,   // 256-bit with FMA: two columns, or two points, per register
+    MATRIX_BATCH_AVX512  // 512-bit: a whole matrix, or four points, per register
+};
+
+/**
+ * The instruction set the batch functions are currently using.
+ */
+MatrixBatchIsa get_matrix_batch_isa();
+
+/**
+ * The best instruction set this machine supports, whatever has been set.
+ */
+MatrixBatchIsa get_supported_matrix_batch_isa();
+
+/**
+ * Forces a narrower instruction set, e.g. to compare throughput or rule out
+ * a code path. Requests above what the machine supports are clamped; the
+ * level actually selected is returned. Not thread-safe: call it while no
+ * batch function is running.
+ */
+MatrixBatchIsa set_matrix_batch_isa(MatrixBatchIsa isa);
+
+const char *get_matrix_batch_isa_name(MatrixBatchIsa isa);
+
+/**
+ * out[i] = a[i] * b[i]. out may alias a or b.
+ */
+void multiply_matrices(const glm::mat4 *a, const glm::mat4 *b, glm::mat4 *out, size_t count);
+
+/**
+ * out[i] = parent * b[i], e.g. every child of one node. out may alias b.
+ */
+void multiply_matrices(const glm::mat4 &parent, const glm::mat4 *b, glm::mat4 *out, size_t count);
+
+/**
+ * out[i] = inverse(m[i]). Inverts 4, 8 or 16 matrices per iteration in
+ * structure-of-arrays form; a singular matrix gives infs and NaNs in its own
+ * slot only, like glm::inverse. out may alias m.
+ */
+void invert_matrices(const glm::mat4 *m, glm::mat4 *out, size_t count);
+
+/**
+ * out[i] = (m * vec4(in[i], 1)).xyz, without a perspective divide. out may
+ * alias in.
+ */
+void transform_points(const glm::mat4 &m, const glm::vec3 *in, glm::vec3 *out, size_t count);
+
+/**
+ * out[i] = (m * vec4(in[i], 0)).xyz: directions, ignoring the translation.
+ */
+void transform_vectors(const glm::mat4 &m, const glm::vec3 *in, glm::vec3 *out, size_t count);
@@ -0,0 +1,278 @@
+/**
+ * @file MatrixDecompose.cpp
+ * @brief Decomposition kernels per instruction set, and the split between
+ * worker threads. Matrices are copied a block at a time into one array per
+ * element, decomposed by the kernels in MatrixDecomposeKernels.inl and
+ * copied back out, so the kernels only ever see whole lanes.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include "MatrixDecompose.h"
+#include "MatrixBatch.h"
+#include "ParallelJobs.h"
+#include "glm/gtx/batch_math.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define MATRIX_DECOMPOSE_X86 1
+    #include <immintrin.h>
+#endif
+
+namespace
+{
+    // Matrices staged per kernel call; a multiple of every LANE_COUNT
+    const size_t BLOCK_SIZE       = 128;
+    const size_t MAX_LANE_COUNT   = 8;
+    const size_t MATRICES_PER_JOB = 4096;
+
+    // See parallel_thread_count()
+    const size_t MIN_MATRICES_PER_THREAD = 16384;
+
+    // glm::epsilon<float>(), which glm::decompose compares the determinant to
+    const float DETERMINANT_EPSILON = std::numeric_limits<float>::epsilon();
+
+    // in[3 * column + row] for the upper 3x3; out holds scale xyz,
+    // orientation xyzw, skew xyz, then 1 or 0 for valid
+    struct Block3D
+    {
+        float in[9][BLOCK_SIZE];
+        float out[11][BLOCK_SIZE];
+    };
+
+    // in holds the x axis then the y axis; out holds scale xy, the unit x
+    // axis (for the angle), skew, then 1 or 0 for valid
+    struct Block2D
+    {
+        float in[4][BLOCK_SIZE];
+        float out[6][BLOCK_SIZE];
+    };
+
+    typedef void (*Block3DKernel)(Block3D &block, size_t count);
+    typedef void (*Block2DKernel)(Block2D &block, size_t count);
+
+    struct Kernels
+    {
+        Block3DKernel block_3d;
+        Block2DKernel block_2d;
+    };
+
+    /* ------------------------------ Scalar ----------------------------- */
+
+    namespace scalar
+    {
+        typedef float Lanes;
+        typedef bool  Mask;
+        const size_t LANE_COUNT = 1;
+
+        inline Lanes load(const float *p)                        { return *p; }
+        inline void  store(float *p, Lanes v)                    { *p = v; }
+        inline Lanes broadcast(float f)                          { return f; }
+        inline Lanes add(Lanes a, Lanes b)                       { return a + b; }
+        inline Lanes sub(Lanes a, Lanes b)                       { return a - b; }
+        inline Lanes mul(Lanes a, Lanes b)                       { return a * b; }
+        inline Lanes div(Lanes a, Lanes b)                       { return a / b; }
+        inline Lanes square_root(Lanes a)                        { return std::sqrt(a); }
+        inline Lanes absolute(Lanes a)                           { return std::abs(a); }
+        inline Mask  less(Lanes a, Lanes b)                      { return a < b; }
+        inline Mask  greater(Lanes a, Lanes b)                   { return a > b; }
+        inline Lanes blend(Mask m, Lanes if_set, Lanes if_clear) { return m ? if_set : if_clear; }
+
+        #include "MatrixDecomposeKernels.inl"
+
+        const Kernels KERNELS = { decompose_block_3d, decompose_block_2d };
+    }
+
+#ifdef MATRIX_DECOMPOSE_X86
+    /* ------------------------------- SSE2 ------------------------------ */
+
+    namespace sse2
+    {
+        typedef __m128 Lanes;
+        typedef __m128 Mask;
+        const size_t LANE_COUNT = 4;
+
+        inline Lanes load(const float *p)               { return _mm_loadu_ps(p); }
+        inline void  store(float *p, Lanes v)           { _mm_storeu_ps(p, v); }
+        inline Lanes broadcast(float f)                 { return _mm_set1_ps(f); }
+        inline Lanes add(Lanes a, Lanes b)              { return _mm_add_ps(a, b); }
+        inline Lanes sub(Lanes a, Lanes b)              { return _mm_sub_ps(a, b); }
+        inline Lanes mul(Lanes a, Lanes b)              { return _mm_mul_ps(a, b); }
+        inline Lanes div(Lanes a, Lanes b)              { return _mm_div_ps(a, b); }
+        inline Lanes square_root(Lanes a)               { return _mm_sqrt_ps(a); }
+        inline Lanes absolute(Lanes a)                  { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+        inline Mask  less(Lanes a, Lanes b)             { return _mm_cmplt_ps(a, b); }
+        inline Mask  greater(Lanes a, Lanes b)          { return _mm_cmpgt_ps(a, b); }
+        inline Lanes blend(Mask m, Lanes if_set, Lanes if_clear)
+        {
+            return _mm_or_ps(_mm_and_ps(m, if_set), _mm_andnot_ps(m, if_clear));
+        }
+
+        #include "MatrixDecomposeKernels.inl"
+
+        const Kernels KERNELS = { decompose_block_3d, decompose_block_2d };
+    }
+
+    /* ------------------------------- AVX2 ------------------------------ */
+
+    // No FMA here, or in an AVX-512 build: a fused multiply-add would round
+    // differently from glm::decompose. The kernels are bound by division and
+    // square root throughput anyway, which AVX-512 barely improves on.
+#if defined(__clang__)
+    #pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__GNUC__)
+    #pragma GCC push_options
+    #pragma GCC target("avx2")
+#endif
+
+    namespace avx2
+    {
+        typedef __m256 Lanes;
+        typedef __m256 Mask;
+        const size_t LANE_COUNT = 8;
+
+        inline Lanes load(const float *p)               { return _mm256_loadu_ps(p); }
+        inline void  store(float *p, Lanes v)           { _mm256_storeu_ps(p, v); }
+        inline Lanes broadcast(float f)                 { return _mm256_set1_ps(f); }
+        inline Lanes add(Lanes a, Lanes b)              { return _mm256_add_ps(a, b); }
+        inline Lanes sub(Lanes a, Lanes b)              { return _mm256_sub_ps(a, b); }
+        inline Lanes mul(Lanes a, Lanes b)              { return _mm256_mul_ps(a, b); }
+        inline Lanes div(Lanes a, Lanes b)              { return _mm256_div_ps(a, b); }
+        inline Lanes square_root(Lanes a)               { return _mm256_sqrt_ps(a); }
+        inline Lanes absolute(Lanes a)                  { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+        inline Mask  less(Lanes a, Lanes b)             { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+        inline Mask  greater(Lanes a, Lanes b)          { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+        inline Lanes blend(Mask m, Lanes if_set, Lanes if_clear) { return _mm256_blendv_ps(if_clear, if_set, m); }
+
+        #include "MatrixDecomposeKernels.inl"
+
+        const Kernels KERNELS = { decompose_block_3d, decompose_block_2d };
+    }
+
+#if defined(__clang__)
+    #pragma clang attribute pop
+#elif defined(__GNUC__)
+    #pragma GCC pop_options
+#endif
+#endif
+
+    const Kernels &kernels()
+    {
+        switch (get_matrix_batch_isa())
+        {
+#ifdef MATRIX_DECOMPOSE_X86
+            case MATRIX_BATCH_AVX512:
+            case MATRIX_BATCH_AVX2:   return avx2::KERNELS;
+            case MATRIX_BATCH_SSE2:   return sse2::KERNELS;
+#endif
+            default:                  return scalar::KERNELS;
+        }
+    }
+
+    size_t decompose_block(const Kernels &selected, const glm::mat4 *m, DecomposedTransform *out, bool *valid,
+                           size_t count)
+    {
+        Block3D block;
+        for (size_t i = 0; i < count; i++)
+            for (int column = 0; column < 3; column++)
+                for (int row = 0; row < 3; row++) block.in[3 * column + row][i] = m[i][column][row];
+
+        // Identities fill out the last lanes
+        size_t padded = std::min(BLOCK_SIZE, (count + MAX_LANE_COUNT - 1) / MAX_LANE_COUNT * MAX_LANE_COUNT);
+        for (size_t i = count; i < padded; i++)
+            for (int element = 0; element < 9; element++) block.in[element][i] = element % 4 == 0 ? 1.0f : 0.0f;
+
+        selected.block_3d(block, padded);
+
+        size_t decomposed = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            DecomposedTransform &transform = out[i];
+            transform.scale         = glm::vec3(block.out[0][i], block.out[1][i], block.out[2][i]);
+            transform.orientation.x = block.out[3][i];
+            transform.orientation.y = block.out[4][i];
+            transform.orientation.z = block.out[5][i];
+            transform.orientation.w = block.out[6][i];
+            transform.translation   = glm::vec3(m[i][3]);
+            transform.skew          = glm::vec3(block.out[7][i], block.out[8][i], block.out[9][i]);
+
+            bool is_valid = block.out[10][i] != 0.0f;
+            if (valid != nullptr) valid[i] = is_valid;
+            decomposed += is_valid;
+        }
+        return decomposed;
+    }
+
+    size_t decompose_block(const Kernels &selected, const glm::affine2d *m, DecomposedTransform2D *out, bool *valid,
+                           size_t count)
+    {
+        Block2D block;
+        for (size_t i = 0; i < count; i++)
+            for (int column = 0; column < 2; column++)
+                for (int row = 0; row < 2; row++) block.in[2 * column + row][i] = m[i][column][row];
+
+        size_t padded = std::min(BLOCK_SIZE, (count + MAX_LANE_COUNT - 1) / MAX_LANE_COUNT * MAX_LANE_COUNT);
+        for (size_t i = count; i < padded; i++)
+            for (int element = 0; element < 4; element++) block.in[element][i] = element % 3 == 0 ? 1.0f : 0.0f;
+
+        selected.block_2d(block, padded);
+
+        float angles[BLOCK_SIZE];
+        glm::batchAtan2(block.out[3], block.out[2], angles, count);
+
+        size_t decomposed = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            DecomposedTransform2D &transform = out[i];
+            transform.scale       = glm::vec2(block.out[0][i], block.out[1][i]);
+            transform.angle       = angles[i];
+            transform.translation = m[i][2];
+            transform.skew        = block.out[4][i];
+
+            bool is_valid = block.out[5][i] != 0.0f;
+            if (valid != nullptr) valid[i] = is_valid;
+            decomposed += is_valid;
+        }
+        return decomposed;
+    }
+
+    template <typename Matrix, typename Transform>
+    size_t decompose_all(const Matrix *m, Transform *out, bool *valid, size_t count, unsigned thread_count)
+    {
+        const Kernels &selected = kernels();
+        std::atomic<size_t> decomposed(0);
+
+        thread_count = parallel_thread_count(thread_count, count, MIN_MATRICES_PER_THREAD);
+        run_parallel_jobs(thread_count, (count + MATRICES_PER_JOB - 1) / MATRICES_PER_JOB, [&](size_t job)
+        {
+            size_t first = job * MATRICES_PER_JOB, last = std::min(first + MATRICES_PER_JOB, count);
+            size_t job_decomposed = 0;
+            for (size_t i = first; i < last; i += BLOCK_SIZE)
+            {
+                job_decomposed += decompose_block(selected, m + i, out + i, valid != nullptr ? valid + i : nullptr,
+                                                  std::min(BLOCK_SIZE, last - i));
+            }
+            decomposed += job_decomposed;
+        });
+
+        return decomposed;
+    }
+}
+
+size_t decompose_matrices(const glm::mat4 *m, DecomposedTransform *out, bool *valid, size_t count,
+                          unsigned thread_count)
+{
+    return decompose_all(m, out, valid, count, thread_count);
+}
+
+size_t decompose_affines(const glm::affine2d *m, DecomposedTransform2D *out, bool *valid, size_t count,
+                         unsigned thread_count)
+{
+    return decompose_all(m, out, valid, count, thread_count);
+}
@@ -0,0 +1,58 @@
+/**
+ * @file MatrixDecompose.h
+ * @brief Array-at-a-time decomposition of affine transforms into scale,
+ * shear, rotation and translation, for the level-save and retargeting tools.
+ * The 3D version is glm::decompose without the perspective step; large
+ * arrays are split between worker threads and each runs 4, 8 or 16 matrices
+ * per instruction, at the level get_matrix_batch_isa() selects.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+#include <cstddef>
+#include "glm/mat4x4.hpp"
+#include "glm/gtc/quaternion.hpp"
+#include "glm/gtx/affine_2d.hpp"
+
+struct DecomposedTransform
+{
+    glm::vec3 scale;
+    glm::quat orientation;
+    glm::vec3 translation;
+    glm::vec3 skew;        // as returned by glm::decompose
+};
+
+struct DecomposedTransform2D
+{
+    glm::vec2 scale;
+    float     angle;       // radians, counter-clockwise, in [-pi, pi]
+    glm::vec2 translation;
+    float     skew;        // how far the y axis leans along x, as in glm::shearY
+};
+
+/**
+ * Decomposes count affine matrices. The bottom row is assumed to be
+ * (0, 0, 0, 1) and never read, so for affine input every output matches
+ * glm::decompose bit for bit. A matrix whose upper 3x3 has a determinant
+ * within epsilon of zero cannot be decomposed: valid[i] is then false and
+ * out[i] is unspecified. valid may be null. Returns how many decomposed.
+ * Results do not depend on the instruction set or thread count.
+ *
+ * thread_count 0 picks one per hardware thread; small arrays use fewer.
+ */
+size_t decompose_matrices(const glm::mat4 *m, DecomposedTransform *out, bool *valid, size_t count,
+                          unsigned thread_count = 0);
+
+/**
+ * The same for 2D transforms. Reflections come out as a negative scale.y,
+ * and each transform is rebuilt by
+ *
+ *     scale(shearY(rotate(translate(glm::affine2d(1), translation), angle), skew), scale)
+ *
+ * The angle comes from glm::batchAtan2, so is within 3 ulp.
+ */
+size_t decompose_affines(const glm::affine2d *m, DecomposedTransform2D *out, bool *valid, size_t count,
+                         unsigned thread_count = 0);
@@ -0,0 +1,154 @@
+/**
+ * @file MatrixDecomposeKernels.inl
+ * @brief The decomposition with one matrix per lane. MatrixDecompose.cpp
+ * includes this file once per instruction set, inside a namespace that
+ * defines Lanes, Mask, LANE_COUNT and the lane operations (load, store,
+ * broadcast, add, sub, mul, div, square_root, absolute, less, greater,
+ * blend).
+ *
+ * Every step follows gtx/matrix_decompose.inl operation for operation, in
+ * the same order, so that the results match glm bit for bit. Where glm
+ * branches on the trace and the largest diagonal element to pick a
+ * quaternion formula, every lane here evaluates all four and blends.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+// glm::dot for vec3: (a * b) summed x + y + z
+inline Lanes dot(Lanes ax, Lanes ay, Lanes az, Lanes bx, Lanes by, Lanes bz)
+{
+    return add(add(mul(ax, bx), mul(ay, by)), mul(az, bz));
+}
+
+inline Lanes dot(Lanes ax, Lanes ay, Lanes bx, Lanes by)
+{
+    return add(mul(ax, bx), mul(ay, by));
+}
+
+// Decomposes count matrices of a Block3D, rounded up to whole lanes; the
+// caller pads the block so the extra lanes hold something decomposable
+void decompose_block_3d(Block3D &block, size_t count)
+{
+    const Lanes one = broadcast(1.0f), half = broadcast(0.5f), zero = broadcast(0.0f);
+
+    for (size_t i = 0; i < count; i += LANE_COUNT)
+    {
+        Lanes r0x = load(&block.in[0][i]), r0y = load(&block.in[1][i]), r0z = load(&block.in[2][i]),
+              r1x = load(&block.in[3][i]), r1y = load(&block.in[4][i]), r1z = load(&block.in[5][i]),
+              r2x = load(&block.in[6][i]), r2y = load(&block.in[7][i]), r2z = load(&block.in[8][i]);
+
+        // glm::determinant of the matrix with the perspective row cleared;
+        // the terms that vanish there are left out, which is exact
+        Lanes determinant = add(sub(mul(r0x, sub(mul(r1y, r2z), mul(r1z, r2y))),
+                                    mul(r0y, sub(mul(r1x, r2z), mul(r1z, r2x)))),
+                                mul(r0z, sub(mul(r1x, r2y), mul(r1y, r2x))));
+
+        // Scale and shear, row by row
+        Lanes scale_x = square_root(dot(r0x, r0y, r0z, r0x, r0y, r0z));
+        r0x = div(r0x, scale_x);
+        r0y = div(r0y, scale_x);
+        r0z = div(r0z, scale_x);
+
+        Lanes skew_z = dot(r0x, r0y, r0z, r1x, r1y, r1z);
+        r1x = sub(r1x, mul(r0x, skew_z));
+        r1y = sub(r1y, mul(r0y, skew_z));
+        r1z = sub(r1z, mul(r0z, skew_z));
+
+        Lanes scale_y = square_root(dot(r1x, r1y, r1z, r1x, r1y, r1z));
+        r1x = div(r1x, scale_y);
+        r1y = div(r1y, scale_y);
+        r1z = div(r1z, scale_y);
+        skew_z = div(skew_z, scale_y);
+
+        Lanes skew_y = dot(r0x, r0y, r0z, r2x, r2y, r2z);
+        r2x = sub(r2x, mul(r0x, skew_y));
+        r2y = sub(r2y, mul(r0y, skew_y));
+        r2z = sub(r2z, mul(r0z, skew_y));
+        Lanes skew_x = dot(r1x, r1y, r1z, r2x, r2y, r2z);
+        r2x = sub(r2x, mul(r1x, skew_x));
+        r2y = sub(r2y, mul(r1y, skew_x));
+        r2z = sub(r2z, mul(r1z, skew_x));
+
+        Lanes scale_z = square_root(dot(r2x, r2y, r2z, r2x, r2y, r2z));
+        r2x = div(r2x, scale_z);
+        r2y = div(r2y, scale_z);
+        r2z = div(r2z, scale_z);
+        skew_y = div(skew_y, scale_z);
+        skew_x = div(skew_x, scale_z);
+
+        // A coordinate system flip negates every row and scale
+        Lanes cross_x = sub(mul(r1y, r2z), mul(r2y, r1z)),
+              cross_y = sub(mul(r1z, r2x), mul(r2z, r1x)),
+              cross_z = sub(mul(r1x, r2y), mul(r2x, r1y));
+        Lanes sign = blend(less(dot(r0x, r0y, r0z, cross_x, cross_y, cross_z), zero), broadcast(-1.0f), one);
+        scale_x = mul(scale_x, sign); r0x = mul(r0x, sign); r0y = mul(r0y, sign); r0z = mul(r0z, sign);
+        scale_y = mul(scale_y, sign); r1x = mul(r1x, sign); r1y = mul(r1y, sign); r1z = mul(r1z, sign);
+        scale_z = mul(scale_z, sign); r2x = mul(r2x, sign); r2y = mul(r2y, sign); r2z = mul(r2z, sign);
+
+        // Rotation: w leads when the trace is positive, otherwise the
+        // largest diagonal element i, with j and k the next two axes
+        Lanes trace = add(add(r0x, r1y), r2z);
+        Mask  use_w = greater(trace, zero);
+        Mask  use_1 = greater(r1y, r0x);
+        Mask  use_2 = greater(r2z, blend(use_1, r1y, r0x));
+
+        Lanes root = square_root(blend(use_w, add(trace, one),
+                                 blend(use_2, add(sub(sub(r2z, r0x), r1y), one),
+                                 blend(use_1, add(sub(sub(r1y, r2z), r0x), one),
+                                              add(sub(sub(r0x, r1y), r2z), one)))));
+        Lanes lead = mul(half, root), factor = div(half, root);
+
+        Lanes sum_xy  = mul(factor, add(r0y, r1x)), sum_xz  = mul(factor, add(r0z, r2x)),
+              sum_yz  = mul(factor, add(r1z, r2y)), diff_x  = mul(factor, sub(r1z, r2y)),
+              diff_y  = mul(factor, sub(r2x, r0z)), diff_z  = mul(factor, sub(r0y, r1x));
+
+        store(&block.out[3][i], blend(use_w, diff_x, blend(use_2, sum_xz, blend(use_1, sum_xy, lead))));
+        store(&block.out[4][i], blend(use_w, diff_y, blend(use_2, sum_yz, blend(use_1, lead, sum_xy))));
+        store(&block.out[5][i], blend(use_w, diff_z, blend(use_2, lead, blend(use_1, sum_yz, sum_xz))));
+        store(&block.out[6][i], blend(use_w, lead, blend(use_2, diff_z, blend(use_1, diff_y, diff_x))));
+
+        store(&block.out[0][i], scale_x);
+        store(&block.out[1][i], scale_y);
+        store(&block.out[2][i], scale_z);
+        store(&block.out[7][i], skew_x);
+        store(&block.out[8][i], skew_y);
+        store(&block.out[9][i], skew_z);
+        store(&block.out[10][i], blend(less(absolute(determinant), broadcast(DETERMINANT_EPSILON)), zero, one));
+    }
+}
+
+// The 2D version: the x axis gives the scale and rotation, what is left of
+// the y axis after removing its x component gives the shear and y scale
+void decompose_block_2d(Block2D &block, size_t count)
+{
+    const Lanes one = broadcast(1.0f), zero = broadcast(0.0f);
+
+    for (size_t i = 0; i < count; i += LANE_COUNT)
+    {
+        Lanes r0x = load(&block.in[0][i]), r0y = load(&block.in[1][i]),
+              r1x = load(&block.in[2][i]), r1y = load(&block.in[3][i]);
+
+        Lanes determinant = sub(mul(r0x, r1y), mul(r1x, r0y));
+
+        Lanes scale_x = square_root(dot(r0x, r0y, r0x, r0y));
+        r0x = div(r0x, scale_x);
+        r0y = div(r0y, scale_x);
+
+        Lanes skew = dot(r0x, r0y, r1x, r1y);
+        r1x = sub(r1x, mul(r0x, skew));
+        r1y = sub(r1y, mul(r0y, skew));
+
+        // Negating both axes would only rotate by pi, so a flip goes on y alone
+        Lanes scale_y = square_root(dot(r1x, r1y, r1x, r1y));
+        scale_y = mul(scale_y, blend(less(determinant, zero), broadcast(-1.0f), one));
+        skew = div(skew, scale_y);
+
+        store(&block.out[0][i], scale_x);
+        store(&block.out[1][i], scale_y);
+        store(&block.out[2][i], r0x);
+        store(&block.out[3][i], r0y);
+        store(&block.out[4][i], skew);
+        store(&block.out[5][i], blend(less(absolute(determinant), broadcast(DETERMINANT_EPSILON)), zero, one));
+    }
+}
@@ -0,0 +1,246 @@
+/**
+ * @file Mipmap.cpp
+ * @brief Mipmap chain generation. Each level is produced from the previous
+ * one with a separable 2:1 filter applied to linear, alpha-weighted colour
+ * held as four floats per texel (one SSE register when available).
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#define GL_SILENCE_DEPRECATION
+#include "Mipmap.h"
+#include "glm/glm.hpp"
+#include "glm/gtc/color_space.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <xmmintrin.h>
+    #define MIPMAP_USE_SSE 1
+#endif
+
+namespace
+{
+    constexpr int LINEAR_TO_SRGB_STEPS = 4096;
+
+    // A texel is linear rgb premultiplied by alpha, then alpha
+#ifdef MIPMAP_USE_SSE
+    typedef __m128 Texel;
+
+    inline Texel texel_zero()                               { return _mm_setzero_ps(); }
+    inline Texel texel_load(const float *source)            { return _mm_loadu_ps(source); }
+    inline void  texel_store(float *target, Texel texel)    { _mm_storeu_ps(target, texel); }
+    inline Texel texel_madd(Texel sum, Texel texel, float weight)
+    {
+        return _mm_add_ps(sum, _mm_mul_ps(texel, _mm_set1_ps(weight)));
+    }
+#else
+    typedef glm::vec4 Texel;
+
+    inline Texel texel_zero()                               { return Texel(0.0f); }
+    inline Texel texel_load(const float *source)            { return Texel(source[0], source[1], source[2], source[3]); }
+    inline void  texel_store(float *target, Texel texel)    { std::memcpy(target, &texel[0], sizeof(float) * 4); }
+    inline Texel texel_madd(Texel sum, Texel texel, float weight) { return sum + texel * weight; }
+#endif
+
+    struct FilterTaps
+    {
+        int   first_offset; // relative to 2 * destination index
+        int   count;
+        float weights[6];
+    };
+
+    float bessel_i0(float x)
+    {
+        float sum = 1.0f, term = 1.0f;
+        for (int k = 1; k < 16; k++)
+        {
+            term *= (x * 0.5f / k) * (x * 0.5f / k);
+            sum  += term;
+        }
+        return sum;
+    }
+
+    FilterTaps make_taps(MipFilter filter)
+    {
+        if (filter == MIP_FILTER_BOX) return { 0, 2, { 0.5f, 0.5f } };
+
+        // Source texels 2x-2 .. 2x+3 sit at -2.5 .. 2.5 from the destination
+        // centre, i.e. -1.25 .. 1.25 in destination texels
+        constexpr float RADIUS = 1.5f,
+                        BETA   = 4.0f;
+        const float pi = 3.14159265358979f;
+
+        FilterTaps taps = { -2, 6, {} };
+        float total = 0.0f;
+        for (int i = 0; i < taps.count; i++)
+        {
+            float t      = (i - 2.5f) * 0.5f;
+            float sinc   = std::sin(pi * t) / (pi * t);
+            float window = bessel_i0(BETA * std::sqrt(1.0f - (t / RADIUS) * (t / RADIUS))) / bessel_i0(BETA);
+
+            taps.weights[i] = sinc * window;
+            total          += taps.weights[i];
+        }
+        for (int i = 0; i < taps.count; i++) taps.weights[i] /= total;
+
+        return taps;
+    }
+
+    struct ColourTables
+    {
+        float         srgb_to_linear[256];
+        unsigned char linear_to_srgb[LINEAR_TO_SRGB_STEPS + 1];
+
+        ColourTables()
+        {
+            for (int i = 0; i < 256; i++)
+                srgb_to_linear[i] = glm::convertSRGBToLinear(glm::vec4(i / 255.0f)).x;
+
+            for (int i = 0; i <= LINEAR_TO_SRGB_STEPS; i++)
+            {
+                float srgb = glm::convertLinearToSRGB(glm::vec4((float) i / LINEAR_TO_SRGB_STEPS)).x;
+                linear_to_srgb[i] = (unsigned char) (srgb * 255.0f + 0.5f);
+            }
+        }
+    };
+
+    const ColourTables &colour_tables()
+    {
+        static const ColourTables tables;
+        return tables;
+    }
+
+    void decode_level(const unsigned char *rgba, size_t texel_count, float *texels)
+    {
+        const ColourTables &tables = colour_tables();
+        for (size_t i = 0; i < texel_count; i++)
+        {
+            float alpha = rgba[i * 4 + 3] / 255.0f;
+            texels[i * 4 + 0] = tables.srgb_to_linear[rgba[i * 4 + 0]] * alpha;
+            texels[i * 4 + 1] = tables.srgb_to_linear[rgba[i * 4 + 1]] * alpha;
+            texels[i * 4 + 2] = tables.srgb_to_linear[rgba[i * 4 + 2]] * alpha;
+            texels[i * 4 + 3] = alpha;
+        }
+    }
+
+    void encode_level(const float *texels, size_t texel_count, unsigned char *rgba)
+    {
+        const ColourTables &tables = colour_tables();
+        for (size_t i = 0; i < texel_count; i++)
+        {
+            float alpha = std::min(std::max(texels[i * 4 + 3], 0.0f), 1.0f);
+
+            for (int channel = 0; channel < 3; channel++)
+            {
+                // Negative Kaiser lobes can push colour outside [0, alpha]
+                float linear = alpha > 0.0f ? texels[i * 4 + channel] / alpha : 0.0f;
+                linear = std::min(std::max(linear, 0.0f), 1.0f);
+                rgba[i * 4 + channel] = tables.linear_to_srgb[(int) (linear * LINEAR_TO_SRGB_STEPS + 0.5f)];
+            }
+            rgba[i * 4 + 3] = (unsigned char) (alpha * 255.0f + 0.5f);
+        }
+    }
+
+    void downsample_rows(const float *source, int width, int height,
+                         float *target, int target_width, const FilterTaps &taps)
+    {
+        for (int y = 0; y < height; y++)
+        {
+            const float *row = source + (size_t) y * width * 4;
+            float       *out = target + (size_t) y * target_width * 4;
+
+            for (int x = 0; x < target_width; x++)
+            {
+                Texel sum = texel_zero();
+                for (int tap = 0; tap < taps.count; tap++)
+                {
+                    int column = std::min(std::max(2 * x + taps.first_offset + tap, 0), width - 1);
+                    sum = texel_madd(sum, texel_load(row + column * 4), taps.weights[tap]);
+                }
+                texel_store(out + x * 4, sum);
+            }
+        }
+    }
+
+    void downsample_columns(const float *source, int width, int height,
+                            float *target, int target_height, const FilterTaps &taps)
+    {
+        // Walk whole rows so every tap reads memory sequentially
+        for (int y = 0; y < target_height; y++)
+        {
+            float *out = target + (size_t) y * width * 4;
+            for (int x = 0; x < width; x++) texel_store(out + x * 4, texel_zero());
+
+            for (int tap = 0; tap < taps.count; tap++)
+            {
+                int          source_y = std::min(std::max(2 * y + taps.first_offset + tap, 0), height - 1);
+                const float *row      = source + (size_t) source_y * width * 4;
+
+                for (int x = 0; x < width; x++)
+                    texel_store(out + x * 4, texel_madd(texel_load(out + x * 4), texel_load(row + x * 4), taps.weights[tap]));
+            }
+        }
+    }
+}
+
+MipChain generate_mip_chain(const unsigned char *rgba, int width, int height, MipFilter filter)
+{
+    MipChain chain;
+
+    size_t total_bytes = 0;
+    for (int w = width, h = height;; w = std::max(1, w / 2), h = std::max(1, h / 2))
+    {
+        chain.levels.push_back({ w, h, total_bytes });
+        total_bytes += (size_t) w * h * 4;
+        if ((w == 1 && h == 1) || filter == MIP_FILTER_NONE) break;
+    }
+
+    chain.pixels.resize(total_bytes);
+    std::memcpy(chain.pixels.data(), rgba, (size_t) width * height * 4);
+    if (chain.levels.size() == 1) return chain;
+
+    const FilterTaps taps = make_taps(filter);
+
+    std::vector<float> current((size_t) width * height * 4),
+                       scratch((size_t) std::max(1, width / 2) * height * 4),
+                       next;
+    decode_level(rgba, (size_t) width * height, current.data());
+
+    for (size_t level = 1; level < chain.levels.size(); level++)
+    {
+        const MipLevel &above = chain.levels[level - 1],
+                       &below = chain.levels[level];
+
+        if (below.width != above.width) downsample_rows(current.data(), above.width, above.height, scratch.data(), below.width, taps);
+        else std::copy(current.begin(), current.begin() + (size_t) above.width * above.height * 4, scratch.begin());
+
+        next.resize((size_t) below.width * below.height * 4);
+        if (below.height != above.height) downsample_columns(scratch.data(), below.width, above.height, next.data(), below.height, taps);
+        else std::copy(scratch.begin(), scratch.begin() + next.size(), next.begin());
+
+        encode_level(next.data(), (size_t) below.width * below.height, chain.level_data(level));
+        current.swap(next);
+    }
+
+    return chain;
+}
+
+void upload_mip_levels(const std::vector<MipLevel> &levels, const unsigned char *pixels)
+{
+    for (size_t level = 0; level < levels.size(); level++)
+    {
+        const MipLevel &mip = levels[level];
+        glTexImage2D(GL_TEXTURE_2D, (GLint) level, GL_RGBA, mip.width, mip.height, 0,
+                     GL_RGBA, GL_UNSIGNED_BYTE, pixels + mip.offset);
+    }
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint) levels.size() - 1);
+}
+
+void upload_mip_chain(const MipChain &chain)
+{
+    upload_mip_levels(chain.levels, chain.pixels.data());
+}
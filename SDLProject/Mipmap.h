@@ -0,0 +1,61 @@
+/**
+ * @file Mipmap.h
+ * @brief CPU mipmap chain generation for RGBA8 sprites. Levels are filtered
+ * in linear light and stored back to back in a single buffer, so a chain can
+ * be uploaded level by level or block-compressed in one pass.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+#ifdef _WINDOWS
+    #include <GL/glew.h>
+#endif
+#define GL_GLEXT_PROTOTYPES 1
+#include <SDL_opengl.h>
+#include <cstddef>
+#include <vector>
+
+enum MipFilter
+{
+    MIP_FILTER_NONE,   // base level only, no chain
+    MIP_FILTER_BOX,    // 2x2 average, cheap
+    MIP_FILTER_KAISER  // 6-tap Kaiser-windowed sinc, keeps sprites sharper
+};
+
+struct MipLevel
+{
+    int    width;
+    int    height;
+    size_t offset; // in bytes, into MipChain::pixels
+};
+
+struct MipChain
+{
+    std::vector<MipLevel>      levels;
+    std::vector<unsigned char> pixels; // RGBA8, level 0 first
+
+    unsigned char       *level_data(size_t level)       { return pixels.data() + levels[level].offset; }
+    const unsigned char *level_data(size_t level) const { return pixels.data() + levels[level].offset; }
+};
+
+/**
+ * Builds the full chain down to 1x1 from straight-alpha sRGB pixels. Colour
+ * is converted to linear light and weighted by alpha before filtering so
+ * transparent texels don't darken the edges of the sprite. The output is
+ * still straight alpha; premultiply the whole chain afterwards if needed.
+ */
+MipChain generate_mip_chain(const unsigned char *rgba, int width, int height, MipFilter filter);
+
+/**
+ * Uploads every level of the chain to the texture currently bound to
+ * GL_TEXTURE_2D and clamps GL_TEXTURE_MAX_LEVEL to the chain length.
+ */
+void upload_mip_chain(const MipChain &chain);
+
+/**
+ * Same, for levels whose pixels live elsewhere (e.g. a memory-mapped file).
+ */
+void upload_mip_levels(const std::vector<MipLevel> &levels, const unsigned char *pixels);
@@ -0,0 +1,372 @@
+/**
+ * @file NoiseField.cpp
+ * @brief Noise kernels per instruction set, and the row/chunk split between
+ * worker threads. The wide kernels live in NoiseFieldKernels.inl; the copies
+ * used in deterministic mode are compiled without FMA so that nothing gets
+ * fused behind their back, and the FMA copies with contraction off so that
+ * only their explicit mul_add calls fuse (clang's default already stops at
+ * the statement; GCC would otherwise fuse the lattice skew too).
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#include "NoiseField.h"
+#include "MatrixBatch.h"
+#include "ParallelJobs.h"
+#include "glm/glm.hpp"
+#include "glm/gtc/noise.hpp"
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define NOISE_FIELD_X86 1
+    #include <immintrin.h>
+#endif
+
+namespace
+{
+    typedef size_t (*Points2DKernel)(const NoiseSettings &settings, const float *x, const float *y, float *out, size_t count);
+    typedef size_t (*Points3DKernel)(const NoiseSettings &settings, const float *x, const float *y, const float *z, float *out, size_t count);
+    typedef size_t (*Row2DKernel)(const NoiseSettings &settings, float origin_x, float spacing_x, float y, float *out, size_t count);
+    typedef size_t (*Row3DKernel)(const NoiseSettings &settings, float origin_x, float spacing_x, float y, float z, float *out, size_t count);
+
+    // Each returns how many samples it wrote; the wide ones stop at the last
+    // whole block and the caller finishes with noise_sample()
+    struct Kernels
+    {
+        Points2DKernel points_2d;
+        Points3DKernel points_3d;
+        Row2DKernel    row_2d;
+        Row3DKernel    row_3d;
+    };
+
+    // See parallel_thread_count()
+    const size_t MIN_SAMPLES_PER_THREAD = 16384;
+    const size_t POINTS_PER_JOB         = 4096;
+
+    int octave_count(const NoiseSettings &settings)
+    {
+        return settings.fractal == FRACTAL_NONE ? 1 : std::max(1, settings.octaves);
+    }
+
+    template <typename Position>
+    float basis_noise(NoiseBasis basis, const Position &position)
+    {
+        return basis == NOISE_PERLIN ? glm::perlin(position) : glm::simplex(position);
+    }
+
+    template <typename Position>
+    float fractal_noise(const NoiseSettings &settings, Position position)
+    {
+        position = position * settings.frequency;
+        if (settings.fractal == FRACTAL_NONE) return basis_noise(settings.basis, position);
+
+        float sum = 0.0f, amplitude = 1.0f, total = 0.0f;
+        for (int octave = 0; octave < octave_count(settings); octave++)
+        {
+            float n = basis_noise(settings.basis, position);
+            if (settings.fractal == FRACTAL_RIDGED)
+            {
+                n = 1.0f - std::abs(n);
+                n = n * n;
+            }
+            sum = sum + amplitude * n;
+            total += amplitude;
+            amplitude *= settings.gain;
+            position = position * settings.lacunarity;
+        }
+        return sum / total;
+    }
+
+    /* ---------------------------- Plain glm ---------------------------- */
+
+    size_t points_2d_scalar(const NoiseSettings &settings, const float *x, const float *y, float *out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++) out[i] = fractal_noise(settings, glm::vec2(x[i], y[i]));
+        return count;
+    }
+
+    size_t points_3d_scalar(const NoiseSettings &settings, const float *x, const float *y, const float *z, float *out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++) out[i] = fractal_noise(settings, glm::vec3(x[i], y[i], z[i]));
+        return count;
+    }
+
+    size_t row_2d_scalar(const NoiseSettings &settings, float origin_x, float spacing_x, float y, float *out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++) out[i] = fractal_noise(settings, glm::vec2(origin_x + spacing_x * (float) i, y));
+        return count;
+    }
+
+    size_t row_3d_scalar(const NoiseSettings &settings, float origin_x, float spacing_x, float y, float z, float *out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++) out[i] = fractal_noise(settings, glm::vec3(origin_x + spacing_x * (float) i, y, z));
+        return count;
+    }
+
+    const Kernels SCALAR_KERNELS = { points_2d_scalar, points_3d_scalar, row_2d_scalar, row_3d_scalar };
+
+#ifdef NOISE_FIELD_X86
+    /* ------------------------------- SSE2 ------------------------------ */
+
+    namespace sse2
+    {
+        typedef __m128 Lanes;
+        typedef __m128 Mask;
+        const size_t LANE_COUNT = 4;
+
+        inline Lanes load(const float *p)               { return _mm_loadu_ps(p); }
+        inline void  store(float *p, Lanes v)           { _mm_storeu_ps(p, v); }
+        inline Lanes broadcast(float f)                 { return _mm_set1_ps(f); }
+        inline Lanes lane_offsets()                     { return _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f); }
+        inline Lanes add(Lanes a, Lanes b)              { return _mm_add_ps(a, b); }
+        inline Lanes sub(Lanes a, Lanes b)              { return _mm_sub_ps(a, b); }
+        inline Lanes mul(Lanes a, Lanes b)              { return _mm_mul_ps(a, b); }
+        inline Lanes div(Lanes a, Lanes b)              { return _mm_div_ps(a, b); }
+        inline Lanes mul_add(Lanes a, Lanes b, Lanes c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+        inline Lanes absolute(Lanes a)                  { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+        inline Lanes minimum(Lanes a, Lanes b)          { return _mm_min_ps(b, a); } // glm::min: b < a ? b : a
+        inline Lanes maximum(Lanes a, Lanes b)          { return _mm_max_ps(b, a); } // glm::max: a < b ? b : a
+        inline Mask  less(Lanes a, Lanes b)             { return _mm_cmplt_ps(a, b); }
+        inline Mask  greater(Lanes a, Lanes b)          { return _mm_cmpgt_ps(a, b); }
+        inline Lanes blend(Mask m, Lanes if_set, Lanes if_clear)
+        {
+            return _mm_or_ps(_mm_and_ps(m, if_set), _mm_andnot_ps(m, if_clear));
+        }
+
+        // std::floor without SSE4.1: truncate, step down where that rounded
+        // up, and keep the sign so floor(-0) stays -0. From 2^23 on every
+        // float is already whole (and would overflow the conversion).
+        inline Lanes round_down(Lanes x)
+        {
+            Lanes truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+            Lanes floored   = _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, x), _mm_set1_ps(1.0f)));
+            floored = _mm_or_ps(floored, _mm_and_ps(x, _mm_set1_ps(-0.0f)));
+            return blend(_mm_cmplt_ps(absolute(x), _mm_set1_ps(8388608.0f)), floored, x);
+        }
+
+        #include "NoiseFieldKernels.inl"
+    }
+
+    /* ------------------------ AVX2, deterministic ---------------------- */
+
+#if defined(__clang__)
+    #pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__GNUC__)
+    #pragma GCC push_options
+    #pragma GCC target("avx2")
+#endif
+
+    namespace avx2
+    {
+        typedef __m256 Lanes;
+        typedef __m256 Mask;
+        const size_t LANE_COUNT = 8;
+
+        inline Lanes load(const float *p)               { return _mm256_loadu_ps(p); }
+        inline void  store(float *p, Lanes v)           { _mm256_storeu_ps(p, v); }
+        inline Lanes broadcast(float f)                 { return _mm256_set1_ps(f); }
+        inline Lanes lane_offsets()                     { return _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f); }
+        inline Lanes add(Lanes a, Lanes b)              { return _mm256_add_ps(a, b); }
+        inline Lanes sub(Lanes a, Lanes b)              { return _mm256_sub_ps(a, b); }
+        inline Lanes mul(Lanes a, Lanes b)              { return _mm256_mul_ps(a, b); }
+        inline Lanes div(Lanes a, Lanes b)              { return _mm256_div_ps(a, b); }
+        inline Lanes mul_add(Lanes a, Lanes b, Lanes c) { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+        inline Lanes round_down(Lanes a)                { return _mm256_round_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+        inline Lanes absolute(Lanes a)                  { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+        inline Lanes minimum(Lanes a, Lanes b)          { return _mm256_min_ps(b, a); }
+        inline Lanes maximum(Lanes a, Lanes b)          { return _mm256_max_ps(b, a); }
+        inline Mask  less(Lanes a, Lanes b)             { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+        inline Mask  greater(Lanes a, Lanes b)          { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+        inline Lanes blend(Mask m, Lanes if_set, Lanes if_clear) { return _mm256_blendv_ps(if_clear, if_set, m); }
+
+        #include "NoiseFieldKernels.inl"
+    }
+
+#if defined(__clang__)
+    #pragma clang attribute pop
+#elif defined(__GNUC__)
+    #pragma GCC pop_options
+#endif
+
+    /* --------------------------- AVX2 + FMA ---------------------------- */
+
+#if defined(__clang__)
+    #pragma clang attribute push(__attribute__((target("avx2,fma"))), apply_to = function)
+#elif defined(__GNUC__)
+    #pragma GCC push_options
+    #pragma GCC target("avx2,fma")
+    #pragma GCC optimize("fp-contract=off")
+#endif
+
+    namespace avx2_fma
+    {
+        using avx2::Lanes;
+        using avx2::Mask;
+        const size_t LANE_COUNT = 8;
+
+        inline Lanes load(const float *p)               { return _mm256_loadu_ps(p); }
+        inline void  store(float *p, Lanes v)           { _mm256_storeu_ps(p, v); }
+        inline Lanes broadcast(float f)                 { return _mm256_set1_ps(f); }
+        inline Lanes lane_offsets()                     { return _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f); }
+        inline Lanes add(Lanes a, Lanes b)              { return _mm256_add_ps(a, b); }
+        inline Lanes sub(Lanes a, Lanes b)              { return _mm256_sub_ps(a, b); }
+        inline Lanes mul(Lanes a, Lanes b)              { return _mm256_mul_ps(a, b); }
+        inline Lanes div(Lanes a, Lanes b)              { return _mm256_div_ps(a, b); }
+        inline Lanes mul_add(Lanes a, Lanes b, Lanes c) { return _mm256_fmadd_ps(a, b, c); }
+        inline Lanes round_down(Lanes a)                { return _mm256_round_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+        inline Lanes absolute(Lanes a)                  { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+        inline Lanes minimum(Lanes a, Lanes b)          { return _mm256_min_ps(b, a); }
+        inline Lanes maximum(Lanes a, Lanes b)          { return _mm256_max_ps(b, a); }
+        inline Mask  less(Lanes a, Lanes b)             { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+        inline Mask  greater(Lanes a, Lanes b)          { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+        inline Lanes blend(Mask m, Lanes if_set, Lanes if_clear) { return _mm256_blendv_ps(if_clear, if_set, m); }
+
+        #include "NoiseFieldKernels.inl"
+    }
+
+#if defined(__clang__)
+    #pragma clang attribute pop
+#elif defined(__GNUC__)
+    #pragma GCC pop_options
+#endif
+
+    /* ------------------------------ AVX-512 ---------------------------- */
+
+#if defined(__clang__)
+    #pragma clang attribute push(__attribute__((target("avx512f"))), apply_to = function)
+#elif defined(__GNUC__)
+    #pragma GCC push_options
+    #pragma GCC target("avx512f")
+    #pragma GCC optimize("fp-contract=off")
+#endif
+
+    namespace avx512
+    {
+        typedef __m512    Lanes;
+        typedef __mmask16 Mask;
+        const size_t LANE_COUNT = 16;
+
+        inline Lanes load(const float *p)               { return _mm512_loadu_ps(p); }
+        inline void  store(float *p, Lanes v)           { _mm512_storeu_ps(p, v); }
+        inline Lanes broadcast(float f)                 { return _mm512_set1_ps(f); }
+        inline Lanes lane_offsets()
+        {
+            return _mm512_set_ps(15.0f, 14.0f, 13.0f, 12.0f, 11.0f, 10.0f, 9.0f, 8.0f, 7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f);
+        }
+        inline Lanes add(Lanes a, Lanes b)              { return _mm512_add_ps(a, b); }
+        inline Lanes sub(Lanes a, Lanes b)              { return _mm512_sub_ps(a, b); }
+        inline Lanes mul(Lanes a, Lanes b)              { return _mm512_mul_ps(a, b); }
+        inline Lanes div(Lanes a, Lanes b)              { return _mm512_div_ps(a, b); }
+        inline Lanes mul_add(Lanes a, Lanes b, Lanes c) { return _mm512_fmadd_ps(a, b, c); }
+        inline Lanes round_down(Lanes a)                { return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+        inline Lanes absolute(Lanes a)                  { return _mm512_abs_ps(a); }
+        inline Lanes minimum(Lanes a, Lanes b)          { return _mm512_min_ps(b, a); }
+        inline Lanes maximum(Lanes a, Lanes b)          { return _mm512_max_ps(b, a); }
+        inline Mask  less(Lanes a, Lanes b)             { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+        inline Mask  greater(Lanes a, Lanes b)          { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+        inline Lanes blend(Mask m, Lanes if_set, Lanes if_clear) { return _mm512_mask_blend_ps(m, if_clear, if_set); }
+
+        #include "NoiseFieldKernels.inl"
+    }
+
+#if defined(__clang__)
+    #pragma clang attribute pop
+#elif defined(__GNUC__)
+    #pragma GCC pop_options
+#endif
+#endif
+
+    // Deterministic mode stops at AVX2 without FMA: AVX-512F implies FMA
+    // for some compilers, which may then contract a separate multiply and add
+    const Kernels &kernels(bool deterministic)
+    {
+        switch (get_matrix_batch_isa())
+        {
+#ifdef NOISE_FIELD_X86
+            case MATRIX_BATCH_AVX512: return deterministic ? avx2::KERNELS : avx512::KERNELS;
+            case MATRIX_BATCH_AVX2:   return deterministic ? avx2::KERNELS : avx2_fma::KERNELS;
+            case MATRIX_BATCH_SSE2:   return sse2::KERNELS;
+#endif
+            default:                  return SCALAR_KERNELS;
+        }
+    }
+
+    // Runs job_count jobs covering samples samples between them
+    template <typename Job>
+    void run_jobs(unsigned thread_count, size_t job_count, size_t samples, Job job)
+    {
+        run_parallel_jobs(parallel_thread_count(thread_count, samples, MIN_SAMPLES_PER_THREAD), job_count, job);
+    }
+}
+
+float noise_sample(const NoiseSettings &settings, glm::vec2 position)
+{
+    return fractal_noise(settings, position);
+}
+
+float noise_sample(const NoiseSettings &settings, glm::vec3 position)
+{
+    return fractal_noise(settings, position);
+}
+
+void noise_points(const NoiseSettings &settings, const float *x, const float *y, float *out, size_t count)
+{
+    const Kernels &selected = kernels(settings.deterministic);
+    run_jobs(settings.thread_count, (count + POINTS_PER_JOB - 1) / POINTS_PER_JOB, count, [&](size_t job)
+    {
+        size_t first = job * POINTS_PER_JOB, length = std::min(POINTS_PER_JOB, count - first);
+        size_t done  = selected.points_2d(settings, x + first, y + first, out + first, length);
+        first += done;
+        points_2d_scalar(settings, x + first, y + first, out + first, length - done);
+    });
+}
+
+void noise_points(const NoiseSettings &settings, const float *x, const float *y, const float *z, float *out, size_t count)
+{
+    const Kernels &selected = kernels(settings.deterministic);
+    run_jobs(settings.thread_count, (count + POINTS_PER_JOB - 1) / POINTS_PER_JOB, count, [&](size_t job)
+    {
+        size_t first = job * POINTS_PER_JOB, length = std::min(POINTS_PER_JOB, count - first);
+        size_t done  = selected.points_3d(settings, x + first, y + first, z + first, out + first, length);
+        first += done;
+        points_3d_scalar(settings, x + first, y + first, z + first, out + first, length - done);
+    });
+}
+
+void noise_grid(const NoiseSettings &settings, glm::vec2 origin, glm::vec2 spacing, int width, int height, float *out)
+{
+    if (width <= 0 || height <= 0) return;
+
+    const Kernels &selected = kernels(settings.deterministic);
+    run_jobs(settings.thread_count, (size_t) height, (size_t) width * height, [&](size_t row)
+    {
+        float  y      = origin.y + spacing.y * (float) row;
+        float *target = out + row * width;
+        size_t done   = selected.row_2d(settings, origin.x, spacing.x, y, target, (size_t) width);
+        for (size_t column = done; column < (size_t) width; column++)
+        {
+            target[column] = fractal_noise(settings, origin + spacing * glm::vec2((float) column, (float) row));
+        }
+    });
+}
+
+void noise_grid(const NoiseSettings &settings, glm::vec3 origin, glm::vec3 spacing, int width, int height, int depth,
+                float *out)
+{
+    if (width <= 0 || height <= 0 || depth <= 0) return;
+
+    const Kernels &selected = kernels(settings.deterministic);
+    run_jobs(settings.thread_count, (size_t) height * depth, (size_t) width * height * depth, [&](size_t job)
+    {
+        size_t row = job % height, slice = job / height;
+        float  y      = origin.y + spacing.y * (float) row,
+               z      = origin.z + spacing.z * (float) slice;
+        float *target = out + job * width;
+        size_t done   = selected.row_3d(settings, origin.x, spacing.x, y, z, target, (size_t) width);
+        for (size_t column = done; column < (size_t) width; column++)
+        {
+            target[column] = fractal_noise(settings, origin + spacing * glm::vec3((float) column, (float) row, (float) slice));
+        }
+    });
+}
@@ -0,0 +1,364 @@
+/**
+ * @file NoiseFieldKernels.inl
+ * @brief glm's Perlin and simplex noise with one sample per lane. NoiseField.cpp
+ * includes this file once per instruction set, inside a namespace that
+ * defines Lanes, Mask, LANE_COUNT and the lane operations (load, store,
+ * broadcast, lane_offsets, add, sub, mul, div, mul_add, round_down, absolute,
+ * minimum, maximum, less, greater, blend).
+ *
+ * Every step follows gtc/noise.inl operation for operation, in the same order,
+ * so that where mul_add is a separate multiply and add the result matches
+ * glm bit for bit. glm's vec4s hold the four corners of one sample; here each
+ * corner gets its own registers instead. Every entry point stops after the
+ * last whole block and returns how many samples it wrote.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+inline Lanes dot(Lanes ax, Lanes ay, Lanes bx, Lanes by)
+{
+    return mul_add(ax, bx, mul(ay, by));
+}
+
+inline Lanes dot(Lanes ax, Lanes ay, Lanes az, Lanes bx, Lanes by, Lanes bz)
+{
+    return mul_add(az, bz, mul_add(ax, bx, mul(ay, by)));
+}
+
+// The skew to the simplex lattice and back, never fused: x - floor(x + skew)
+// + unskew cancels all but the fraction, so one rounding of the sum's
+// magnitude more or less there would be an error proportional to |x|
+inline Lanes separate_dot(Lanes ax, Lanes ay, Lanes bx, Lanes by)
+{
+    return add(mul(ax, bx), mul(ay, by));
+}
+
+inline Lanes separate_dot(Lanes ax, Lanes ay, Lanes az, Lanes bx, Lanes by, Lanes bz)
+{
+    return add(add(mul(ax, bx), mul(ay, by)), mul(az, bz));
+}
+
+inline Lanes fract(Lanes x)
+{
+    return sub(x, round_down(x));
+}
+
+// glm::mod(x, 289), which divides
+inline Lanes mod_289_divide(Lanes x)
+{
+    return sub(x, mul(broadcast(289.0f), round_down(div(x, broadcast(289.0f)))));
+}
+
+// glm::detail::mod289, which multiplies by the reciprocal
+inline Lanes mod289(Lanes x)
+{
+    return sub(x, mul(round_down(mul(x, broadcast(1.0f / 289.0f))), broadcast(289.0f)));
+}
+
+inline Lanes permute(Lanes x)
+{
+    return mod289(mul(mul_add(x, broadcast(34.0f), broadcast(1.0f)), x));
+}
+
+inline Lanes taylor_inv_sqrt(Lanes r)
+{
+    return sub(broadcast(1.79284291400159f), mul(broadcast(0.85373472095314f), r));
+}
+
+inline Lanes fade(Lanes t)
+{
+    return mul(mul(mul(t, t), t), mul_add(t, mul_add(t, broadcast(6.0f), broadcast(-15.0f)), broadcast(10.0f)));
+}
+
+inline Lanes mix(Lanes x, Lanes y, Lanes a)
+{
+    return mul_add(x, sub(broadcast(1.0f), a), mul(y, a));
+}
+
+// glm::step(edge, x)
+inline Lanes step(Lanes edge, Lanes x)
+{
+    return blend(less(x, edge), broadcast(0.0f), broadcast(1.0f));
+}
+
+/* ------------------------------ Perlin ----------------------------- */
+
+// One corner's gradient, dotted with the offset to the sample
+inline Lanes perlin_corner_2d(Lanes ix, Lanes iy, Lanes fx, Lanes fy)
+{
+    Lanes i  = permute(add(permute(ix), iy));
+    Lanes gx = mul_add(broadcast(2.0f), fract(div(i, broadcast(41.0f))), broadcast(-1.0f));
+    Lanes gy = sub(absolute(gx), broadcast(0.5f));
+    gx = sub(gx, round_down(add(gx, broadcast(0.5f))));
+
+    Lanes norm = taylor_inv_sqrt(dot(gx, gy, gx, gy));
+    return dot(mul(gx, norm), mul(gy, norm), fx, fy);
+}
+
+inline Lanes perlin(Lanes x, Lanes y)
+{
+    Lanes zero = broadcast(0.0f), one = broadcast(1.0f);
+    Lanes floor_x = round_down(x), floor_y = round_down(y);
+
+    // Adding zero is not a no-op: it turns floor(-0.5) = -0 into +0, as glm's does
+    Lanes ix0 = mod_289_divide(add(floor_x, zero)), iy0 = mod_289_divide(add(floor_y, zero)),
+          ix1 = mod_289_divide(add(floor_x, one)),  iy1 = mod_289_divide(add(floor_y, one));
+    Lanes fx0 = fract(x), fy0 = fract(y),
+          fx1 = sub(fx0, one), fy1 = sub(fy0, one);
+
+    Lanes n00 = perlin_corner_2d(ix0, iy0, fx0, fy0),
+          n10 = perlin_corner_2d(ix1, iy0, fx1, fy0),
+          n01 = perlin_corner_2d(ix0, iy1, fx0, fy1),
+          n11 = perlin_corner_2d(ix1, iy1, fx1, fy1);
+
+    Lanes fade_x = fade(fx0), fade_y = fade(fy0);
+    return mul(broadcast(2.3f), mix(mix(n00, n10, fade_x), mix(n01, n11, fade_x), fade_y));
+}
+
+inline Lanes perlin_corner_3d(Lanes hash, Lanes fx, Lanes fy, Lanes fz)
+{
+    Lanes zero = broadcast(0.0f), half = broadcast(0.5f), seventh = broadcast((float) (1.0 / 7.0));
+
+    Lanes gx = mul(hash, seventh);
+    Lanes gy = sub(fract(mul(round_down(gx), seventh)), half);
+    gx = fract(gx);
+    Lanes gz = sub(sub(half, absolute(gx)), absolute(gy));
+
+    // Gradients outside the octahedron fold back onto it
+    Lanes outside = step(gz, zero);
+    gx = sub(gx, mul(outside, sub(step(zero, gx), half)));
+    gy = sub(gy, mul(outside, sub(step(zero, gy), half)));
+
+    Lanes norm = taylor_inv_sqrt(dot(gx, gy, gz, gx, gy, gz));
+    return dot(mul(gx, norm), mul(gy, norm), mul(gz, norm), fx, fy, fz);
+}
+
+inline Lanes perlin(Lanes x, Lanes y, Lanes z)
+{
+    Lanes one = broadcast(1.0f);
+    Lanes floor_x = round_down(x), floor_y = round_down(y), floor_z = round_down(z);
+
+    Lanes ix0 = mod289(floor_x), ix1 = mod289(add(floor_x, one)),
+          iy0 = mod289(floor_y), iy1 = mod289(add(floor_y, one)),
+          iz0 = mod289(floor_z), iz1 = mod289(add(floor_z, one));
+    Lanes fx0 = fract(x), fx1 = sub(fx0, one),
+          fy0 = fract(y), fy1 = sub(fy0, one),
+          fz0 = fract(z), fz1 = sub(fz0, one);
+
+    Lanes ixy00 = permute(add(permute(ix0), iy0)), ixy10 = permute(add(permute(ix1), iy0)),
+          ixy01 = permute(add(permute(ix0), iy1)), ixy11 = permute(add(permute(ix1), iy1));
+
+    Lanes n000 = perlin_corner_3d(permute(add(ixy00, iz0)), fx0, fy0, fz0),
+          n100 = perlin_corner_3d(permute(add(ixy10, iz0)), fx1, fy0, fz0),
+          n010 = perlin_corner_3d(permute(add(ixy01, iz0)), fx0, fy1, fz0),
+          n110 = perlin_corner_3d(permute(add(ixy11, iz0)), fx1, fy1, fz0),
+          n001 = perlin_corner_3d(permute(add(ixy00, iz1)), fx0, fy0, fz1),
+          n101 = perlin_corner_3d(permute(add(ixy10, iz1)), fx1, fy0, fz1),
+          n011 = perlin_corner_3d(permute(add(ixy01, iz1)), fx0, fy1, fz1),
+          n111 = perlin_corner_3d(permute(add(ixy11, iz1)), fx1, fy1, fz1);
+
+    Lanes fade_x = fade(fx0), fade_y = fade(fy0), fade_z = fade(fz0);
+    Lanes n_z00 = mix(n000, n001, fade_z), n_z10 = mix(n100, n101, fade_z),
+          n_z01 = mix(n010, n011, fade_z), n_z11 = mix(n110, n111, fade_z);
+    return mul(broadcast(2.2f), mix(mix(n_z00, n_z01, fade_y), mix(n_z10, n_z11, fade_y), fade_x));
+}
+
+/* ------------------------------ Simplex ---------------------------- */
+
+// One corner's falloff-weighted gradient term
+inline Lanes simplex_corner_2d(Lanes hash, Lanes x, Lanes y)
+{
+    Lanes m = maximum(sub(broadcast(0.5f), dot(x, y, x, y)), broadcast(0.0f));
+    m = mul(m, m);
+    m = mul(m, m);
+
+    // 41 gradients along a line, mapped onto a diamond
+    Lanes gx = mul_add(broadcast(2.0f), fract(mul(hash, broadcast(0.024390243902439f))), broadcast(-1.0f));
+    Lanes h  = sub(absolute(gx), broadcast(0.5f));
+    Lanes a0 = sub(gx, round_down(add(gx, broadcast(0.5f))));
+
+    m = mul(m, taylor_inv_sqrt(mul_add(a0, a0, mul(h, h))));
+    return mul(m, dot(a0, h, x, y));
+}
+
+inline Lanes simplex(Lanes x, Lanes y)
+{
+    const float C0 = 0.211324865405187f, C1 = 0.366025403784439f, C2 = -0.577350269189626f;
+    Lanes zero = broadcast(0.0f), one = broadcast(1.0f);
+
+    // Skew to the simplex lattice, and back
+    Lanes skew = separate_dot(x, y, broadcast(C1), broadcast(C1));
+    Lanes ix = round_down(add(x, skew)), iy = round_down(add(y, skew));
+    Lanes unskew = separate_dot(ix, iy, broadcast(C0), broadcast(C0));
+    Lanes x0 = add(sub(x, ix), unskew), y0 = add(sub(y, iy), unskew);
+
+    Mask  lower = greater(x0, y0);
+    Lanes i1x = blend(lower, one, zero), i1y = blend(lower, zero, one);
+    Lanes x1 = sub(add(x0, broadcast(C0)), i1x), y1 = sub(add(y0, broadcast(C0)), i1y);
+    Lanes x2 = add(x0, broadcast(C2)),           y2 = add(y0, broadcast(C2));
+
+    ix = mod_289_divide(ix);
+    iy = mod_289_divide(iy);
+    Lanes p0 = permute(add(add(permute(add(iy, zero)), ix), zero)),
+          p1 = permute(add(add(permute(add(iy, i1y)), ix), i1x)),
+          p2 = permute(add(add(permute(add(iy, one)), ix), one));
+
+    Lanes sum = add(add(simplex_corner_2d(p0, x0, y0), simplex_corner_2d(p1, x1, y1)), simplex_corner_2d(p2, x2, y2));
+    return mul(broadcast(130.0f), sum);
+}
+
+inline Lanes simplex_corner_3d(Lanes hash, Lanes x, Lanes y, Lanes z)
+{
+    // 7x7 gradients over a square, mapped onto an octahedron
+    const float N = 0.142857142857f;
+    Lanes ns_x = broadcast(N * 2.0f - 0.0f), ns_y = broadcast(N * 0.5f - 1.0f), ns_z = broadcast(N * 1.0f - 0.0f);
+    Lanes zero = broadcast(0.0f), one = broadcast(1.0f), two = broadcast(2.0f);
+
+    Lanes j  = sub(hash, mul(broadcast(49.0f), round_down(mul(mul(hash, ns_z), ns_z))));
+    Lanes xi = round_down(mul(j, ns_z));
+    Lanes yi = round_down(sub(j, mul(broadcast(7.0f), xi)));
+
+    Lanes gx = mul_add(xi, ns_x, ns_y), gy = mul_add(yi, ns_x, ns_y);
+    Lanes h  = sub(sub(one, absolute(gx)), absolute(gy));
+
+    Lanes sign_x = mul_add(round_down(gx), two, one), sign_y = mul_add(round_down(gy), two, one);
+    Lanes fold   = sub(zero, step(h, zero));
+    gx = mul_add(sign_x, fold, gx);
+    gy = mul_add(sign_y, fold, gy);
+
+    Lanes norm = taylor_inv_sqrt(dot(gx, gy, h, gx, gy, h));
+    Lanes m = maximum(sub(broadcast(0.6f), dot(x, y, z, x, y, z)), zero);
+    m = mul(m, m);
+    return mul(mul(m, m), dot(mul(gx, norm), mul(gy, norm), mul(h, norm), x, y, z));
+}
+
+inline Lanes simplex(Lanes x, Lanes y, Lanes z)
+{
+    const float CX = (float) (1.0 / 6.0), CY = (float) (1.0 / 3.0);
+    Lanes zero = broadcast(0.0f), one = broadcast(1.0f);
+
+    Lanes skew = separate_dot(x, y, z, broadcast(CY), broadcast(CY), broadcast(CY));
+    Lanes ix = round_down(add(x, skew)), iy = round_down(add(y, skew)), iz = round_down(add(z, skew));
+    Lanes unskew = separate_dot(ix, iy, iz, broadcast(CX), broadcast(CX), broadcast(CX));
+    Lanes x0 = add(sub(x, ix), unskew), y0 = add(sub(y, iy), unskew), z0 = add(sub(z, iz), unskew);
+
+    // Which of the six tetrahedra the sample is in
+    Lanes gx = step(y0, x0), gy = step(z0, y0), gz = step(x0, z0);
+    Lanes lx = sub(one, gx), ly = sub(one, gy), lz = sub(one, gz);
+    Lanes i1x = minimum(gx, lz), i1y = minimum(gy, lx), i1z = minimum(gz, ly);
+    Lanes i2x = maximum(gx, lz), i2y = maximum(gy, lx), i2z = maximum(gz, ly);
+
+    Lanes x1 = add(sub(x0, i1x), broadcast(CX)), y1 = add(sub(y0, i1y), broadcast(CX)), z1 = add(sub(z0, i1z), broadcast(CX));
+    Lanes x2 = add(sub(x0, i2x), broadcast(CY)), y2 = add(sub(y0, i2y), broadcast(CY)), z2 = add(sub(z0, i2z), broadcast(CY));
+    Lanes x3 = sub(x0, broadcast(0.5f)),         y3 = sub(y0, broadcast(0.5f)),         z3 = sub(z0, broadcast(0.5f));
+
+    ix = mod289(ix);
+    iy = mod289(iy);
+    iz = mod289(iz);
+    Lanes p0 = permute(add(add(permute(add(add(permute(add(iz, zero)), iy), zero)), ix), zero)),
+          p1 = permute(add(add(permute(add(add(permute(add(iz, i1z)), iy), i1y)), ix), i1x)),
+          p2 = permute(add(add(permute(add(add(permute(add(iz, i2z)), iy), i2y)), ix), i2x)),
+          p3 = permute(add(add(permute(add(add(permute(add(iz, one)), iy), one)), ix), one));
+
+    Lanes sum = add(add(simplex_corner_3d(p0, x0, y0, z0), simplex_corner_3d(p1, x1, y1, z1)),
+                    add(simplex_corner_3d(p2, x2, y2, z2), simplex_corner_3d(p3, x3, y3, z3)));
+    return mul(broadcast(42.0f), sum);
+}
+
+/* ------------------------------ Fractals --------------------------- */
+
+inline Lanes shape_octave(NoiseFractal fractal, Lanes n)
+{
+    if (fractal != FRACTAL_RIDGED) return n;
+    Lanes ridge = sub(broadcast(1.0f), absolute(n));
+    return mul(ridge, ridge);
+}
+
+inline Lanes fractal_noise(const NoiseSettings &settings, Lanes x, Lanes y)
+{
+    Lanes frequency = broadcast(settings.frequency), lacunarity = broadcast(settings.lacunarity);
+    x = mul(x, frequency);
+    y = mul(y, frequency);
+    if (settings.fractal == FRACTAL_NONE) return settings.basis == NOISE_PERLIN ? perlin(x, y) : simplex(x, y);
+
+    Lanes sum = broadcast(0.0f);
+    float amplitude = 1.0f, total = 0.0f;
+    for (int octave = 0; octave < octave_count(settings); octave++)
+    {
+        Lanes n = settings.basis == NOISE_PERLIN ? perlin(x, y) : simplex(x, y);
+        sum = mul_add(broadcast(amplitude), shape_octave(settings.fractal, n), sum);
+        total += amplitude;
+        amplitude *= settings.gain;
+        x = mul(x, lacunarity);
+        y = mul(y, lacunarity);
+    }
+    return div(sum, broadcast(total));
+}
+
+inline Lanes fractal_noise(const NoiseSettings &settings, Lanes x, Lanes y, Lanes z)
+{
+    Lanes frequency = broadcast(settings.frequency), lacunarity = broadcast(settings.lacunarity);
+    x = mul(x, frequency);
+    y = mul(y, frequency);
+    z = mul(z, frequency);
+    if (settings.fractal == FRACTAL_NONE) return settings.basis == NOISE_PERLIN ? perlin(x, y, z) : simplex(x, y, z);
+
+    Lanes sum = broadcast(0.0f);
+    float amplitude = 1.0f, total = 0.0f;
+    for (int octave = 0; octave < octave_count(settings); octave++)
+    {
+        Lanes n = settings.basis == NOISE_PERLIN ? perlin(x, y, z) : simplex(x, y, z);
+        sum = mul_add(broadcast(amplitude), shape_octave(settings.fractal, n), sum);
+        total += amplitude;
+        amplitude *= settings.gain;
+        x = mul(x, lacunarity);
+        y = mul(y, lacunarity);
+        z = mul(z, lacunarity);
+    }
+    return div(sum, broadcast(total));
+}
+
+/* ---------------------------- Entry points ------------------------- */
+
+size_t points_2d(const NoiseSettings &settings, const float *x, const float *y, float *out, size_t count)
+{
+    size_t i = 0;
+    for (; i + LANE_COUNT <= count; i += LANE_COUNT) store(out + i, fractal_noise(settings, load(x + i), load(y + i)));
+    return i;
+}
+
+size_t points_3d(const NoiseSettings &settings, const float *x, const float *y, const float *z, float *out, size_t count)
+{
+    size_t i = 0;
+    for (; i + LANE_COUNT <= count; i += LANE_COUNT) store(out + i, fractal_noise(settings, load(x + i), load(y + i), load(z + i)));
+    return i;
+}
+
+// x = origin_x + spacing_x * column, as glm's vec2 arithmetic computes it:
+// fused, the sample would move by up to half an ulp of x
+size_t row_2d(const NoiseSettings &settings, float origin_x, float spacing_x, float y, float *out, size_t count)
+{
+    size_t i = 0;
+    for (; i + LANE_COUNT <= count; i += LANE_COUNT)
+    {
+        Lanes column = add(broadcast((float) i), lane_offsets());
+        Lanes x      = add(broadcast(origin_x), mul(broadcast(spacing_x), column));
+        store(out + i, fractal_noise(settings, x, broadcast(y)));
+    }
+    return i;
+}
+
+size_t row_3d(const NoiseSettings &settings, float origin_x, float spacing_x, float y, float z, float *out, size_t count)
+{
+    size_t i = 0;
+    for (; i + LANE_COUNT <= count; i += LANE_COUNT)
+    {
+        Lanes column = add(broadcast((float) i), lane_offsets());
+        Lanes x      = add(broadcast(origin_x), mul(broadcast(spacing_x), column));
+        store(out + i, fractal_noise(settings, x, broadcast(y), broadcast(z)));
+    }
+    return i;
+}
+
+const Kernels KERNELS = { points_2d, points_3d, row_2d, row_3d };
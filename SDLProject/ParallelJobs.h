@@ -0,0 +1,56 @@
+/**
+ * @file ParallelJobs.h
+ * @brief Runs a batch of independent jobs on a few short-lived threads, the
+ * calling thread included. Jobs are handed out through a counter, so one
+ * slow job does not leave the other threads idle.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+/**
+ * How many threads to split items between: thread_count, or one per
+ * hardware thread for 0, cut so each gets at least min_items_per_thread.
+ * Starting a thread costs tens of microseconds, so below a module's minimum
+ * the thread costs more than its share of the work saves.
+ */
+inline unsigned parallel_thread_count(unsigned thread_count, size_t items, size_t min_items_per_thread)
+{
+    if (thread_count == 0) thread_count = std::max(1u, std::thread::hardware_concurrency());
+    return (unsigned) std::min<size_t>(thread_count, std::max<size_t>(1, items / min_items_per_thread));
+}
+
+/**
+ * Calls function(thread) for every thread in [0, thread_count), 0 on the
+ * calling thread and the rest on new threads, and returns once all have.
+ */
+template <typename Function>
+void run_on_threads(unsigned thread_count, Function function)
+{
+    std::vector<std::thread> workers;
+    for (unsigned thread = 1; thread < thread_count; thread++) workers.emplace_back(function, thread);
+    function(0u);
+    for (std::thread &worker : workers) worker.join();
+}
+
+/**
+ * Calls job(index) for every index in [0, job_count), on up to thread_count
+ * threads (0 is one per hardware thread). Jobs may run in any order.
+ */
+template <typename Job>
+void run_parallel_jobs(unsigned thread_count, size_t job_count, Job job)
+{
+    std::atomic<size_t> next_job(0);
+    run_on_threads(parallel_thread_count(thread_count, job_count, 1), [&](unsigned)
+    {
+        for (size_t index = next_job++; index < job_count; index = next_job++) job(index);
+    });
+}
@@ -0,0 +1,390 @@
+/**
+ * @file QuaternionBatch.cpp
+ * @brief Structure-of-arrays quaternion kernels. The wide kernels live in
+ * QuaternionBatchKernels.inl and are compiled once per instruction set, each
+ * copy inside a region whose target pragma matches its lane operations; the
+ * copy that runs is the one MatrixBatch's dispatch selected.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#include "QuaternionBatch.h"
+#include "MatrixBatch.h"
+#include "glm/glm.hpp"
+#include "glm/simd/trigonometric.h"
+#include <cfloat>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define QUATERNION_BATCH_X86 1
+    #include <immintrin.h>
+#endif
+
+static_assert(sizeof(glm::mat4) == 16 * sizeof(float), "batch kernels expect tightly packed matrices");
+
+namespace
+{
+    // Each returns how many elements it wrote. The wide kernels stop at the
+    // last whole block and the public functions finish with the scalar
+    // kernel, which keeps the tail out of the target regions: called from
+    // there, it would run SSE code with the upper register halves dirty.
+    typedef size_t (*BlendKernel)(ConstQuaternionArrays a, ConstQuaternionArrays b, const float *t, QuaternionArrays out, size_t count);
+    typedef size_t (*MultiplyKernel)(ConstQuaternionArrays a, ConstQuaternionArrays b, QuaternionArrays out, size_t count);
+    typedef size_t (*RotateKernel)(ConstQuaternionArrays q, ConstVec3Arrays v, Vec3Arrays out, size_t count);
+    typedef size_t (*MatrixKernel)(ConstQuaternionArrays q, float *out, size_t count);
+
+    struct Kernels
+    {
+        BlendKernel    nlerp;
+        BlendKernel    slerp;
+        BlendKernel    slerp_fast;
+        MultiplyKernel multiply;
+        RotateKernel   rotate;
+        MatrixKernel   to_matrix;
+    };
+
+    // glm::slerp switches to a plain lerp above this cosine, to avoid
+    // dividing by a vanishing sine
+    const float SLERP_LERP_THRESHOLD = 1.0f - glm::epsilon<float>();
+    const float HALF_PI = 1.57079632679489662f;
+
+    // Cephes asinf, accurate to about 1 ulp on [0, 1/2]
+    const float ASIN_P[5] = { 4.2163199048e-2f, 2.4181311049e-2f, 4.5470025998e-2f, 7.4953002686e-2f, 1.6666752422e-1f };
+
+    /*
+     * SLERP_FAST: Eberly, "A Fast and Accurate Algorithm for Computing SLERP".
+     * The slerp weights sin(t theta) / sin(theta) are expanded as a series in
+     * cos(theta) - 1; truncated after eight terms, with the last term scaled
+     * to spread the error over [0, pi/2]: within 2e-5 of the exact weights.
+     * u[k] = 1 / ((k + 1)(2k + 3)), v[k] = (k + 1) / (2k + 3).
+     */
+    const int   SLERP_TERMS = 8;
+    const float SLERP_MU    = 1.85298109240830f;
+    const float SLERP_U[SLERP_TERMS] = {
+        1.0f / (1 * 3), 1.0f / (2 * 5), 1.0f / (3 * 7),  1.0f / (4 * 9),
+        1.0f / (5 * 11), 1.0f / (6 * 13), 1.0f / (7 * 15), SLERP_MU / (8 * 17)
+    };
+    const float SLERP_V[SLERP_TERMS] = {
+        1.0f / 3, 2.0f / 5, 3.0f / 7,  4.0f / 9,
+        5.0f / 11, 6.0f / 13, 7.0f / 15, SLERP_MU * 8 / 17
+    };
+
+    ConstQuaternionArrays offset(ConstQuaternionArrays q, size_t i) { return ConstQuaternionArrays(q.w + i, q.x + i, q.y + i, q.z + i); }
+    QuaternionArrays      offset(QuaternionArrays q, size_t i)      { return { q.w + i, q.x + i, q.y + i, q.z + i }; }
+    ConstVec3Arrays       offset(ConstVec3Arrays v, size_t i)       { return ConstVec3Arrays(v.x + i, v.y + i, v.z + i); }
+    Vec3Arrays            offset(Vec3Arrays v, size_t i)            { return { v.x + i, v.y + i, v.z + i }; }
+
+    glm::quat get(ConstQuaternionArrays q, size_t i) { return glm::quat(q.w[i], q.x[i], q.y[i], q.z[i]); }
+
+    void put(QuaternionArrays q, size_t i, const glm::quat &value)
+    {
+        q.w[i] = value.w;
+        q.x[i] = value.x;
+        q.y[i] = value.y;
+        q.z[i] = value.z;
+    }
+
+    /* ---------------------------- Plain glm ---------------------------- */
+
+    size_t nlerp_scalar(ConstQuaternionArrays a, ConstQuaternionArrays b, const float *t, QuaternionArrays out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            glm::quat from = get(a, i), to = get(b, i);
+            if (glm::dot(from, to) < 0.0f) to = -to;
+            put(out, i, glm::normalize(from * (1.0f - t[i]) + to * t[i]));
+        }
+        return count;
+    }
+
+    size_t slerp_scalar(ConstQuaternionArrays a, ConstQuaternionArrays b, const float *t, QuaternionArrays out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++) put(out, i, glm::slerp(get(a, i), get(b, i), t[i]));
+        return count;
+    }
+
+    size_t slerp_fast_scalar(ConstQuaternionArrays a, ConstQuaternionArrays b, const float *t, QuaternionArrays out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            glm::quat from = get(a, i), to = get(b, i);
+            float cos_theta = glm::dot(from, to);
+            if (cos_theta < 0.0f)
+            {
+                to        = -to;
+                cos_theta = -cos_theta;
+            }
+
+            float weight = t[i], complement = 1.0f - weight;
+            float to_series = 1.0f, from_series = 1.0f;
+            for (int k = SLERP_TERMS - 1; k >= 0; k--)
+            {
+                to_series   = 1.0f + (SLERP_U[k] * weight * weight - SLERP_V[k]) * (cos_theta - 1.0f) * to_series;
+                from_series = 1.0f + (SLERP_U[k] * complement * complement - SLERP_V[k]) * (cos_theta - 1.0f) * from_series;
+            }
+            put(out, i, from * (complement * from_series) + to * (weight * to_series));
+        }
+        return count;
+    }
+
+    size_t multiply_scalar(ConstQuaternionArrays a, ConstQuaternionArrays b, QuaternionArrays out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++) put(out, i, get(a, i) * get(b, i));
+        return count;
+    }
+
+    size_t rotate_scalar(ConstQuaternionArrays q, ConstVec3Arrays v, Vec3Arrays out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            glm::vec3 rotated = get(q, i) * glm::vec3(v.x[i], v.y[i], v.z[i]);
+            out.x[i] = rotated.x;
+            out.y[i] = rotated.y;
+            out.z[i] = rotated.z;
+        }
+        return count;
+    }
+
+    size_t to_matrix_scalar(ConstQuaternionArrays q, float *out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++, out += 16)
+        {
+            glm::mat4 matrix = glm::mat4_cast(get(q, i));
+            std::memcpy(out, &matrix[0][0], sizeof(matrix));
+        }
+        return count;
+    }
+
+    const Kernels SCALAR_KERNELS = { nlerp_scalar, slerp_scalar, slerp_fast_scalar, multiply_scalar, rotate_scalar, to_matrix_scalar };
+
+#ifdef QUATERNION_BATCH_X86
+    /* ------------------------------- SSE2 ------------------------------ */
+
+    namespace sse2
+    {
+        typedef __m128 Lanes;
+        typedef __m128 Mask;
+        const size_t LANE_COUNT = 4;
+
+        inline Lanes load(const float *p)             { return _mm_loadu_ps(p); }
+        inline void  store(float *p, Lanes v)         { _mm_storeu_ps(p, v); }
+        inline Lanes broadcast(float f)               { return _mm_set1_ps(f); }
+        inline Lanes add(Lanes a, Lanes b)            { return _mm_add_ps(a, b); }
+        inline Lanes sub(Lanes a, Lanes b)            { return _mm_sub_ps(a, b); }
+        inline Lanes mul(Lanes a, Lanes b)            { return _mm_mul_ps(a, b); }
+        inline Lanes div(Lanes a, Lanes b)            { return _mm_div_ps(a, b); }
+        inline Lanes fmadd(Lanes a, Lanes b, Lanes c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+        inline Lanes square_root(Lanes a)             { return _mm_sqrt_ps(a); }
+        inline Lanes negate(Lanes a)                  { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+        inline Lanes absolute(Lanes a)                { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+        inline Lanes round_toward_zero(Lanes a)       { return _mm_cvtepi32_ps(_mm_cvttps_epi32(a)); }
+        inline Mask  less(Lanes a, Lanes b)           { return _mm_cmplt_ps(a, b); }
+        inline Mask  greater(Lanes a, Lanes b)        { return _mm_cmpgt_ps(a, b); }
+        inline Lanes blend(Mask m, Lanes if_set, Lanes if_clear)
+        {
+            return _mm_or_ps(_mm_and_ps(m, if_set), _mm_andnot_ps(m, if_clear));
+        }
+
+        // Writes lane i of a, b, c and d to out[16 * i .. 16 * i + 3]: one
+        // column of each of four consecutive matrices
+        inline void store_columns(float *out, Lanes a, Lanes b, Lanes c, Lanes d)
+        {
+            _MM_TRANSPOSE4_PS(a, b, c, d);
+            _mm_storeu_ps(out,      a);
+            _mm_storeu_ps(out + 16, b);
+            _mm_storeu_ps(out + 32, c);
+            _mm_storeu_ps(out + 48, d);
+        }
+
+        #include "QuaternionBatchKernels.inl"
+    }
+
+    /* ---------------------------- AVX2 + FMA --------------------------- */
+
+#if defined(__clang__)
+    #pragma clang attribute push(__attribute__((target("avx2,fma"))), apply_to = function)
+#elif defined(__GNUC__)
+    #pragma GCC push_options
+    #pragma GCC target("avx2,fma")
+#endif
+
+    namespace avx2
+    {
+        typedef __m256 Lanes;
+        typedef __m256 Mask;
+        const size_t LANE_COUNT = 8;
+
+        inline Lanes load(const float *p)             { return _mm256_loadu_ps(p); }
+        inline void  store(float *p, Lanes v)         { _mm256_storeu_ps(p, v); }
+        inline Lanes broadcast(float f)               { return _mm256_set1_ps(f); }
+        inline Lanes add(Lanes a, Lanes b)            { return _mm256_add_ps(a, b); }
+        inline Lanes sub(Lanes a, Lanes b)            { return _mm256_sub_ps(a, b); }
+        inline Lanes mul(Lanes a, Lanes b)            { return _mm256_mul_ps(a, b); }
+        inline Lanes div(Lanes a, Lanes b)            { return _mm256_div_ps(a, b); }
+        inline Lanes fmadd(Lanes a, Lanes b, Lanes c) { return _mm256_fmadd_ps(a, b, c); }
+        inline Lanes square_root(Lanes a)             { return _mm256_sqrt_ps(a); }
+        inline Lanes negate(Lanes a)                  { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+        inline Lanes absolute(Lanes a)                { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+        inline Lanes round_toward_zero(Lanes a)       { return _mm256_round_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+        inline Mask  less(Lanes a, Lanes b)           { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+        inline Mask  greater(Lanes a, Lanes b)        { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+        inline Lanes blend(Mask m, Lanes if_set, Lanes if_clear) { return _mm256_blendv_ps(if_clear, if_set, m); }
+
+        // Lane i of a, b, c and d goes to out[16 * i .. 16 * i + 3]; the
+        // in-lane transpose leaves matrices 0-3 in the low halves and 4-7 in
+        // the high halves
+        inline void store_columns(float *out, Lanes a, Lanes b, Lanes c, Lanes d)
+        {
+            __m256 ab_low  = _mm256_unpacklo_ps(a, b), ab_high = _mm256_unpackhi_ps(a, b),
+                   cd_low  = _mm256_unpacklo_ps(c, d), cd_high = _mm256_unpackhi_ps(c, d);
+            __m256 r0 = _mm256_shuffle_ps(ab_low, cd_low, 0x44),   r1 = _mm256_shuffle_ps(ab_low, cd_low, 0xEE),
+                   r2 = _mm256_shuffle_ps(ab_high, cd_high, 0x44), r3 = _mm256_shuffle_ps(ab_high, cd_high, 0xEE);
+            _mm_storeu_ps(out,       _mm256_castps256_ps128(r0));
+            _mm_storeu_ps(out + 16,  _mm256_castps256_ps128(r1));
+            _mm_storeu_ps(out + 32,  _mm256_castps256_ps128(r2));
+            _mm_storeu_ps(out + 48,  _mm256_castps256_ps128(r3));
+            _mm_storeu_ps(out + 64,  _mm256_extractf128_ps(r0, 1));
+            _mm_storeu_ps(out + 80,  _mm256_extractf128_ps(r1, 1));
+            _mm_storeu_ps(out + 96,  _mm256_extractf128_ps(r2, 1));
+            _mm_storeu_ps(out + 112, _mm256_extractf128_ps(r3, 1));
+        }
+
+        #include "QuaternionBatchKernels.inl"
+    }
+
+#if defined(__clang__)
+    #pragma clang attribute pop
+#elif defined(__GNUC__)
+    #pragma GCC pop_options
+#endif
+
+    /* ------------------------------ AVX-512 ---------------------------- */
+
+#if defined(__clang__)
+    #pragma clang attribute push(__attribute__((target("avx512f"))), apply_to = function)
+#elif defined(__GNUC__)
+    #pragma GCC push_options
+    #pragma GCC target("avx512f")
+#endif
+
+    namespace avx512
+    {
+        typedef __m512    Lanes;
+        typedef __mmask16 Mask;
+        const size_t LANE_COUNT = 16;
+
+        // Bitwise float operations need AVX-512DQ, so the sign bit goes
+        // through the integer domain
+        inline __m512 flip_bits(Lanes a, int bits)
+        {
+            return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_set1_epi32(bits)));
+        }
+
+        inline Lanes load(const float *p)             { return _mm512_loadu_ps(p); }
+        inline void  store(float *p, Lanes v)         { _mm512_storeu_ps(p, v); }
+        inline Lanes broadcast(float f)               { return _mm512_set1_ps(f); }
+        inline Lanes add(Lanes a, Lanes b)            { return _mm512_add_ps(a, b); }
+        inline Lanes sub(Lanes a, Lanes b)            { return _mm512_sub_ps(a, b); }
+        inline Lanes mul(Lanes a, Lanes b)            { return _mm512_mul_ps(a, b); }
+        inline Lanes div(Lanes a, Lanes b)            { return _mm512_div_ps(a, b); }
+        inline Lanes fmadd(Lanes a, Lanes b, Lanes c) { return _mm512_fmadd_ps(a, b, c); }
+        inline Lanes square_root(Lanes a)             { return _mm512_sqrt_ps(a); }
+        inline Lanes negate(Lanes a)                  { return flip_bits(a, (int) 0x80000000); }
+        inline Lanes absolute(Lanes a)                { return _mm512_abs_ps(a); }
+        inline Lanes round_toward_zero(Lanes a)       { return _mm512_roundscale_ps(a, _MM_FROUND_TO_ZERO); }
+        inline Mask  less(Lanes a, Lanes b)           { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+        inline Mask  greater(Lanes a, Lanes b)        { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+        inline Lanes blend(Mask m, Lanes if_set, Lanes if_clear) { return _mm512_mask_blend_ps(m, if_clear, if_set); }
+
+        // As in AVX2, per 128-bit lane: quarter k of the transposed registers
+        // holds matrices 4k to 4k + 3
+        inline void store_columns(float *out, Lanes a, Lanes b, Lanes c, Lanes d)
+        {
+            __m512 ab_low  = _mm512_unpacklo_ps(a, b), ab_high = _mm512_unpackhi_ps(a, b),
+                   cd_low  = _mm512_unpacklo_ps(c, d), cd_high = _mm512_unpackhi_ps(c, d);
+            __m512 rows[4] = {
+                _mm512_shuffle_ps(ab_low, cd_low, 0x44),   _mm512_shuffle_ps(ab_low, cd_low, 0xEE),
+                _mm512_shuffle_ps(ab_high, cd_high, 0x44), _mm512_shuffle_ps(ab_high, cd_high, 0xEE)
+            };
+            for (int r = 0; r < 4; r++)
+            {
+                _mm_storeu_ps(out + 16 * r,       _mm512_extractf32x4_ps(rows[r], 0));
+                _mm_storeu_ps(out + 16 * r + 64,  _mm512_extractf32x4_ps(rows[r], 1));
+                _mm_storeu_ps(out + 16 * r + 128, _mm512_extractf32x4_ps(rows[r], 2));
+                _mm_storeu_ps(out + 16 * r + 192, _mm512_extractf32x4_ps(rows[r], 3));
+            }
+        }
+
+        #include "QuaternionBatchKernels.inl"
+    }
+
+#if defined(__clang__)
+    #pragma clang attribute pop
+#elif defined(__GNUC__)
+    #pragma GCC pop_options
+#endif
+#endif
+
+    const Kernels &kernels()
+    {
+        switch (get_matrix_batch_isa())
+        {
+#ifdef QUATERNION_BATCH_X86
+            case MATRIX_BATCH_AVX512: return avx512::KERNELS;
+            case MATRIX_BATCH_AVX2:   return avx2::KERNELS;
+            case MATRIX_BATCH_SSE2:   return sse2::KERNELS;
+#endif
+            default:                  return SCALAR_KERNELS;
+        }
+    }
+}
+
+void split_quaternions(const glm::quat *in, QuaternionArrays out, size_t count)
+{
+    for (size_t i = 0; i < count; i++) put(out, i, in[i]);
+}
+
+void join_quaternions(ConstQuaternionArrays in, glm::quat *out, size_t count)
+{
+    for (size_t i = 0; i < count; i++) out[i] = get(in, i);
+}
+
+void nlerp_quaternions(ConstQuaternionArrays a, ConstQuaternionArrays b, const float *t, QuaternionArrays out, size_t count)
+{
+    size_t done = kernels().nlerp(a, b, t, out, count);
+    nlerp_scalar(offset(a, done), offset(b, done), t + done, offset(out, done), count - done);
+}
+
+void slerp_quaternions(ConstQuaternionArrays a, ConstQuaternionArrays b, const float *t, QuaternionArrays out, size_t count,
+                       SlerpPrecision precision)
+{
+    if (precision == SLERP_FAST)
+    {
+        size_t done = kernels().slerp_fast(a, b, t, out, count);
+        slerp_fast_scalar(offset(a, done), offset(b, done), t + done, offset(out, done), count - done);
+    }
+    else
+    {
+        size_t done = kernels().slerp(a, b, t, out, count);
+        slerp_scalar(offset(a, done), offset(b, done), t + done, offset(out, done), count - done);
+    }
+}
+
+void multiply_quaternions(ConstQuaternionArrays a, ConstQuaternionArrays b, QuaternionArrays out, size_t count)
+{
+    size_t done = kernels().multiply(a, b, out, count);
+    multiply_scalar(offset(a, done), offset(b, done), offset(out, done), count - done);
+}
+
+void rotate_vectors(ConstQuaternionArrays q, ConstVec3Arrays v, Vec3Arrays out, size_t count)
+{
+    size_t done = kernels().rotate(q, v, out, count);
+    rotate_scalar(offset(q, done), offset(v, done), offset(out, done), count - done);
+}
+
+void quaternions_to_matrices(ConstQuaternionArrays q, glm::mat4 *out, size_t count)
+{
+    size_t done = kernels().to_matrix(q, reinterpret_cast<float *>(out), count);
+    to_matrix_scalar(offset(q, done), reinterpret_cast<float *>(out + done), count - done);
+}
@@ -0,0 +1,243 @@
+/**
+ * @file QuaternionBatchKernels.inl
+ * @brief The wide quaternion kernels, written once against a handful of lane
+ * operations. QuaternionBatch.cpp includes this file once per instruction
+ * set, inside a namespace that defines Lanes, Mask, LANE_COUNT and the
+ * operations (load, store, broadcast, add, sub, mul, div, fmadd, square_root,
+ * negate, absolute, round_toward_zero, less, greater, blend, store_columns).
+ * Every kernel stops after the last whole block and returns how many elements
+ * it wrote; the caller finishes the rest with the scalar kernel.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+struct QuaternionLanes
+{
+    Lanes w, x, y, z;
+};
+
+inline QuaternionLanes load_quaternions(ConstQuaternionArrays q, size_t i)
+{
+    return { load(q.w + i), load(q.x + i), load(q.y + i), load(q.z + i) };
+}
+
+inline void store_quaternions(QuaternionArrays q, size_t i, const QuaternionLanes &v)
+{
+    store(q.w + i, v.w);
+    store(q.x + i, v.x);
+    store(q.y + i, v.y);
+    store(q.z + i, v.z);
+}
+
+inline Lanes dot(const QuaternionLanes &a, const QuaternionLanes &b)
+{
+    return fmadd(a.w, b.w, fmadd(a.x, b.x, fmadd(a.y, b.y, mul(a.z, b.z))));
+}
+
+// a * ka + b * kb, component by component
+inline QuaternionLanes combine(const QuaternionLanes &a, Lanes ka, const QuaternionLanes &b, Lanes kb)
+{
+    return { fmadd(a.w, ka, mul(b.w, kb)), fmadd(a.x, ka, mul(b.x, kb)),
+             fmadd(a.y, ka, mul(b.y, kb)), fmadd(a.z, ka, mul(b.z, kb)) };
+}
+
+// Flips b where it points away from a, so blends take the shorter arc;
+// returns |dot(a, b)|
+inline Lanes align_hemisphere(const QuaternionLanes &a, QuaternionLanes &b)
+{
+    Lanes cos_theta = dot(a, b);
+    Mask  opposite  = less(cos_theta, broadcast(0.0f));
+    b.w = blend(opposite, negate(b.w), b.w);
+    b.x = blend(opposite, negate(b.x), b.x);
+    b.y = blend(opposite, negate(b.y), b.y);
+    b.z = blend(opposite, negate(b.z), b.z);
+    return absolute(cos_theta);
+}
+
+// The glm/simd sin polynomial, with the octant arithmetic done in floats so
+// it needs no integer lanes
+inline Lanes sine(Lanes x)
+{
+    Lanes a = absolute(x);
+
+    // Octant index rounded up to even, so the reduced argument lies in [-pi/4, pi/4]
+    Lanes octant   = round_toward_zero(mul(a, broadcast(glm::detail::sincos_four_over_pi)));
+    Lanes quadrant = round_toward_zero(mul(add(octant, broadcast(1.0f)), broadcast(0.5f)));
+    Lanes y        = add(quadrant, quadrant);
+    Lanes half     = round_toward_zero(mul(quadrant, broadcast(0.5f)));
+    Mask  swap     = greater(sub(quadrant, add(half, half)), broadcast(0.5f));
+    Mask  flip     = greater(sub(half, mul(round_toward_zero(mul(half, broadcast(0.5f))), broadcast(2.0f))), broadcast(0.5f));
+
+    a = fmadd(y, broadcast(glm::detail::sincos_dp1), a);
+    a = fmadd(y, broadcast(glm::detail::sincos_dp2), a);
+    a = fmadd(y, broadcast(glm::detail::sincos_dp3), a);
+    Lanes z = mul(a, a);
+
+    Lanes pc = fmadd(fmadd(broadcast(glm::detail::cos_p0), z, broadcast(glm::detail::cos_p1)), z, broadcast(glm::detail::cos_p2));
+    pc = fmadd(mul(pc, z), z, sub(broadcast(1.0f), mul(z, broadcast(0.5f))));
+    Lanes ps = fmadd(fmadd(broadcast(glm::detail::sin_p0), z, broadcast(glm::detail::sin_p1)), z, broadcast(glm::detail::sin_p2));
+    ps = fmadd(mul(ps, z), a, a);
+
+    Lanes result = blend(swap, pc, ps);
+    result = blend(flip, negate(result), result);
+    return blend(less(x, broadcast(0.0f)), negate(result), result);
+}
+
+// acos for c in [0, 1]: 2 asin(sqrt((1 - c) / 2)) above 1/2, pi/2 - asin(c)
+// below, with the Cephes asinf polynomial
+inline Lanes arc_cosine(Lanes c)
+{
+    Mask  large = greater(c, broadcast(0.5f));
+    Lanes s     = blend(large, square_root(mul(sub(broadcast(1.0f), c), broadcast(0.5f))), c);
+    Lanes z     = mul(s, s);
+
+    Lanes p = fmadd(broadcast(ASIN_P[0]), z, broadcast(ASIN_P[1]));
+    p = fmadd(p, z, broadcast(ASIN_P[2]));
+    p = fmadd(p, z, broadcast(ASIN_P[3]));
+    p = fmadd(p, z, broadcast(ASIN_P[4]));
+    Lanes arc_sine = fmadd(mul(p, z), s, s);
+
+    return blend(large, add(arc_sine, arc_sine), sub(broadcast(HALF_PI), arc_sine));
+}
+
+size_t nlerp_wide(ConstQuaternionArrays a, ConstQuaternionArrays b, const float *t, QuaternionArrays out, size_t count)
+{
+    size_t i = 0;
+    for (; i + LANE_COUNT <= count; i += LANE_COUNT)
+    {
+        QuaternionLanes from = load_quaternions(a, i),
+                        to   = load_quaternions(b, i);
+        align_hemisphere(from, to);
+
+        Lanes weight = load(t + i);
+        QuaternionLanes mixed = combine(from, sub(broadcast(1.0f), weight), to, weight);
+
+        // glm::normalize: a zero quaternion comes back as the identity
+        Lanes length     = square_root(dot(mixed, mixed));
+        Mask  degenerate = less(length, broadcast(FLT_MIN));
+        Lanes scale      = div(broadcast(1.0f), length);
+        mixed.w = blend(degenerate, broadcast(1.0f), mul(mixed.w, scale));
+        mixed.x = blend(degenerate, broadcast(0.0f), mul(mixed.x, scale));
+        mixed.y = blend(degenerate, broadcast(0.0f), mul(mixed.y, scale));
+        mixed.z = blend(degenerate, broadcast(0.0f), mul(mixed.z, scale));
+        store_quaternions(out, i, mixed);
+    }
+    return i;
+}
+
+size_t slerp_wide(ConstQuaternionArrays a, ConstQuaternionArrays b, const float *t, QuaternionArrays out, size_t count)
+{
+    size_t i = 0;
+    for (; i + LANE_COUNT <= count; i += LANE_COUNT)
+    {
+        QuaternionLanes from = load_quaternions(a, i),
+                        to   = load_quaternions(b, i);
+        Lanes cos_theta = align_hemisphere(from, to);
+
+        Lanes weight     = load(t + i),
+              complement = sub(broadcast(1.0f), weight);
+
+        // Lanes this close to parallel fall back to a plain lerp, as in
+        // glm::slerp; whatever the sines produce there is discarded
+        Lanes angle     = arc_cosine(cos_theta);
+        Lanes inv_sine  = div(broadcast(1.0f), sine(angle));
+        Mask  parallel  = greater(cos_theta, broadcast(SLERP_LERP_THRESHOLD));
+        Lanes from_part = blend(parallel, complement, mul(sine(mul(complement, angle)), inv_sine));
+        Lanes to_part   = blend(parallel, weight, mul(sine(mul(weight, angle)), inv_sine));
+
+        store_quaternions(out, i, combine(from, from_part, to, to_part));
+    }
+    return i;
+}
+
+size_t slerp_fast_wide(ConstQuaternionArrays a, ConstQuaternionArrays b, const float *t, QuaternionArrays out, size_t count)
+{
+    size_t i = 0;
+    for (; i + LANE_COUNT <= count; i += LANE_COUNT)
+    {
+        QuaternionLanes from = load_quaternions(a, i),
+                        to   = load_quaternions(b, i);
+        Lanes cos_theta_minus_one = sub(align_hemisphere(from, to), broadcast(1.0f));
+
+        Lanes weight            = load(t + i),
+              complement        = sub(broadcast(1.0f), weight),
+              weight_squared    = mul(weight, weight),
+              complement_squared = mul(complement, complement);
+
+        Lanes to_series   = broadcast(1.0f),
+              from_series = broadcast(1.0f);
+        for (int k = SLERP_TERMS - 1; k >= 0; k--)
+        {
+            Lanes u = broadcast(SLERP_U[k]), v = broadcast(SLERP_V[k]);
+            to_series   = fmadd(mul(sub(mul(u, weight_squared), v), cos_theta_minus_one), to_series, broadcast(1.0f));
+            from_series = fmadd(mul(sub(mul(u, complement_squared), v), cos_theta_minus_one), from_series, broadcast(1.0f));
+        }
+
+        store_quaternions(out, i, combine(from, mul(complement, from_series), to, mul(weight, to_series)));
+    }
+    return i;
+}
+
+size_t multiply_wide(ConstQuaternionArrays a, ConstQuaternionArrays b, QuaternionArrays out, size_t count)
+{
+    size_t i = 0;
+    for (; i + LANE_COUNT <= count; i += LANE_COUNT)
+    {
+        QuaternionLanes p = load_quaternions(a, i),
+                        q = load_quaternions(b, i);
+
+        QuaternionLanes product;
+        product.w = sub(sub(sub(mul(p.w, q.w), mul(p.x, q.x)), mul(p.y, q.y)), mul(p.z, q.z));
+        product.x = sub(add(add(mul(p.w, q.x), mul(p.x, q.w)), mul(p.y, q.z)), mul(p.z, q.y));
+        product.y = sub(add(add(mul(p.w, q.y), mul(p.y, q.w)), mul(p.z, q.x)), mul(p.x, q.z));
+        product.z = sub(add(add(mul(p.w, q.z), mul(p.z, q.w)), mul(p.x, q.y)), mul(p.y, q.x));
+        store_quaternions(out, i, product);
+    }
+    return i;
+}
+
+size_t rotate_wide(ConstQuaternionArrays q, ConstVec3Arrays v, Vec3Arrays out, size_t count)
+{
+    size_t i = 0;
+    for (; i + LANE_COUNT <= count; i += LANE_COUNT)
+    {
+        QuaternionLanes r = load_quaternions(q, i);
+        Lanes vx = load(v.x + i), vy = load(v.y + i), vz = load(v.z + i);
+
+        // glm's q * v: v + 2 (w (q.xyz x v) + q.xyz x (q.xyz x v))
+        Lanes uvx = sub(mul(r.y, vz), mul(r.z, vy)),
+              uvy = sub(mul(r.z, vx), mul(r.x, vz)),
+              uvz = sub(mul(r.x, vy), mul(r.y, vx));
+        Lanes uuvx = sub(mul(r.y, uvz), mul(r.z, uvy)),
+              uuvy = sub(mul(r.z, uvx), mul(r.x, uvz)),
+              uuvz = sub(mul(r.x, uvy), mul(r.y, uvx));
+
+        Lanes two = broadcast(2.0f);
+        store(out.x + i, fmadd(fmadd(uvx, r.w, uuvx), two, vx));
+        store(out.y + i, fmadd(fmadd(uvy, r.w, uuvy), two, vy));
+        store(out.z + i, fmadd(fmadd(uvz, r.w, uuvz), two, vz));
+    }
+    return i;
+}
+
+size_t to_matrix_wide(ConstQuaternionArrays q, float *out, size_t count)
+{
+    size_t i = 0;
+    for (; i + LANE_COUNT <= count; i += LANE_COUNT, out += 16 * LANE_COUNT)
+    {
+        QuaternionLanes r = load_quaternions(q, i);
+        Lanes xx = mul(r.x, r.x), yy = mul(r.y, r.y), zz = mul(r.z, r.z),
+              xz = mul(r.x, r.z), xy = mul(r.x, r.y), yz = mul(r.y, r.z),
+              wx = mul(r.w, r.x), wy = mul(r.w, r.y), wz = mul(r.w, r.z);
+
+        Lanes one = broadcast(1.0f), two = broadcast(2.0f), zero = broadcast(0.0f);
+        store_columns(out + 0,  sub(one, mul(two, add(yy, zz))), mul(two, add(xy, wz)), mul(two, sub(xz, wy)), zero);
+        store_columns(out + 4,  mul(two, sub(xy, wz)), sub(one, mul(two, add(xx, zz))), mul(two, add(yz, wx)), zero);
+        store_columns(out + 8,  mul(two, add(xz, wy)), mul(two, sub(yz, wx)), sub(one, mul(two, add(xx, yy))), zero);
+        store_columns(out + 12, zero, zero, zero, one);
+    }
+    return i;
+}
+
+const Kernels KERNELS = { nlerp_wide, slerp_wide, slerp_fast_wide, multiply_wide, rotate_wide, to_matrix_wide };
@@ -0,0 +1,210 @@
+/**
+ * @file RenderQueue.cpp
+ * @brief Key packing and the radix sort. The worker threads are started
+ * once per sort and run every pass, meeting at a barrier after counting and
+ * after scattering, so a pass costs two synchronisations rather than a
+ * round of thread creation.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#include "RenderQueue.h"
+#include "ParallelJobs.h"
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <thread>
+
+namespace
+{
+    const unsigned LAYER_SHIFT   = 56, BLEND_SHIFT = 54, SHADER_SHIFT = 48, TEXTURE_SHIFT = 24;
+    const uint64_t TEXTURE_MASK  = 0xFFFFFF, SHADER_MASK = 0x3F, DEPTH_MASK = 0xFFFFFF;
+
+    const unsigned DIGIT_BITS    = 8;
+    const size_t   BUCKET_COUNT  = 1 << DIGIT_BITS;
+    const unsigned DIGIT_COUNT   = 64 / DIGIT_BITS;
+
+    // See parallel_thread_count()
+    const size_t MIN_ITEMS_PER_THREAD = 65536;
+
+    // One thread's bucket counts, padded so threads never share a cache line
+    struct alignas(64) Histogram
+    {
+        uint32_t counts[BUCKET_COUNT];
+    };
+
+    // Reusable barrier for a fixed number of threads. Waiters spin on the
+    // generation, yielding, since a pass only takes microseconds.
+    class Barrier
+    {
+    private:
+        const unsigned        m_thread_count;
+        std::atomic<unsigned> m_waiting;
+        std::atomic<unsigned> m_generation;
+
+    public:
+        explicit Barrier(unsigned thread_count) : m_thread_count(thread_count), m_waiting(0), m_generation(0) {}
+
+        void wait()
+        {
+            unsigned generation = m_generation.load(std::memory_order_acquire);
+            if (m_waiting.fetch_add(1, std::memory_order_acq_rel) + 1 == m_thread_count)
+            {
+                m_waiting.store(0, std::memory_order_relaxed);
+                m_generation.fetch_add(1, std::memory_order_release);
+                return;
+            }
+            while (m_generation.load(std::memory_order_acquire) == generation) std::this_thread::yield();
+        }
+    };
+
+    inline size_t digit_of(uint64_t key, unsigned shift)
+    {
+        return (size_t) (key >> shift) & (BUCKET_COUNT - 1);
+    }
+
+    // With one thread the counts for every digit come from a single read up
+    // front: moving the items about does not change a whole array's counts
+    void radix_sort_serial(DrawItem *items, DrawItem *scratch, size_t count)
+    {
+        uint32_t counts[DIGIT_COUNT][BUCKET_COUNT] = {};
+        for (size_t i = 0; i < count; i++)
+        {
+            uint64_t key = items[i].key;
+            for (unsigned digit = 0; digit < DIGIT_COUNT; digit++) counts[digit][digit_of(key, digit * DIGIT_BITS)]++;
+        }
+
+        DrawItem *source = items, *destination = scratch;
+        for (unsigned digit = 0; digit < DIGIT_COUNT; digit++)
+        {
+            unsigned shift = digit * DIGIT_BITS;
+            if (counts[digit][digit_of(items[0].key, shift)] == count) continue; // one bucket: nothing moves
+
+            size_t offsets[BUCKET_COUNT];
+            size_t offset = 0;
+            for (size_t bucket = 0; bucket < BUCKET_COUNT; bucket++)
+            {
+                offsets[bucket] = offset;
+                offset += counts[digit][bucket];
+            }
+
+            for (size_t i = 0; i < count; i++) destination[offsets[digit_of(source[i].key, shift)]++] = source[i];
+            std::swap(source, destination);
+        }
+
+        if (source != items) std::copy(source, source + count, items);
+    }
+}
+
+/* ------------------------------ Sort keys ----------------------------- */
+
+uint64_t make_draw_key(unsigned layer, AlphaMode alpha_mode, unsigned shader_variant, GLuint texture_id, float depth)
+{
+    assert(layer < 256 && shader_variant <= SHADER_MASK && texture_id <= TEXTURE_MASK);
+
+    // Non-negative floats order like their bit patterns; [0, 1] fits in 30
+    // bits, and the top 24 of those are kept. NaN goes to 0.
+    depth = depth > 0.0f ? depth : 0.0f;
+    depth = depth < 1.0f ? depth : 1.0f;
+    uint32_t depth_bits;
+    std::memcpy(&depth_bits, &depth, sizeof(depth_bits));
+
+    uint64_t blend = alpha_mode == STRAIGHT_ALPHA ? STRAIGHT_ALPHA : PREMULTIPLIED_ALPHA;
+    return (uint64_t) layer << LAYER_SHIFT | blend << BLEND_SHIFT | (uint64_t) shader_variant << SHADER_SHIFT |
+           (uint64_t) texture_id << TEXTURE_SHIFT | (uint64_t) (depth_bits >> 6);
+}
+
+unsigned get_draw_key_layer(uint64_t key)
+{
+    return (unsigned) (key >> LAYER_SHIFT);
+}
+
+AlphaMode get_draw_key_alpha_mode(uint64_t key)
+{
+    return (AlphaMode) ((key >> BLEND_SHIFT) & 3);
+}
+
+unsigned get_draw_key_shader_variant(uint64_t key)
+{
+    return (unsigned) ((key >> SHADER_SHIFT) & SHADER_MASK);
+}
+
+GLuint get_draw_key_texture(uint64_t key)
+{
+    return (GLuint) ((key >> TEXTURE_SHIFT) & TEXTURE_MASK);
+}
+
+/* ----------------------------- Radix sort ----------------------------- */
+
+void radix_sort_draw_items(DrawItem *items, DrawItem *scratch, size_t count, unsigned thread_count)
+{
+    if (count < 2) return;
+
+    thread_count = parallel_thread_count(thread_count, count, MIN_ITEMS_PER_THREAD);
+    if (thread_count == 1)
+    {
+        radix_sort_serial(items, scratch, count);
+        return;
+    }
+
+    std::vector<Histogram> histograms(thread_count);
+    std::vector<uint64_t>  differences(thread_count);
+    Barrier barrier(thread_count);
+
+    run_on_threads(thread_count, [&](unsigned thread)
+    {
+        size_t begin = count * thread / thread_count, end = count * (thread + 1) / thread_count;
+
+        // Bits that differ from the first key anywhere; bytes with none set
+        // would put every item in one bucket, so their passes are skipped
+        uint64_t first_key = items[0].key, difference = 0;
+        for (size_t i = begin; i < end; i++) difference |= items[i].key ^ first_key;
+        differences[thread] = difference;
+        barrier.wait();
+
+        difference = 0;
+        for (uint64_t thread_difference : differences) difference |= thread_difference;
+
+        DrawItem *source = items, *destination = scratch;
+        for (unsigned digit = 0; digit < DIGIT_COUNT; digit++)
+        {
+            unsigned shift = digit * DIGIT_BITS;
+            if (digit_of(difference, shift) == 0) continue;
+
+            uint32_t *counts = histograms[thread].counts;
+            std::fill(counts, counts + BUCKET_COUNT, 0u);
+            for (size_t i = begin; i < end; i++) counts[digit_of(source[i].key, shift)]++;
+            barrier.wait();
+
+            // This thread's items of each bucket go after every smaller
+            // bucket and after the same bucket's items from earlier threads,
+            // which keeps the sort stable
+            size_t offsets[BUCKET_COUNT];
+            size_t offset = 0;
+            for (size_t bucket = 0; bucket < BUCKET_COUNT; bucket++)
+            {
+                for (unsigned other = 0; other < thread_count; other++)
+                {
+                    if (other == thread) offsets[bucket] = offset;
+                    offset += histograms[other].counts[bucket];
+                }
+            }
+
+            for (size_t i = begin; i < end; i++) destination[offsets[digit_of(source[i].key, shift)]++] = source[i];
+            barrier.wait();
+
+            std::swap(source, destination);
+        }
+
+        // An odd number of passes leaves the result in scratch
+        if (source != items) std::copy(source + begin, source + end, items + begin);
+    });
+}
+
+void RenderQueue::sort(unsigned thread_count)
+{
+    m_scratch.resize(m_items.size());
+    radix_sort_draw_items(m_items.data(), m_scratch.data(), m_items.size(), thread_count);
+}
@@ -0,0 +1,73 @@
+/**
+ * @file RenderQueue.h
+ * @brief Draw ordering by sort key. Every draw is queued with a 64-bit key
+ * packing its layer, blend state, shader variant, texture and depth, most
+ * significant first, and the queue is radix sorted once a frame. Layers
+ * are drawn strictly in order; within a layer, draws sharing a blend state,
+ * shader and texture end up next to each other, so the renderer only has
+ * to change state where the key does.
+ *
+ * Within a layer draws are assumed not to depend on each other's order
+ * beyond depth. Anything that must be drawn over something else (e.g. a
+ * HUD, or overlapping blended sprites that share no texture) goes on a
+ * later layer.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Texture.h"
+
+/**
+ * Packs a sort key: layer (8 bits), blend state (2), shader variant (6),
+ * texture (24) and depth (24), from most to least significant. ADDITIVE
+ * shares PREMULTIPLIED_ALPHA's blend state and so sorts with it. depth is
+ * clamped to [0, 1], and smaller depths sort first.
+ */
+uint64_t make_draw_key(unsigned layer, AlphaMode alpha_mode, unsigned shader_variant, GLuint texture_id, float depth);
+
+unsigned  get_draw_key_layer(uint64_t key);
+AlphaMode get_draw_key_alpha_mode(uint64_t key); // STRAIGHT_ALPHA or PREMULTIPLIED_ALPHA
+unsigned  get_draw_key_shader_variant(uint64_t key);
+GLuint    get_draw_key_texture(uint64_t key);
+
+struct DrawItem
+{
+    uint64_t key;
+    uint32_t index; // the caller's, e.g. into an array of sprites
+};
+
+/**
+ * Stable sort of items by key: an LSD radix sort, one byte per pass,
+ * skipping the bytes that are the same in every key (typically the layer,
+ * blend and shader bytes). scratch must hold count items. Large arrays are
+ * split between thread_count threads (0 for one per hardware thread), each
+ * counting and scattering its own share of every pass.
+ */
+void radix_sort_draw_items(DrawItem *items, DrawItem *scratch, size_t count, unsigned thread_count = 0);
+
+class RenderQueue
+{
+private:
+    std::vector<DrawItem> m_items;
+    std::vector<DrawItem> m_scratch;
+
+public:
+    void clear() { m_items.clear(); }
+
+    void push(uint64_t key, uint32_t index)
+    {
+        DrawItem item = { key, index };
+        m_items.push_back(item);
+    }
+
+    void sort(unsigned thread_count = 0);
+
+    const DrawItem *get_items() const { return m_items.data(); }
+    size_t          get_size()  const { return m_items.size(); }
+};
@@ -0,0 +1,308 @@
+/**
+ * @file SelfTest.cpp
+ * @brief The checks. Inputs are generated from fixed seeds, so a failure
+ * reproduces on every run.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include "SelfTest.h"
+#include "MatrixBatch.h"
+#include "MatrixDecompose.h"
+#include "glm/gtc/matrix_transform.hpp"
+#include "glm/gtx/batch_intersect.hpp"
+#include "glm/gtx/matrix_decompose.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const unsigned THREAD_COUNTS[] = { 1, 3, 0 }; // 0 is one per hardware thread
+
+    // Each instruction set up to the best supported, then the original one
+    // restored
+    template <typename Function>
+    void for_each_isa(Function function)
+    {
+        MatrixBatchIsa original = get_matrix_batch_isa();
+        for (int isa = MATRIX_BATCH_SCALAR; isa <= get_supported_matrix_batch_isa(); isa++)
+            function(set_matrix_batch_isa((MatrixBatchIsa) isa));
+        set_matrix_batch_isa(original);
+    }
+
+    bool same_bits(const void *a, const void *b, size_t size)
+    {
+        return std::memcmp(a, b, size) == 0;
+    }
+
+    /* ------------------------- MatrixDecompose -------------------------- */
+
+    const size_t DECOMPOSE_MATRICES       = 100003; // odd, so every kernel has a tail
+    const double DECOMPOSE_2D_ROUND_TRIP  = 1.2e-6; // largest relative error rebuilding a 2D transform
+
+    enum MatrixKind { GENERAL, SINGULAR, NEAR_THRESHOLD, REFLECTION, SHEARED, MATRIX_KIND_COUNT };
+
+    const char *const MATRIX_KIND_NAMES[] = { "general", "singular", "near-threshold", "reflection", "sheared" };
+
+    // Affine matrices of every kind in turn: arbitrary upper 3x3s, rank
+    // deficient ones, ones scaled down to around glm::decompose's epsilon
+    // test, pure reflections (trace <= 0, the quaternion's other branches)
+    // and translate * rotate * shear * scale products
+    void make_matrices(std::vector<glm::mat4> &matrices, std::vector<glm::affine2d> &affines)
+    {
+        std::mt19937 random(5);
+        std::uniform_real_distribution<float> distribution(-3.0f, 3.0f);
+        auto next = [&] { return distribution(random); };
+
+        for (size_t i = 0; i < matrices.size(); i++)
+        {
+            MatrixKind kind = (MatrixKind) (i % MATRIX_KIND_COUNT);
+            glm::mat4 m(1.0f);
+
+            if (kind == GENERAL)
+            {
+                for (int column = 0; column < 3; column++)
+                    for (int row = 0; row < 3; row++) m[column][row] = next();
+                m[3] = glm::vec4(next(), next(), next(), 1.0f);
+            }
+            else if (kind == REFLECTION)
+            {
+                m = glm::scale(glm::mat4(1.0f), glm::vec3(-1.0f, 1.0f, 1.0f));
+                if (i % 2 == 0) m = glm::rotate(m, 3.14159265f, glm::vec3(0.0f, 0.0f, 1.0f));
+            }
+            else
+            {
+                glm::mat4 shear(1.0f);
+                shear[1][0] = next() * 0.3f;
+                shear[2][0] = next() * 0.3f;
+                shear[2][1] = next() * 0.3f;
+
+                glm::vec3 axis = glm::normalize(glm::vec3(next(), next(), next()) + 0.01f);
+                m = glm::translate(glm::mat4(1.0f), glm::vec3(next(), next(), next()));
+                m = glm::rotate(m, next(), axis) * shear;
+                m = glm::scale(m, glm::vec3(next(), next(), next()));
+
+                if (kind == SINGULAR) m[2] = glm::vec4(0.0f);
+                if (kind == NEAR_THRESHOLD)
+                {
+                    m[0] *= 1e-3f;
+                    m[1] *= 1e-3f;
+                    m[2] *= 1e-2f;
+                }
+            }
+            for (int column = 0; column < 3; column++) m[column][3] = 0.0f;
+            m[3][3] = 1.0f;
+            matrices[i] = m;
+
+            glm::affine2d a(1.0f);
+            if (kind == GENERAL)
+            {
+                a = glm::affine2d(glm::vec2(next(), next()), glm::vec2(next(), next()), glm::vec2(next(), next()));
+            }
+            else
+            {
+                a = glm::translate(glm::affine2d(1.0f), glm::vec2(next(), next()));
+                a = glm::scale(glm::shearY(glm::rotate(a, next()), next() * 0.5f), glm::vec2(next(), next()));
+                if (kind == SINGULAR) a[1] = a[0] * 2.0f;
+                if (kind == REFLECTION) a[0] = -a[0];
+            }
+            affines[i] = a;
+        }
+    }
+
+    bool matrix_decompose_test()
+    {
+        const size_t count = DECOMPOSE_MATRICES;
+        std::vector<glm::mat4>     matrices(count);
+        std::vector<glm::affine2d> affines(count);
+        make_matrices(matrices, affines);
+
+        // glm's own results, once
+        std::vector<DecomposedTransform> expected(count);
+        std::unique_ptr<bool[]> expected_valid(new bool[count]);
+        for (size_t i = 0; i < count; i++)
+        {
+            glm::vec4 perspective;
+            DecomposedTransform &e = expected[i];
+            expected_valid[i] = glm::decompose(matrices[i], e.scale, e.orientation, e.translation, e.skew, perspective);
+        }
+
+        std::vector<DecomposedTransform>   out(count);
+        std::vector<DecomposedTransform2D> out_2d(count), first_2d(count);
+        std::unique_ptr<bool[]> valid(new bool[count]), first_valid(new bool[count]);
+        bool passed = true, first = true;
+
+        std::cout << "MatrixDecompose against glm::decompose, " << count << " matrices:\n";
+        for_each_isa([&](MatrixBatchIsa isa)
+        {
+            for (unsigned thread_count : THREAD_COUNTS)
+            {
+                // 3D: validity, and every valid result, bit for bit
+                size_t decomposed = decompose_matrices(matrices.data(), out.data(), valid.get(), count, thread_count);
+                size_t mismatches = 0, expected_count = 0, reported = 0;
+                for (size_t i = 0; i < count; i++)
+                {
+                    const DecomposedTransform &a = out[i], &e = expected[i];
+                    expected_count += expected_valid[i];
+                    bool same = valid[i] == expected_valid[i] &&
+                                (!valid[i] || (same_bits(&a.scale, &e.scale, sizeof(a.scale)) &&
+                                               same_bits(&a.orientation, &e.orientation, sizeof(a.orientation)) &&
+                                               same_bits(&a.translation, &e.translation, sizeof(a.translation)) &&
+                                               same_bits(&a.skew, &e.skew, sizeof(a.skew))));
+                    if (same) continue;
+
+                    if (reported++ < 3)
+                        std::cout << "    matrix " << i << " (" << MATRIX_KIND_NAMES[i % MATRIX_KIND_COUNT] << ") differs"
+                                  << (valid[i] != expected_valid[i] ? " in validity\n" : "\n");
+                    mismatches++;
+                }
+                if (decomposed != expected_count) mismatches++;
+
+                // 2D: every valid result rebuilds its transform, and the
+                // results do not depend on the instruction set or threads
+                decompose_affines(affines.data(), out_2d.data(), valid.get(), count, thread_count);
+                if (first)
+                {
+                    first_2d = out_2d;
+                    std::copy(valid.get(), valid.get() + count, first_valid.get());
+                    first = false;
+                }
+                double largest_error = 0.0;
+                size_t differences_2d = 0;
+                for (size_t i = 0; i < count; i++)
+                {
+                    if (valid[i] != first_valid[i] || (valid[i] && !same_bits(&out_2d[i], &first_2d[i], sizeof(out_2d[i]))))
+                        differences_2d++;
+                    if (!valid[i]) continue;
+
+                    const DecomposedTransform2D &d = out_2d[i];
+                    glm::affine2d rebuilt = glm::translate(glm::affine2d(1.0f), d.translation);
+                    rebuilt = glm::scale(glm::shearY(glm::rotate(rebuilt, d.angle), d.skew), d.scale);
+                    for (int column = 0; column < 3; column++)
+                        for (int row = 0; row < 2; row++)
+                            largest_error = std::max(largest_error, std::fabs((double) rebuilt[column][row] - affines[i][column][row])
+                                                                    / (1.0 + std::fabs(affines[i][column][row])));
+                }
+
+                bool ok = mismatches == 0 && differences_2d == 0 && largest_error <= DECOMPOSE_2D_ROUND_TRIP;
+                passed = passed && ok;
+                std::cout << "  " << (ok ? "pass" : "FAIL") << "  " << get_matrix_batch_isa_name(isa) << ", "
+                          << (thread_count == 0 ? std::string("a thread per core")
+                                                : std::to_string(thread_count) + (thread_count == 1 ? " thread" : " threads")) << ": "
+                          << decomposed << " decomposed, " << mismatches << " differing from glm; 2D round trip within "
+                          << largest_error << ", " << differences_2d << " differing between runs\n";
+            }
+        });
+        return passed;
+    }
+
+    /* -------------------------- batch_intersect -------------------------- */
+
+    const int INTERSECT_GRID = 7; // boxes per side, centred on the ray origin
+
+    // Whether hits, the count and the distances all say exactly the boxes in
+    // expected were hit, at t = 0
+    bool same_hits(const std::vector<bool> &expected, size_t count, const std::vector<glm::uint32> &hits,
+                   const std::vector<float> &distance)
+    {
+        size_t expected_count = 0;
+        bool same = true;
+        for (size_t i = 0; i < expected.size(); i++)
+        {
+            bool hit = (hits[i / 32] >> (i % 32)) & 1u;
+            expected_count += expected[i];
+            same = same && hit == expected[i] && distance[i] == (expected[i] ? 0.0f : INFINITY);
+        }
+        return same && count == expected_count;
+    }
+
+    // A zero direction with an unbounded distance is a point-in-box test: one
+    // ray against grids of axis-aligned and oriented boxes around it, and a
+    // grid of rays against one box, at every length up to the grid so each
+    // lane width and tail sees every position
+    bool batch_intersect_test()
+    {
+        const glm::vec2 zero(0.0f), origin(0.5f, 0.5f);
+        std::vector<float> min_x, min_y, max_x, max_y, orig_x, orig_y, dir(INTERSECT_GRID * INTERSECT_GRID, 0.0f);
+        std::vector<bool> expected;
+        for (int y = 0; y < INTERSECT_GRID; y++)
+            for (int x = 0; x < INTERSECT_GRID; x++)
+            {
+                float left = (float) (x - INTERSECT_GRID / 2), bottom = (float) (y - INTERSECT_GRID / 2);
+                min_x.push_back(left);
+                min_y.push_back(bottom);
+                max_x.push_back(left + 1.0f);
+                max_y.push_back(bottom + 1.0f);
+                orig_x.push_back(left + origin.x);
+                orig_y.push_back(bottom + origin.y);
+                expected.push_back(x == INTERSECT_GRID / 2 && y == INTERSECT_GRID / 2);
+            }
+
+        std::vector<float> axis_x(expected.size(), 1.0f), axis_y(expected.size(), 0.0f), half(expected.size(), 0.5f);
+
+        std::cout << "batch_intersect with a zero direction and no distance limit:\n";
+        std::vector<glm::uint32> hits((expected.size() + 31) / 32);
+        std::vector<float> distance(expected.size());
+        size_t failures = 0;
+        for (size_t count = 1; count <= expected.size(); count++)
+        {
+            std::vector<bool> prefix(expected.begin(), expected.begin() + count);
+            size_t hit_count = glm::batchIntersectRayAABB(origin, zero, INFINITY, min_x.data(), min_y.data(), max_x.data(),
+                                                          max_y.data(), count, hits.data(), distance.data());
+            failures += !same_hits(prefix, hit_count, hits, distance);
+
+            hit_count = glm::batchIntersectRayOBB(origin, zero, INFINITY, orig_x.data(), orig_y.data(), axis_x.data(),
+                                                  axis_y.data(), half.data(), half.data(), count, hits.data(), distance.data());
+            failures += !same_hits(prefix, hit_count, hits, distance);
+
+            hit_count = glm::batchIntersectRaysAABB(orig_x.data(), orig_y.data(), dir.data(), dir.data(), INFINITY,
+                                                    glm::vec2(0.0f), glm::vec2(1.0f), count, hits.data(), distance.data());
+            failures += !same_hits(prefix, hit_count, hits, distance);
+        }
+        bool passed = failures == 0;
+        std::cout << "  " << (passed ? "pass" : "FAIL") << "  rectangles, 1 to " << expected.size() << " at a time: "
+                  << failures << " runs with hits outside the rectangle holding the origin\n";
+        return passed;
+    }
+
+    /* ----------------------------- Registry ----------------------------- */
+
+    struct SelfTest
+    {
+        const char *name;
+        bool (*run)();
+    };
+
+    const SelfTest SELF_TESTS[] = {
+        { "matrix-decompose", matrix_decompose_test },
+        { "batch-intersect",  batch_intersect_test },
+    };
+}
+
+bool run_self_test(const char *name)
+{
+    bool found = false, passed = true;
+    for (const SelfTest &test : SELF_TESTS)
+    {
+        if (name != nullptr && std::strcmp(name, test.name) != 0) continue;
+        passed = test.run() && passed;
+        std::cout << "\n";
+        found = true;
+    }
+
+    if (!found)
+    {
+        std::cout << "No self-test called " << name << "; there are:";
+        for (const SelfTest &test : SELF_TESTS) std::cout << " " << test.name;
+        std::cout << "\n";
+    }
+    return found && passed;
+}
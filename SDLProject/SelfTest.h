@@ -0,0 +1,19 @@
+/**
+ * @file SelfTest.h
+ * @brief Offline correctness checks for the batch modules whose headers
+ * promise exact agreement with glm or a stated edge-case behaviour:
+ * SDLProject --self-test [name]. Each check compares the batch results with
+ * the expected ones at every instruction set, thread count or array length
+ * that could change them, and prints what differed.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+/**
+ * Runs the named check, or all of them for null. Returns false if any
+ * check failed or, after listing the names, there is none by that name.
+ */
+bool run_self_test(const char *name);
@@ -0,0 +1,355 @@
+/**
+ * @file SpatialHashGrid.cpp
+ * @brief The cell table and the per-cell lists. rebuild() is a counting
+ * sort: one pass counts the items in each cell, a prefix sum over the table
+ * gives each cell its range of entries, and a second pass scatters the items
+ * into place, so the lists are walked in memory order.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include "SpatialHashGrid.h"
+#include "glm/gtx/fast_hash.hpp"
+#include <algorithm>
+#include <cassert>
+
+namespace
+{
+    const uint32_t EMPTY_SLOT = 0xFFFFFFFFu;
+    const uint32_t END_OF_LIST = 0xFFFFFFFEu;
+
+    const size_t MIN_CAPACITY = 64;
+
+    // Cell coordinates are clamped to this, so far-off or non-finite bounds
+    // pile into the border cells instead of overflowing
+    const float CELL_LIMIT = 1073741824.0f; // 2^30
+
+    // floor() by truncating and stepping down where that rounded up, which
+    // unlike std::floor inlines without SSE4.1
+    inline int to_cell(float position, float inverse_cell_size)
+    {
+        float scaled = position * inverse_cell_size;
+        scaled = scaled > -CELL_LIMIT ? scaled : -CELL_LIMIT; // NaN goes here too
+        scaled = scaled <  CELL_LIMIT ? scaled :  CELL_LIMIT;
+        int cell = (int) scaled;
+        return cell - ((float) cell > scaled);
+    }
+
+    // Smallest power of two holding count cells at most half full
+    inline size_t capacity_for(size_t count)
+    {
+        size_t capacity = MIN_CAPACITY;
+        while (capacity < 2 * count) capacity *= 2;
+        return capacity;
+    }
+}
+
+SpatialHashGrid::SpatialHashGrid(float cell_size)
+    : m_inverse_cell_size(1.0f / cell_size), m_free_entry(END_OF_LIST)
+{
+    assert(cell_size > 0.0f);
+    resize_table(MIN_CAPACITY);
+}
+
+/* -------------------------- Table internals -------------------------- */
+
+void SpatialHashGrid::cell_range(glm::vec2 min, glm::vec2 max, glm::ivec2 &first, glm::ivec2 &last) const
+{
+    first = glm::ivec2(to_cell(min.x, m_inverse_cell_size), to_cell(min.y, m_inverse_cell_size));
+    last  = glm::ivec2(to_cell(max.x, m_inverse_cell_size), to_cell(max.y, m_inverse_cell_size));
+    last  = glm::max(first, last);
+}
+
+inline size_t SpatialHashGrid::home_slot(glm::ivec2 cell) const
+{
+    return (size_t) glm::fastHash(cell) & (m_slots.size() - 1);
+}
+
+size_t SpatialHashGrid::find_slot(glm::ivec2 cell) const
+{
+    size_t mask = m_slots.size() - 1;
+    for (size_t slot = home_slot(cell); ; slot = (slot + 1) & mask)
+    {
+        const Slot &candidate = m_slots[slot];
+        if (candidate.head == EMPTY_SLOT) return m_slots.size();
+        if (candidate.cell == cell) return slot;
+    }
+}
+
+inline size_t SpatialHashGrid::find_or_add_slot(glm::ivec2 cell)
+{
+    if (2 * (m_cell_count + 1) > m_slots.size()) resize_table(2 * m_slots.size());
+
+    size_t mask = m_slots.size() - 1;
+    for (size_t slot = home_slot(cell); ; slot = (slot + 1) & mask)
+    {
+        Slot &candidate = m_slots[slot];
+        if (candidate.head == EMPTY_SLOT)
+        {
+            candidate.cell  = cell;
+            candidate.head  = END_OF_LIST;
+            candidate.count = 0;
+            m_cell_count++;
+            return slot;
+        }
+        if (candidate.cell == cell) return slot;
+    }
+}
+
+// Backward-shift deletion: later slots in the probe run move up into the
+// hole when their home slot allows it, so lookups never need tombstones
+void SpatialHashGrid::erase_slot(size_t slot)
+{
+    size_t mask = m_slots.size() - 1;
+    size_t hole = slot;
+    for (size_t next = (hole + 1) & mask; m_slots[next].head != EMPTY_SLOT; next = (next + 1) & mask)
+    {
+        size_t home = home_slot(m_slots[next].cell);
+        // Movable unless its home lies cyclically in (hole, next]
+        bool stays = hole <= next ? (home > hole && home <= next) : (home > hole || home <= next);
+        if (!stays)
+        {
+            m_slots[hole] = m_slots[next];
+            hole = next;
+        }
+    }
+    m_slots[hole].head = EMPTY_SLOT;
+    m_cell_count--;
+}
+
+void SpatialHashGrid::resize_table(size_t capacity)
+{
+    std::vector<Slot> old_slots;
+    old_slots.swap(m_slots);
+
+    Slot empty = {};
+    empty.head = EMPTY_SLOT;
+    m_slots.assign(capacity, empty);
+
+    size_t mask = capacity - 1;
+    for (const Slot &old_slot : old_slots)
+    {
+        if (old_slot.head == EMPTY_SLOT) continue;
+        size_t slot = home_slot(old_slot.cell);
+        while (m_slots[slot].head != EMPTY_SLOT) slot = (slot + 1) & mask;
+        m_slots[slot] = old_slot;
+    }
+}
+
+/* --------------------------- Modification --------------------------- */
+
+void SpatialHashGrid::clear()
+{
+    Slot empty = {};
+    empty.head = EMPTY_SLOT;
+    std::fill(m_slots.begin(), m_slots.end(), empty);
+    m_cell_count = 0;
+
+    m_entries.clear();
+    m_free_entry = END_OF_LIST;
+    m_entry_count = 0;
+}
+
+void SpatialHashGrid::rebuild(const glm::vec2 *min, const glm::vec2 *max, size_t count)
+{
+    assert(count < END_OF_LIST);
+
+    // The table starts at the size last frame's cells needed, since the
+    // fewer slots it spans the more of it stays in cache
+    size_t capacity = capacity_for(m_cell_count);
+    if (m_slots.size() < capacity || m_slots.size() > 4 * capacity)
+    {
+        m_slots.clear();
+        resize_table(capacity);
+    }
+
+    // Count the items in each cell, noting each entry with its slot in next.
+    // Should the table have to grow, the slots noted before that have moved,
+    // so the count starts over in the bigger table.
+    do
+    {
+        clear();
+        capacity = m_slots.size();
+        m_scratch.clear();
+        for (size_t i = 0; i < count; i++)
+        {
+            glm::ivec2 first, last;
+            cell_range(min[i], max[i], first, last);
+            for (int y = first.y; y <= last.y; y++)
+            {
+                for (int x = first.x; x <= last.x; x++)
+                {
+                    uint32_t slot = (uint32_t) find_or_add_slot(glm::ivec2(x, y));
+                    m_slots[slot].count++;
+                    Entry noted = { (uint32_t) i, first, slot };
+                    m_scratch.push_back(noted);
+                }
+            }
+        }
+    }
+    while (m_slots.size() != capacity);
+
+    size_t entry_count = m_scratch.size();
+    assert(entry_count < END_OF_LIST);
+
+    // Give each cell its range, using head as the write cursor
+    uint32_t offset = 0;
+    for (Slot &slot : m_slots)
+    {
+        if (slot.head == EMPTY_SLOT) continue;
+        slot.head = offset;
+        offset += slot.count;
+    }
+
+    // Scatter, linking each entry to the one after it
+    m_entries.resize(entry_count);
+    for (const Entry &noted : m_scratch)
+    {
+        Slot &slot = m_slots[noted.next];
+        Entry &placed = m_entries[slot.head];
+        placed.id = noted.id;
+        placed.first_cell = noted.first_cell;
+        placed.next = slot.head + 1;
+        slot.head++;
+    }
+
+    // Rewind the cursors and end each list
+    for (Slot &slot : m_slots)
+    {
+        if (slot.head == EMPTY_SLOT) continue;
+        slot.head -= slot.count;
+        m_entries[slot.head + slot.count - 1].next = END_OF_LIST;
+    }
+
+    m_entry_count = entry_count;
+}
+
+void SpatialHashGrid::insert(uint32_t id, glm::vec2 min, glm::vec2 max)
+{
+    glm::ivec2 first, last;
+    cell_range(min, max, first, last);
+
+    for (int y = first.y; y <= last.y; y++)
+    {
+        for (int x = first.x; x <= last.x; x++)
+        {
+            uint32_t index;
+            if (m_free_entry != END_OF_LIST)
+            {
+                index = m_free_entry;
+                m_free_entry = m_entries[index].next;
+            }
+            else
+            {
+                assert(m_entries.size() < END_OF_LIST);
+                index = (uint32_t) m_entries.size();
+                m_entries.push_back(Entry());
+            }
+
+            Slot &slot = m_slots[find_or_add_slot(glm::ivec2(x, y))];
+            Entry &added = m_entries[index];
+            added.id = id;
+            added.first_cell = first;
+            added.next = slot.head;
+            slot.head = index;
+            slot.count++;
+            m_entry_count++;
+        }
+    }
+}
+
+bool SpatialHashGrid::remove(uint32_t id, glm::vec2 min, glm::vec2 max)
+{
+    glm::ivec2 first, last;
+    cell_range(min, max, first, last);
+
+    bool found = false;
+    for (int y = first.y; y <= last.y; y++)
+    {
+        for (int x = first.x; x <= last.x; x++)
+        {
+            size_t slot_index = find_slot(glm::ivec2(x, y));
+            if (slot_index == m_slots.size()) continue;
+
+            Slot &slot = m_slots[slot_index];
+            for (uint32_t *link = &slot.head; *link != END_OF_LIST; link = &m_entries[*link].next)
+            {
+                uint32_t index = *link;
+                if (m_entries[index].id != id) continue;
+
+                *link = m_entries[index].next;
+                m_entries[index].next = m_free_entry;
+                m_free_entry = index;
+                m_entry_count--;
+                found = true;
+
+                if (--slot.count == 0) erase_slot(slot_index);
+                break;
+            }
+        }
+    }
+    return found;
+}
+
+/* ------------------------------ Queries ------------------------------ */
+
+void SpatialHashGrid::query(glm::vec2 min, glm::vec2 max, std::vector<uint32_t> &ids) const
+{
+    glm::ivec2 first, last;
+    cell_range(min, max, first, last);
+
+    // An item overlapping several cells of the query is reported from the
+    // lowest of them only: where its range and the query's start
+    auto report = [&](const Slot &slot)
+    {
+        for (uint32_t index = slot.head; index != END_OF_LIST; index = m_entries[index].next)
+        {
+            const Entry &entry = m_entries[index];
+            if (glm::max(entry.first_cell, first) == slot.cell) ids.push_back(entry.id);
+        }
+    };
+
+    // Queries covering more cells than the table has slots walk the table instead
+    double area = ((double) last.x - first.x + 1.0) * ((double) last.y - first.y + 1.0);
+    if (area > (double) m_slots.size())
+    {
+        for (const Slot &slot : m_slots)
+        {
+            if (slot.head == EMPTY_SLOT) continue;
+            if (glm::all(glm::greaterThanEqual(slot.cell, first)) && glm::all(glm::lessThanEqual(slot.cell, last)))
+                report(slot);
+        }
+        return;
+    }
+
+    for (int y = first.y; y <= last.y; y++)
+    {
+        for (int x = first.x; x <= last.x; x++)
+        {
+            size_t slot = find_slot(glm::ivec2(x, y));
+            if (slot != m_slots.size()) report(m_slots[slot]);
+        }
+    }
+}
+
+void SpatialHashGrid::find_pairs(std::vector<IdPair> &pairs) const
+{
+    // Two items can share several cells; the pair belongs to the lowest
+    for (const Slot &slot : m_slots)
+    {
+        if (slot.head == EMPTY_SLOT || slot.count < 2) continue;
+
+        for (uint32_t a = slot.head; a != END_OF_LIST; a = m_entries[a].next)
+        {
+            const Entry &first = m_entries[a];
+            for (uint32_t b = first.next; b != END_OF_LIST; b = m_entries[b].next)
+            {
+                const Entry &second = m_entries[b];
+                if (glm::max(first.first_cell, second.first_cell) != slot.cell) continue;
+                pairs.push_back(first.id < second.id ? IdPair(first.id, second.id) : IdPair(second.id, first.id));
+            }
+        }
+    }
+}
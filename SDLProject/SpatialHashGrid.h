@@ -0,0 +1,95 @@
+/**
+ * @file SpatialHashGrid.h
+ * @brief Broadphase for large numbers of moving sprites: a uniform 2D grid
+ * whose occupied cells live in an open-addressed hash table keyed by
+ * glm::fastHash of the cell coordinates, so the world needs no bounds. Each
+ * cell holds a linked list of the items overlapping it. Items can be
+ * inserted and removed one at a time, or the whole grid rebuilt from arrays
+ * of bounds each frame, which lays every cell's list out contiguously.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "glm/vec2.hpp"
+
+class SpatialHashGrid
+{
+public:
+    typedef std::pair<uint32_t, uint32_t> IdPair;
+
+private:
+    struct Slot
+    {
+        glm::ivec2 cell;
+        uint32_t   head;  // first entry, or EMPTY_SLOT if the slot is unused
+        uint32_t   count; // entries in the list
+    };
+
+    struct Entry
+    {
+        uint32_t   id;
+        glm::ivec2 first_cell; // the item's lowest cell, to report it only once
+        uint32_t   next;
+    };
+
+    float                 m_inverse_cell_size;
+    std::vector<Slot>     m_slots;          // power-of-two size, linear probing
+    size_t                m_cell_count = 0; // slots in use
+    std::vector<Entry>    m_entries;
+    uint32_t              m_free_entry;     // free list through Entry::next
+    size_t                m_entry_count = 0;
+    std::vector<Entry>    m_scratch;        // rebuild(): entries in item order
+
+    void   cell_range(glm::vec2 min, glm::vec2 max, glm::ivec2 &first, glm::ivec2 &last) const;
+    size_t home_slot(glm::ivec2 cell) const;
+    size_t find_slot(glm::ivec2 cell) const;
+    size_t find_or_add_slot(glm::ivec2 cell);
+    void   erase_slot(size_t slot);
+    void   resize_table(size_t capacity);
+
+public:
+    /**
+     * cell_size is in world units. Items about the size of a cell or a bit
+     * smaller work best: each then touches one to four cells.
+     */
+    explicit SpatialHashGrid(float cell_size);
+
+    void clear();
+
+    /**
+     * Replaces the contents with count items, item i having id i and bounds
+     * [min[i], max[i]]. Much faster than clear() and count inserts.
+     */
+    void rebuild(const glm::vec2 *min, const glm::vec2 *max, size_t count);
+
+    void insert(uint32_t id, glm::vec2 min, glm::vec2 max);
+
+    /**
+     * Removes an item inserted with the same bounds. Returns false if it was
+     * not found.
+     */
+    bool remove(uint32_t id, glm::vec2 min, glm::vec2 max);
+
+    /**
+     * Appends the id of every item sharing a cell with the bounds, each
+     * once. Items are matched by cell, not by their exact bounds, so the
+     * caller tests the candidates it gets back.
+     */
+    void query(glm::vec2 min, glm::vec2 max, std::vector<uint32_t> &ids) const;
+
+    /**
+     * Appends every pair of items sharing at least one cell, each pair once
+     * with the smaller id first.
+     */
+    void find_pairs(std::vector<IdPair> &pairs) const;
+
+    size_t get_cell_count()  const { return m_cell_count; }
+    size_t get_entry_count() const { return m_entry_count; } // one per item per cell
+};
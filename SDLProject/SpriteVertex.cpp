@@ -0,0 +1,124 @@
+/**
+ * @file SpriteVertex.cpp
+ * @brief Packing and attribute setup for SpriteVertex streams. Each
+ * component is converted a chunk at a time with the glm batch packers and
+ * then interleaved, so the conversions run on whole arrays.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#define GL_SILENCE_DEPRECATION
+#define GLM_ENABLE_EXPERIMENTAL
+#include "SpriteVertex.h"
+#include "glm/gtx/batch_packing.hpp"
+#include <SDL2/SDL.h>
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#ifndef GL_HALF_FLOAT_ARB
+    #define GL_HALF_FLOAT_ARB 0x140B
+#endif
+
+namespace
+{
+    constexpr size_t PACK_CHUNK = 256; // vertices converted per pass
+
+    enum HalfFloatSupport { HALF_FLOAT_UNKNOWN, HALF_FLOAT_NATIVE, HALF_FLOAT_EMULATED };
+
+    HalfFloatSupport      g_half_float_support = HALF_FLOAT_UNKNOWN;
+    std::vector<uint16_t> g_half_scratch;
+    std::vector<float>    g_position_scratch;
+}
+
+bool has_native_half_float_vertices()
+{
+    if (g_half_float_support == HALF_FLOAT_UNKNOWN)
+    {
+        g_half_float_support = SDL_GL_ExtensionSupported("GL_ARB_half_float_vertex") ? HALF_FLOAT_NATIVE
+                                                                                      : HALF_FLOAT_EMULATED;
+        if (g_half_float_support == HALF_FLOAT_EMULATED)
+            std::cout << "GL_ARB_half_float_vertex not supported, sprite positions widened on the CPU.\n";
+    }
+    return g_half_float_support == HALF_FLOAT_NATIVE;
+}
+
+void pack_sprite_vertices(const float *positions, const float *tex_coords, SpriteVertex *vertices, size_t count)
+{
+    uint16_t packed_positions[PACK_CHUNK * 2],
+             packed_tex_coords[PACK_CHUNK * 2];
+
+    for (size_t first = 0; first < count; first += PACK_CHUNK)
+    {
+        size_t chunk = std::min(PACK_CHUNK, count - first);
+
+        glm::batchPackHalf(positions + first * 2, packed_positions, chunk * 2);
+        glm::batchPackUnorm16(tex_coords + first * 2, packed_tex_coords, chunk * 2);
+
+        for (size_t i = 0; i < chunk; i++)
+        {
+            SpriteVertex &vertex = vertices[first + i];
+            std::memcpy(vertex.position,  packed_positions + i * 2,  sizeof(vertex.position));
+            std::memcpy(vertex.tex_coord, packed_tex_coords + i * 2, sizeof(vertex.tex_coord));
+        }
+    }
+}
+
+void bind_sprite_vertices(const ShaderProgram &program, const SpriteVertex *vertices, size_t count)
+{
+    const GLsizei stride = sizeof(SpriteVertex);
+
+    // Client-side pointers are only read as such with no buffer bound
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    if (has_native_half_float_vertices())
+    {
+        glVertexAttribPointer(program.get_position_attribute(), 2, GL_HALF_FLOAT_ARB, GL_FALSE,
+                              stride, vertices->position);
+    }
+    else
+    {
+        g_half_scratch.resize(count * 2);
+        g_position_scratch.resize(count * 2);
+        for (size_t i = 0; i < count; i++)
+            std::memcpy(&g_half_scratch[i * 2], vertices[i].position, sizeof(vertices[i].position));
+        glm::batchUnpackHalf(g_half_scratch.data(), g_position_scratch.data(), count * 2);
+
+        glVertexAttribPointer(program.get_position_attribute(), 2, GL_FLOAT, GL_FALSE,
+                              0, g_position_scratch.data());
+    }
+    glEnableVertexAttribArray(program.get_position_attribute());
+
+    glVertexAttribPointer(program.get_tex_coordinate_attribute(), 2, GL_UNSIGNED_SHORT, GL_TRUE,
+                          stride, vertices->tex_coord);
+    glEnableVertexAttribArray(program.get_tex_coordinate_attribute());
+}
+
+bool bind_sprite_vertices(const ShaderProgram &program, GLuint buffer, size_t offset)
+{
+    if (!has_native_half_float_vertices()) return false;
+
+    // With a buffer bound the pointers are byte offsets into it
+    const GLsizei stride = sizeof(SpriteVertex);
+
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+
+    glVertexAttribPointer(program.get_position_attribute(), 2, GL_HALF_FLOAT_ARB, GL_FALSE,
+                          stride, (const void *) (offset + offsetof(SpriteVertex, position)));
+    glEnableVertexAttribArray(program.get_position_attribute());
+
+    glVertexAttribPointer(program.get_tex_coordinate_attribute(), 2, GL_UNSIGNED_SHORT, GL_TRUE,
+                          stride, (const void *) (offset + offsetof(SpriteVertex, tex_coord)));
+    glEnableVertexAttribArray(program.get_tex_coordinate_attribute());
+    return true;
+}
+
+void unbind_sprite_vertices(const ShaderProgram &program)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glDisableVertexAttribArray(program.get_position_attribute());
+    glDisableVertexAttribArray(program.get_tex_coordinate_attribute());
+}
@@ -0,0 +1,59 @@
+/**
+ * @file SpriteVertex.h
+ * @brief Compact interleaved vertex format for sprites: half-float
+ * positions and unorm16 texture coordinates, 8 bytes a vertex against 16 for
+ * float position + uv. There is no per-vertex colour.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+#include "ShaderProgram.h"
+#include <cstddef>
+#include <cstdint>
+
+struct SpriteVertex
+{
+    uint16_t position[2];  // half floats
+    uint16_t tex_coord[2]; // unorm16, so uvs must lie in [0, 1]
+};
+
+static_assert(sizeof(SpriteVertex) == 8, "SpriteVertex must stay tightly packed");
+
+/**
+ * Whether the driver reads half-float positions natively, i.e. whether
+ * vertices in a GL buffer can be bound at all. Check before packing into
+ * one; the answer is queried once and then cached.
+ */
+bool has_native_half_float_vertices();
+
+/**
+ * Packs count vertices from float arrays of xy positions and uv
+ * coordinates, two floats a vertex each. Out-of-range uvs are clamped to
+ * [0, 1].
+ */
+void pack_sprite_vertices(const float *positions, const float *tex_coords, SpriteVertex *vertices, size_t count);
+
+/**
+ * Points the program's position and texCoord attributes at a
+ * client-side SpriteVertex array and enables them. Positions are read as
+ * GL_HALF_FLOAT when the driver has GL_ARB_half_float_vertex; otherwise
+ * they are widened to floats in a scratch array, which stays valid until
+ * the next call.
+ */
+void bind_sprite_vertices(const ShaderProgram &program, const SpriteVertex *vertices, size_t count);
+
+/**
+ * The same for vertices already in a GL buffer, starting offset bytes in.
+ * Positions cannot be widened there, so this returns false, binding
+ * nothing, unless the driver reads half floats natively.
+ */
+bool bind_sprite_vertices(const ShaderProgram &program, GLuint buffer, size_t offset);
+
+/**
+ * Disables the attributes enabled by bind_sprite_vertices() and unbinds any
+ * vertex buffer.
+ */
+void unbind_sprite_vertices(const ShaderProgram &program);
@@ -0,0 +1,245 @@
+/**
+ * @file StreamBuffer.cpp
+ * @brief Both streaming paths. The buffer storage and sync entry points are
+ * looked up through SDL at run time rather than linked, as the macOS
+ * OpenGL framework does not export them.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#define GL_SILENCE_DEPRECATION
+#include "StreamBuffer.h"
+#include <SDL2/SDL.h>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+
+#ifndef GL_MAP_PERSISTENT_BIT
+    #define GL_MAP_PERSISTENT_BIT 0x0040
+    #define GL_MAP_COHERENT_BIT   0x0080
+#endif
+
+#ifndef GL_MAP_WRITE_BIT
+    #define GL_MAP_WRITE_BIT 0x0002
+#endif
+
+#ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+    #define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+    #define GL_SYNC_FLUSH_COMMANDS_BIT    0x00000001
+    #define GL_TIMEOUT_EXPIRED            0x911B
+    #define GL_WAIT_FAILED                0x911D
+#endif
+
+namespace
+{
+    typedef void   (APIENTRY *BufferStorageFunction)(GLenum, GLsizeiptr, const void *, GLbitfield);
+    typedef void * (APIENTRY *MapBufferRangeFunction)(GLenum, GLintptr, GLsizeiptr, GLbitfield);
+    typedef GLsync (APIENTRY *FenceSyncFunction)(GLenum, GLbitfield);
+    typedef GLenum (APIENTRY *ClientWaitSyncFunction)(GLsync, GLbitfield, GLuint64);
+    typedef void   (APIENTRY *DeleteSyncFunction)(GLsync);
+
+    struct PersistentFunctions
+    {
+        BufferStorageFunction  buffer_storage    = nullptr;
+        MapBufferRangeFunction map_buffer_range  = nullptr;
+        FenceSyncFunction      fence_sync        = nullptr;
+        ClientWaitSyncFunction client_wait_sync  = nullptr;
+        DeleteSyncFunction     delete_sync       = nullptr;
+    };
+
+    PersistentFunctions g_gl;
+
+    // A stalled wait is retried in slices this long, so a lost context
+    // cannot hang the frame forever without GL_WAIT_FAILED being seen
+    constexpr GLuint64 WAIT_SLICE_NANOSECONDS = 100000000; // 100 ms
+
+    bool load_persistent_functions()
+    {
+        if (!SDL_GL_ExtensionSupported("GL_ARB_buffer_storage")) return false;
+
+        g_gl.buffer_storage   = (BufferStorageFunction)  SDL_GL_GetProcAddress("glBufferStorage");
+        g_gl.map_buffer_range = (MapBufferRangeFunction) SDL_GL_GetProcAddress("glMapBufferRange");
+        g_gl.fence_sync       = (FenceSyncFunction)      SDL_GL_GetProcAddress("glFenceSync");
+        g_gl.client_wait_sync = (ClientWaitSyncFunction) SDL_GL_GetProcAddress("glClientWaitSync");
+        g_gl.delete_sync      = (DeleteSyncFunction)     SDL_GL_GetProcAddress("glDeleteSync");
+
+        return g_gl.buffer_storage && g_gl.map_buffer_range && g_gl.fence_sync &&
+               g_gl.client_wait_sync && g_gl.delete_sync;
+    }
+}
+
+/* ------------------------------ Lifetime ------------------------------ */
+
+bool StreamBuffer::create(GLenum target, size_t region_size, size_t region_count, bool allow_persistent)
+{
+    assert(region_size > 0 && region_count > 0);
+    destroy();
+
+    m_target      = target;
+    m_region_size = region_size;
+    m_region      = 0;
+    m_used        = 0;
+
+    glGenBuffers(1, &m_buffer);
+    glBindBuffer(m_target, m_buffer);
+
+    m_mode = STREAM_BUFFER_ORPHANING;
+    if (allow_persistent && load_persistent_functions())
+    {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        GLsizeiptr size = (GLsizeiptr) (region_size * region_count);
+
+        g_gl.buffer_storage(m_target, size, nullptr, flags);
+        m_mapped = (unsigned char *) g_gl.map_buffer_range(m_target, 0, size, flags);
+        if (m_mapped != nullptr)
+        {
+            m_mode = STREAM_BUFFER_PERSISTENT;
+            m_fences.assign(region_count, nullptr);
+        }
+        else
+        {
+            // Immutable storage cannot be orphaned, so start again with a new buffer
+            glDeleteBuffers(1, &m_buffer);
+            glGenBuffers(1, &m_buffer);
+            glBindBuffer(m_target, m_buffer);
+        }
+    }
+
+    if (m_mode == STREAM_BUFFER_ORPHANING)
+    {
+        std::cout << "GL_ARB_buffer_storage not available, streamed geometry orphans its buffer instead.\n";
+        glBufferData(m_target, (GLsizeiptr) region_size, nullptr, GL_STREAM_DRAW);
+    }
+
+    glBindBuffer(m_target, 0);
+    return glGetError() == GL_NO_ERROR;
+}
+
+void StreamBuffer::destroy()
+{
+    if (m_buffer == 0) return;
+
+    if (m_mode == STREAM_BUFFER_PERSISTENT)
+    {
+        for (GLsync &fence : m_fences)
+        {
+            if (fence != nullptr) g_gl.delete_sync(fence);
+            fence = nullptr;
+        }
+        glBindBuffer(m_target, m_buffer);
+        glUnmapBuffer(m_target);
+        glBindBuffer(m_target, 0);
+        m_mapped = nullptr;
+    }
+    else
+    {
+        commit();
+    }
+
+    glDeleteBuffers(1, &m_buffer);
+    m_buffer = 0;
+}
+
+/* ----------------------------- Streaming ------------------------------ */
+
+void *StreamBuffer::allocate(size_t size, size_t &offset, size_t alignment)
+{
+    assert(m_buffer != 0 && alignment > 0);
+    if (size > m_region_size) return nullptr;
+
+    size_t start = (m_used + alignment - 1) / alignment * alignment;
+
+    if (m_mode == STREAM_BUFFER_PERSISTENT)
+    {
+        if (start + size > m_region_size)
+        {
+            next_region();
+            start = 0;
+        }
+        offset = m_region * m_region_size + start;
+    }
+    else
+    {
+        if (m_mapped != nullptr && start + size > m_region_size) commit();
+
+        // Orphaning first means the map never waits for draws still
+        // reading the previous storage
+        if (m_mapped == nullptr)
+        {
+            glBindBuffer(m_target, m_buffer);
+            glBufferData(m_target, (GLsizeiptr) m_region_size, nullptr, GL_STREAM_DRAW);
+            m_mapped = (unsigned char *) glMapBuffer(m_target, GL_WRITE_ONLY);
+            glBindBuffer(m_target, 0);
+            if (m_mapped == nullptr) return nullptr;
+
+            m_orphan_count++;
+            start = 0;
+        }
+        offset = start;
+    }
+
+    m_used = start + size;
+    m_bytes_streamed += size;
+    return m_mapped + offset;
+}
+
+void StreamBuffer::commit()
+{
+    // Coherent persistent mappings need nothing: writes are visible to
+    // every command issued after them
+    if (m_mode != STREAM_BUFFER_ORPHANING || m_mapped == nullptr) return;
+
+    glBindBuffer(m_target, m_buffer);
+    glUnmapBuffer(m_target);
+    glBindBuffer(m_target, 0);
+    m_mapped = nullptr;
+}
+
+void StreamBuffer::end_frame()
+{
+    m_frame_count++;
+
+    if (m_mode == STREAM_BUFFER_PERSISTENT) next_region();
+    else commit();
+}
+
+void StreamBuffer::next_region()
+{
+    m_fences[m_region] = g_gl.fence_sync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    m_region = (m_region + 1) % m_fences.size();
+    m_used   = 0;
+    wait_for_region(m_region);
+}
+
+void StreamBuffer::wait_for_region(size_t region)
+{
+    GLsync fence = m_fences[region];
+    if (fence == nullptr) return;
+
+    // A fence already signalled costs nothing; only a real wait is a stall
+    GLenum result = g_gl.client_wait_sync(fence, 0, 0);
+    if (result == GL_TIMEOUT_EXPIRED)
+    {
+        auto start = std::chrono::steady_clock::now();
+        do result = g_gl.client_wait_sync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, WAIT_SLICE_NANOSECONDS);
+        while (result == GL_TIMEOUT_EXPIRED);
+
+        m_stall_count++;
+        m_stall_milliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+    if (result == GL_WAIT_FAILED) std::cerr << "Stream buffer fence wait failed.\n";
+
+    g_gl.delete_sync(fence);
+    m_fences[region] = nullptr;
+}
+
+void StreamBuffer::print_report() const
+{
+    std::cout << "Stream buffer (" << (m_mode == STREAM_BUFFER_PERSISTENT ? "persistent, " : "orphaning, ")
+              << (m_mode == STREAM_BUFFER_PERSISTENT ? m_fences.size() : 1) << " x " << m_region_size / 1024 << " KB):\n"
+              << "  " << m_frame_count << " frames, " << m_bytes_streamed / 1024 << " KB streamed, "
+              << m_stall_count << " stalls (" << m_stall_milliseconds << " ms waiting)";
+    if (m_mode == STREAM_BUFFER_ORPHANING) std::cout << ", " << m_orphan_count << " orphans";
+    std::cout << "\n";
+}
@@ -0,0 +1,98 @@
+/**
+ * @file StreamBuffer.h
+ * @brief Ring buffer for geometry rewritten every frame. With
+ * GL_ARB_buffer_storage the whole buffer stays mapped (persistent and
+ * coherent) and is split into regions, three by default: the CPU writes
+ * into one while the GPU reads the others, and a fence per region says when
+ * it may be written again. Without the extension (e.g. the GL 2.1 context
+ * on macOS) every mapping orphans the buffer instead, so the driver hands
+ * out fresh storage rather than waiting for the GPU.
+ *
+ * Either way the caller writes straight into mapped memory; nothing is
+ * staged and copied. Waits on a fence are counted as stalls and reported.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+#ifdef _WINDOWS
+    #include <GL/glew.h>
+#endif
+#define GL_GLEXT_PROTOTYPES 1
+#include <SDL_opengl.h>
+#include <cstddef>
+#include <vector>
+
+enum StreamBufferMode
+{
+    STREAM_BUFFER_PERSISTENT, // mapped once, regions recycled behind fences
+    STREAM_BUFFER_ORPHANING   // glBufferData(NULL) and glMapBuffer per mapping
+};
+
+class StreamBuffer
+{
+private:
+    GLenum              m_target      = GL_ARRAY_BUFFER;
+    GLuint              m_buffer      = 0;
+    StreamBufferMode    m_mode        = STREAM_BUFFER_ORPHANING;
+    size_t              m_region_size = 0;
+    std::vector<GLsync> m_fences;      // per region, null once waited on
+
+    unsigned char *m_mapped = nullptr; // whole buffer (persistent) or current storage (orphaning)
+    size_t         m_region = 0;
+    size_t         m_used   = 0;       // bytes handed out from the current region
+
+    size_t m_frame_count    = 0;
+    size_t m_bytes_streamed = 0;
+    size_t m_stall_count    = 0;
+    double m_stall_milliseconds = 0.0;
+    size_t m_orphan_count   = 0;
+
+    void next_region();
+    void wait_for_region(size_t region);
+
+public:
+    /**
+     * Creates the buffer for target, holding region_count regions of
+     * region_size bytes each. The persistent path is taken when the driver
+     * has GL_ARB_buffer_storage, unless allow_persistent is false; the
+     * orphaning path uses a single region_size store.
+     */
+    bool create(GLenum target, size_t region_size, size_t region_count = 3, bool allow_persistent = true);
+
+    /**
+     * Unmaps and deletes the buffer. Needs the context to still be current,
+     * so it is not left to a destructor.
+     */
+    void destroy();
+
+    /**
+     * Space for size bytes, aligned to alignment, in the current region.
+     * Returns where to write them and, in offset, where they start in the
+     * buffer (what glVertexAttribPointer takes with the buffer bound).
+     * When the region is full the next one is started, so data written
+     * before must already have been drawn. Returns null if size exceeds
+     * a region. Leaves no buffer bound to the target, in either mode.
+     */
+    void *allocate(size_t size, size_t &offset, size_t alignment = 16);
+
+    /**
+     * Makes everything allocated so far visible to GL; call before the
+     * draws that read it. Unmaps in the orphaning mode, where the next
+     * allocate() then starts on fresh storage.
+     */
+    void commit();
+
+    /**
+     * Fences the region written this frame and moves to the next one.
+     */
+    void end_frame();
+
+    GLuint           get_buffer() const { return m_buffer; }
+    StreamBufferMode get_mode()   const { return m_mode; }
+    size_t           get_stall_count() const { return m_stall_count; }
+
+    void print_report() const;
+};
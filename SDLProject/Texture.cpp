@@ -0,0 +1,107 @@
+/**
+ * @file Texture.cpp
+ * @brief Texture import helpers. The conversion kernels work on the RGBA8
+ * buffers returned by stb_image before they are handed to glTexImage2D, so
+ * they run once per load rather than per frame.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#define GL_SILENCE_DEPRECATION
+#include "Texture.h"
+#include <unordered_map>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define TEXTURE_USE_SSE2 1
+#endif
+
+namespace
+{
+    std::unordered_map<GLuint, AlphaMode> g_alpha_modes;
+
+    // Exact round(value / 255) for value in [0, 255 * 255]
+    inline unsigned char div_255(unsigned int value)
+    {
+        value += 128;
+        return (unsigned char) ((value + (value >> 8)) >> 8);
+    }
+
+    /**
+     * Shared kernel: rgb *= alpha, alpha *= alpha_scale / 255. An alpha_scale
+     * of 255 keeps alpha as is, 0 clears it for additive sprites.
+     */
+    void premultiply(unsigned char *pixels, size_t pixel_count, unsigned char alpha_scale)
+    {
+        size_t i = 0;
+
+#ifdef TEXTURE_USE_SSE2
+        const __m128i zero       = _mm_setzero_si128();
+        const __m128i alpha_lane = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+        const __m128i alpha_mult = _mm_and_si128(alpha_lane, _mm_set1_epi16(alpha_scale));
+        const __m128i rounding   = _mm_set1_epi16(128);
+
+        // Four pixels per iteration, two per 16-bit half
+        for (; i + 4 <= pixel_count; i += 4)
+        {
+            __m128i *address = (__m128i *) (pixels + i * 4);
+            __m128i  source  = _mm_loadu_si128(address);
+
+            __m128i halves[2] = { _mm_unpacklo_epi8(source, zero),
+                                  _mm_unpackhi_epi8(source, zero) };
+
+            for (__m128i &half : halves)
+            {
+                // Broadcast each pixel's alpha across its four lanes, then
+                // swap the alpha lane's own factor for alpha_scale
+                __m128i factor = _mm_shufflehi_epi16(_mm_shufflelo_epi16(half, 0xFF), 0xFF);
+                factor = _mm_or_si128(_mm_andnot_si128(alpha_lane, factor), alpha_mult);
+
+                __m128i product = _mm_add_epi16(_mm_mullo_epi16(half, factor), rounding);
+                half = _mm_srli_epi16(_mm_add_epi16(product, _mm_srli_epi16(product, 8)), 8);
+            }
+
+            _mm_storeu_si128(address, _mm_packus_epi16(halves[0], halves[1]));
+        }
+#endif
+
+        for (; i < pixel_count; i++)
+        {
+            unsigned char *pixel = pixels + i * 4;
+            unsigned int   alpha = pixel[3];
+
+            pixel[0] = div_255(pixel[0] * alpha);
+            pixel[1] = div_255(pixel[1] * alpha);
+            pixel[2] = div_255(pixel[2] * alpha);
+            pixel[3] = div_255(alpha * alpha_scale);
+        }
+    }
+}
+
+void premultiply_alpha(unsigned char *pixels, size_t pixel_count)
+{
+    premultiply(pixels, pixel_count, 255);
+}
+
+void premultiply_additive(unsigned char *pixels, size_t pixel_count)
+{
+    premultiply(pixels, pixel_count, 0);
+}
+
+void apply_blend_state(AlphaMode alpha_mode)
+{
+    if (alpha_mode == STRAIGHT_ALPHA) glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    else                              glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+void set_texture_alpha_mode(GLuint texture_id, AlphaMode alpha_mode)
+{
+    g_alpha_modes[texture_id] = alpha_mode;
+}
+
+AlphaMode get_texture_alpha_mode(GLuint texture_id)
+{
+    auto entry = g_alpha_modes.find(texture_id);
+    return entry == g_alpha_modes.end() ? STRAIGHT_ALPHA : entry->second;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file Texture.h
+ * @brief Texture import helpers: pixel conversion kernels and per-texture
+ * bookkeeping used by load_texture().
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+#ifdef _WINDOWS
+    #include <GL/glew.h>
+#endif
+#define GL_GLEXT_PROTOTYPES 1
+#include <SDL_opengl.h>
+#include <cstddef>
+
+/**
+ * How the colour channels of a texture relate to its alpha channel.
+ *
+ * STRAIGHT_ALPHA       rgb is independent of alpha (what stb_image gives us).
+ * PREMULTIPLIED_ALPHA  rgb has already been multiplied by alpha.
+ * ADDITIVE             premultiplied rgb with alpha forced to zero, so the
+ *                      premultiplied blend state adds the colour instead of
+ *                      covering the destination.
+ */
+enum AlphaMode { STRAIGHT_ALPHA, PREMULTIPLIED_ALPHA, ADDITIVE };
+
+/**
+ * Multiplies the rgb channels of tightly packed RGBA8 pixels by their alpha,
+ * in place. Alpha is left untouched. Uses SSE2 when available.
+ */
+void premultiply_alpha(unsigned char *pixels, size_t pixel_count);
+
+/**
+ * Same as premultiply_alpha(), but also clears alpha so the pixels are
+ * drawn additively under the premultiplied blend state.
+ */
+void premultiply_additive(unsigned char *pixels, size_t pixel_count);
+
+/**
+ * Sets the blend function matching the given mode. PREMULTIPLIED_ALPHA and
+ * ADDITIVE share the same state, so sprites using either can be batched
+ * together.
+ */
+void apply_blend_state(AlphaMode alpha_mode);
+
+void      set_texture_alpha_mode(GLuint texture_id, AlphaMode alpha_mode);
+AlphaMode get_texture_alpha_mode(GLuint texture_id);
@@ -0,0 +1,426 @@
+/**
+ * @file TextureCache.cpp
+ * @brief Content-hashed, memory-mapped cache of decoded textures.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#define GL_SILENCE_DEPRECATION
+
+#include "TextureCache.h"
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <sys/stat.h>
+
+#ifdef _WINDOWS
+    #define NOMINMAX
+    #include <direct.h>
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr char     ENTRY_MAGIC[4]  = { 'T', 'X', 'C', 'H' };
+    constexpr uint32_t ENTRY_VERSION   = 1;
+    constexpr char     INDEX_FILENAME[] = "index.txt";
+    constexpr size_t   DATA_ALIGNMENT  = 16;
+
+    struct EntryHeader
+    {
+        char     magic[4];
+        uint32_t version;
+        uint64_t content_hash;
+        uint32_t payload;
+        uint32_t alpha_mode;
+        uint32_t mip_filter;
+        uint32_t level_count;
+    };
+
+    struct EntryLevel
+    {
+        int32_t  width, height;
+        uint64_t offset;
+    };
+
+    constexpr uint64_t PRIME_1 = 0x9E3779B185EBCA87ull,
+                       PRIME_2 = 0xC2B2AE3D27D4EB4Full,
+                       PRIME_3 = 0x165667B19E3779F9ull,
+                       PRIME_4 = 0x85EBCA77C2B2AE63ull,
+                       PRIME_5 = 0x27D4EB2F165667C5ull;
+
+    inline uint64_t rotate_left(uint64_t value, int bits) { return (value << bits) | (value >> (64 - bits)); }
+
+    inline uint64_t read_u64(const unsigned char *bytes)
+    {
+        uint64_t value;
+        std::memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+
+    inline uint32_t read_u32(const unsigned char *bytes)
+    {
+        uint32_t value;
+        std::memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+
+    inline uint64_t hash_round(uint64_t accumulator, uint64_t input)
+    {
+        accumulator += input * PRIME_2;
+        return rotate_left(accumulator, 31) * PRIME_1;
+    }
+
+    inline uint64_t hash_merge(uint64_t accumulator, uint64_t lane)
+    {
+        accumulator ^= hash_round(0, lane);
+        return accumulator * PRIME_1 + PRIME_4;
+    }
+
+    bool stat_file(const char *filepath, uint64_t &size, int64_t &mtime)
+    {
+        struct stat info;
+        if (stat(filepath, &info) != 0) return false;
+        size  = (uint64_t) info.st_size;
+        mtime = (int64_t) info.st_mtime;
+        return true;
+    }
+
+    size_t align_up(size_t value) { return (value + DATA_ALIGNMENT - 1) & ~(DATA_ALIGNMENT - 1); }
+}
+
+uint64_t hash_bytes(const void *data, size_t size, uint64_t seed)
+{
+    const unsigned char *bytes = (const unsigned char *) data, *end = bytes + size;
+    uint64_t hash;
+
+    if (size >= 32)
+    {
+        // Four independent lanes keep the multiplier pipelines busy
+        uint64_t lanes[4] = { seed + PRIME_1 + PRIME_2, seed + PRIME_2, seed, seed - PRIME_1 };
+        for (; bytes + 32 <= end; bytes += 32)
+            for (int lane = 0; lane < 4; lane++) lanes[lane] = hash_round(lanes[lane], read_u64(bytes + lane * 8));
+
+        hash = rotate_left(lanes[0], 1) + rotate_left(lanes[1], 7) + rotate_left(lanes[2], 12) + rotate_left(lanes[3], 18);
+        for (int lane = 0; lane < 4; lane++) hash = hash_merge(hash, lanes[lane]);
+    }
+    else hash = seed + PRIME_5;
+
+    hash += (uint64_t) size;
+
+    for (; bytes + 8 <= end; bytes += 8) hash = rotate_left(hash ^ hash_round(0, read_u64(bytes)), 27) * PRIME_1 + PRIME_4;
+    if (bytes + 4 <= end)
+    {
+        hash = rotate_left(hash ^ (read_u32(bytes) * PRIME_1), 23) * PRIME_2 + PRIME_3;
+        bytes += 4;
+    }
+    for (; bytes < end; bytes++) hash = rotate_left(hash ^ (*bytes * PRIME_5), 11) * PRIME_1;
+
+    hash ^= hash >> 33;
+    hash *= PRIME_2;
+    hash ^= hash >> 29;
+    hash *= PRIME_3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+// ---------------------------------------------------------------- MappedFile
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+#ifdef _WINDOWS
+
+bool MappedFile::open(const char *filepath)
+{
+    close();
+
+    m_file_handle = CreateFileA(filepath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL, NULL);
+    if (m_file_handle == INVALID_HANDLE_VALUE) { m_file_handle = nullptr; return false; }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(m_file_handle, &size) || size.QuadPart == 0) { close(); return false; }
+
+    m_mapping_handle = CreateFileMappingA(m_file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!m_mapping_handle) { close(); return false; }
+
+    m_data = (const unsigned char *) MapViewOfFile(m_mapping_handle, FILE_MAP_READ, 0, 0, 0);
+    m_size = (size_t) size.QuadPart;
+    if (!m_data) { close(); return false; }
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (m_data)           UnmapViewOfFile(m_data);
+    if (m_mapping_handle) CloseHandle(m_mapping_handle);
+    if (m_file_handle)    CloseHandle(m_file_handle);
+    m_data = nullptr;
+    m_size = 0;
+    m_mapping_handle = m_file_handle = nullptr;
+}
+
+#else
+
+bool MappedFile::open(const char *filepath)
+{
+    close();
+
+    int descriptor = ::open(filepath, O_RDONLY);
+    if (descriptor < 0) return false;
+
+    struct stat info;
+    if (fstat(descriptor, &info) != 0 || info.st_size == 0)
+    {
+        ::close(descriptor);
+        return false;
+    }
+
+    // The mapping keeps its own reference to the file
+    void *data = mmap(NULL, (size_t) info.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    ::close(descriptor);
+    if (data == MAP_FAILED) return false;
+
+    m_data = (const unsigned char *) data;
+    m_size = (size_t) info.st_size;
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (m_data) munmap((void *) m_data, m_size);
+    m_data = nullptr;
+    m_size = 0;
+}
+
+#endif
+
+// -------------------------------------------------------------- TextureCache
+
+void upload_cached_texture(const CachedTexture &texture)
+{
+    if (texture.payload == CACHE_PAYLOAD_RGBA8) upload_mip_levels(texture.levels, texture.data);
+    else upload_compressed_levels(texture.payload == CACHE_PAYLOAD_BC1 ? BLOCK_FORMAT_BC1 : BLOCK_FORMAT_BC3,
+                                  texture.levels, texture.data);
+}
+
+TextureCache::~TextureCache()
+{
+    save_index();
+}
+
+bool TextureCache::open(const char *directory)
+{
+    m_directory = directory;
+    m_index.clear();
+    m_report.clear();
+    m_bytes_mapped = 0;
+
+#ifdef _WINDOWS
+    _mkdir(directory);
+#else
+    mkdir(directory, 0755);
+#endif
+
+    struct stat info;
+    if (stat(directory, &info) != 0 || !(info.st_mode & S_IFDIR)) return false;
+
+    // One "size mtime hash path" line per source; the path runs to the end
+    // of the line so it may contain spaces
+    std::ifstream index(m_directory + "/" + INDEX_FILENAME);
+    std::string   line;
+    while (std::getline(index, line))
+    {
+        std::istringstream fields(line);
+        IndexEntry entry;
+        std::string path;
+        if (!(fields >> entry.size >> entry.mtime >> std::hex >> entry.hash >> std::dec)) continue;
+        std::getline(fields >> std::ws, path);
+        if (!path.empty()) m_index[path] = entry;
+    }
+    m_index_dirty = false;
+    return true;
+}
+
+void TextureCache::save_index()
+{
+    if (!m_index_dirty || m_directory.empty()) return;
+
+    std::string   path = m_directory + "/" + INDEX_FILENAME, temporary = path + ".tmp";
+    std::ofstream index(temporary);
+    for (const auto &entry : m_index)
+        index << entry.second.size << ' ' << entry.second.mtime << ' ' << std::hex << entry.second.hash << std::dec
+              << ' ' << entry.first << '\n';
+    index.close();
+
+    if (index && std::rename(temporary.c_str(), path.c_str()) == 0) m_index_dirty = false;
+}
+
+bool TextureCache::content_hash(const char *source_path, uint64_t &hash, bool &rehashed)
+{
+    uint64_t size;
+    int64_t  mtime;
+    if (!stat_file(source_path, size, mtime)) return false;
+
+    // An unchanged size and mtime means the contents haven't been touched,
+    // so the hash from last time still stands
+    auto known = m_index.find(source_path);
+    rehashed = known == m_index.end() || known->second.size != size || known->second.mtime != mtime;
+    if (!rehashed)
+    {
+        hash = known->second.hash;
+        return true;
+    }
+
+    MappedFile source;
+    if (!source.open(source_path)) return false;
+    hash = hash_bytes(source.data(), source.size());
+
+    m_index[source_path] = { size, mtime, hash };
+    m_index_dirty = true;
+    return true;
+}
+
+std::string TextureCache::entry_path(uint64_t content_hash, AlphaMode alpha_mode, MipFilter mip_filter) const
+{
+    // The payload isn't part of the key; whatever was stored is usable
+    uint32_t settings[3] = { ENTRY_VERSION, (uint32_t) alpha_mode, (uint32_t) mip_filter };
+    uint64_t key = hash_bytes(settings, sizeof(settings), content_hash);
+
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016" PRIx64 ".tex", key);
+    return m_directory + "/" + name;
+}
+
+bool TextureCache::lookup(const char *source_path, AlphaMode alpha_mode, MipFilter mip_filter, CachedTexture &texture)
+{
+    auto start = std::chrono::steady_clock::now();
+    ReportLine report = { source_path, false, false, 0.0 };
+
+    uint64_t hash;
+    std::unique_ptr<MappedFile> mapping(new MappedFile());
+    if (!m_directory.empty() && content_hash(source_path, hash, report.rehashed) &&
+        mapping->open(entry_path(hash, alpha_mode, mip_filter).c_str()) && mapping->size() >= sizeof(EntryHeader))
+    {
+        EntryHeader header;
+        std::memcpy(&header, mapping->data(), sizeof(header));
+
+        size_t table_end = sizeof(EntryHeader) + (size_t) header.level_count * sizeof(EntryLevel);
+        if (std::memcmp(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC)) == 0 && header.version == ENTRY_VERSION &&
+            header.content_hash == hash && header.payload <= CACHE_PAYLOAD_BC3 && header.level_count > 0 &&
+            header.level_count <= 32 && mapping->size() >= table_end)
+        {
+            const size_t data_offset = align_up(table_end), data_size = mapping->size() - data_offset;
+            texture.levels.clear();
+            report.hit = true;
+
+            for (uint32_t i = 0; i < header.level_count && report.hit; i++)
+            {
+                EntryLevel level;
+                std::memcpy(&level, mapping->data() + sizeof(EntryHeader) + i * sizeof(EntryLevel), sizeof(level));
+
+                size_t level_size = header.payload == CACHE_PAYLOAD_RGBA8
+                                  ? (size_t) level.width * level.height * 4
+                                  : compressed_level_size(header.payload == CACHE_PAYLOAD_BC1 ? BLOCK_FORMAT_BC1
+                                                                                              : BLOCK_FORMAT_BC3,
+                                                          level.width, level.height);
+                report.hit = level.width > 0 && level.height > 0 && level.offset + level_size <= data_size;
+                texture.levels.push_back({ level.width, level.height, (size_t) level.offset });
+            }
+
+            if (report.hit)
+            {
+                texture.payload    = (CachePayload) header.payload;
+                texture.alpha_mode = (AlphaMode) header.alpha_mode;
+                texture.data       = mapping->data() + data_offset;
+                texture.mapping    = std::move(mapping);
+                m_bytes_mapped    += texture.mapping->size();
+            }
+        }
+    }
+
+    report.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    m_report.push_back(report);
+    return report.hit;
+}
+
+bool TextureCache::store(const char *source_path, AlphaMode alpha_mode, MipFilter mip_filter, const MipChain &chain)
+{
+    uint64_t hash;
+    bool     rehashed;
+    if (m_directory.empty() || !content_hash(source_path, hash, rehashed)) return false;
+    save_index();
+
+    CompressedTexture compressed;
+    const std::vector<MipLevel>      *levels = &chain.levels;
+    const std::vector<unsigned char> *data   = &chain.pixels;
+    if (m_payload != CACHE_PAYLOAD_RGBA8)
+    {
+        compressed = compress_mip_chain(chain, m_payload == CACHE_PAYLOAD_BC1 ? BLOCK_FORMAT_BC1 : BLOCK_FORMAT_BC3,
+                                        alpha_mode);
+        levels = &compressed.levels;
+        data   = &compressed.blocks;
+    }
+
+    EntryHeader header;
+    std::memcpy(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC));
+    header.version      = ENTRY_VERSION;
+    header.content_hash = hash;
+    header.payload      = (uint32_t) m_payload;
+    header.alpha_mode   = (uint32_t) alpha_mode;
+    header.mip_filter   = (uint32_t) mip_filter;
+    header.level_count  = (uint32_t) levels->size();
+
+    // Write under a temporary name and rename, so a crash mid-write never
+    // leaves a truncated entry behind for the next run to map
+    std::string   path = entry_path(hash, alpha_mode, mip_filter), temporary = path + ".tmp";
+    std::ofstream file(temporary, std::ios::binary);
+    file.write((const char *) &header, sizeof(header));
+    for (const MipLevel &mip : *levels)
+    {
+        EntryLevel level = { mip.width, mip.height, (uint64_t) mip.offset };
+        file.write((const char *) &level, sizeof(level));
+    }
+
+    const size_t  table_end = sizeof(EntryHeader) + levels->size() * sizeof(EntryLevel);
+    const char    padding[DATA_ALIGNMENT] = {};
+    file.write(padding, align_up(table_end) - table_end);
+    file.write((const char *) data->data(), data->size());
+    file.close();
+
+    if (!file || std::rename(temporary.c_str(), path.c_str()) != 0)
+    {
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+void TextureCache::print_report() const
+{
+    size_t hits = 0;
+    double milliseconds = 0.0;
+
+    std::cout << "Texture cache (" << m_directory << "):\n";
+    for (const ReportLine &line : m_report)
+    {
+        std::cout << "  " << (line.hit ? "hit  " : "miss ") << line.path
+                  << (line.rehashed ? " (rehashed)" : "") << ", " << line.milliseconds << " ms\n";
+        hits         += line.hit;
+        milliseconds += line.milliseconds;
+    }
+    std::cout << "  " << hits << " hits, " << m_report.size() - hits << " misses, "
+              << m_bytes_mapped / 1024 << " KB mapped, " << milliseconds << " ms in lookups\n";
+}
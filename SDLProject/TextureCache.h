@@ -0,0 +1,143 @@
+/**
+ * @file TextureCache.h
+ * @brief On-disk cache of decoded texture payloads shared across runs. Entries
+ * are keyed by a hash of the source file's contents plus the import settings,
+ * and are memory-mapped on a hit so the pixels go straight from the page
+ * cache to glTexImage2D without being decoded or copied.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+#ifdef _WINDOWS
+    #include <GL/glew.h>
+#endif
+#define GL_GLEXT_PROTOTYPES 1
+#include <SDL_opengl.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "BlockCompression.h"
+#include "Mipmap.h"
+#include "Texture.h"
+
+enum CachePayload
+{
+    CACHE_PAYLOAD_RGBA8, // the premultiplied mip chain as uploaded
+    CACHE_PAYLOAD_BC1,   // block compressed on store; smaller, slower misses
+    CACHE_PAYLOAD_BC3
+};
+
+/**
+ * Read-only view of a whole file, unmapped on destruction.
+ */
+class MappedFile
+{
+private:
+    const unsigned char *m_data = nullptr;
+    size_t               m_size = 0;
+#ifdef _WINDOWS
+    void *m_file_handle    = nullptr;
+    void *m_mapping_handle = nullptr;
+#endif
+
+public:
+    MappedFile() {}
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    bool open(const char *filepath);
+    void close();
+
+    const unsigned char *data() const { return m_data; };
+    size_t               size() const { return m_size; };
+};
+
+/**
+ * 64-bit xxHash (XXH64) of a buffer. Fast enough to hash a sprite sheet in
+ * a fraction of the time it takes to inflate it.
+ */
+uint64_t hash_bytes(const void *data, size_t size, uint64_t seed = 0);
+
+struct CachedTexture
+{
+    CachePayload                payload;
+    AlphaMode                   alpha_mode;
+    std::vector<MipLevel>       levels; // offsets index into data
+    const unsigned char        *data = nullptr;
+    std::unique_ptr<MappedFile> mapping;
+};
+
+/**
+ * Uploads every level to the texture bound to GL_TEXTURE_2D. Compressed
+ * payloads are decoded on the CPU if the driver lacks S3TC.
+ */
+void upload_cached_texture(const CachedTexture &texture);
+
+class TextureCache
+{
+private:
+    struct IndexEntry
+    {
+        uint64_t size;
+        int64_t  mtime;
+        uint64_t hash;
+    };
+
+    struct ReportLine
+    {
+        std::string path;
+        bool        hit;
+        bool        rehashed;
+        double      milliseconds;
+    };
+
+    std::string                                 m_directory;
+    CachePayload                                m_payload = CACHE_PAYLOAD_RGBA8;
+    std::unordered_map<std::string, IndexEntry> m_index; // source path -> last seen size, mtime and hash
+    bool                                        m_index_dirty = false;
+    std::vector<ReportLine>                     m_report;
+    uint64_t                                    m_bytes_mapped = 0;
+
+    bool        content_hash(const char *source_path, uint64_t &hash, bool &rehashed);
+    std::string entry_path(uint64_t content_hash, AlphaMode alpha_mode, MipFilter mip_filter) const;
+    void        save_index();
+
+public:
+    ~TextureCache();
+
+    /**
+     * Creates the directory if needed and loads the index that lets
+     * unchanged sources (same size and mtime) skip rehashing.
+     */
+    bool open(const char *directory);
+
+    /**
+     * What store() writes. Lookups accept whatever is on disk for the key,
+     * so changing this only affects new entries.
+     */
+    void set_payload(CachePayload payload) { m_payload = payload; };
+
+    /**
+     * Maps the entry for this source and these import settings. Returns
+     * false on a miss, including stale or corrupt entries.
+     */
+    bool lookup(const char *source_path, AlphaMode alpha_mode, MipFilter mip_filter, CachedTexture &texture);
+
+    /**
+     * Writes the chain (already converted to alpha_mode) as the entry for
+     * this source, compressing it first if the payload asks for it.
+     */
+    bool store(const char *source_path, AlphaMode alpha_mode, MipFilter mip_filter, const MipChain &chain);
+
+    /**
+     * Prints one line per lookup since open() and the hit/miss totals.
+     */
+    void print_report() const;
+};
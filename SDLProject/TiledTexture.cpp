@@ -0,0 +1,124 @@
+/**
+ * @file TiledTexture.cpp
+ * @brief Band-by-band upload of large images into a grid of textures.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#define GL_SILENCE_DEPRECATION
+
+#include "TiledTexture.h"
+#include "ImageStream.h"
+#include "glm/gtc/matrix_transform.hpp"
+
+namespace
+{
+    /**
+     * Copies the part of a band that falls inside each tile of one tile row.
+     * The unpack state lets GL read the sub-rectangle straight out of the
+     * band, so nothing is repacked on the CPU.
+     */
+    void upload_band(const TiledTexture &texture, const unsigned char *band, int first_row, int row_count)
+    {
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, texture.width);
+
+        for (int row = first_row; row < first_row + row_count;)
+        {
+            const int tile_row  = row / texture.tile_size;
+            const int tile_top  = tile_row * texture.tile_size;
+            const int rows_here = std::min(first_row + row_count, tile_top + texture.tile_height(tile_row)) - row;
+
+            for (int column = 0; column < texture.columns; column++)
+            {
+                glPixelStorei(GL_UNPACK_SKIP_PIXELS, column * texture.tile_size);
+                glBindTexture(GL_TEXTURE_2D, texture.tiles[tile_row * texture.columns + column]);
+                glTexSubImage2D(GL_TEXTURE_2D, 0, 0, row - tile_top, texture.tile_width(column), rows_here,
+                                GL_RGBA, GL_UNSIGNED_BYTE, band + (size_t) (row - first_row) * texture.width * 4);
+            }
+            row += rows_here;
+        }
+
+        glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    }
+}
+
+bool load_tiled_texture(TiledTexture &texture, const char *filepath, int tile_size, AlphaMode alpha_mode,
+                        int band_rows)
+{
+    ImageStream stream;
+    if (!stream.open(filepath)) return false;
+
+    GLint max_texture_size;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_texture_size);
+
+    texture.width     = stream.get_width();
+    texture.height    = stream.get_height();
+    texture.tile_size = std::min(tile_size, (int) max_texture_size);
+    texture.columns   = (texture.width  + texture.tile_size - 1) / texture.tile_size;
+    texture.rows      = (texture.height + texture.tile_size - 1) / texture.tile_size;
+    texture.tiles.assign((size_t) texture.columns * texture.rows, 0);
+
+    // Allocate every tile up front; the bands fill them in afterwards
+    glGenTextures((GLsizei) texture.tiles.size(), texture.tiles.data());
+    for (int row = 0; row < texture.rows; row++)
+        for (int column = 0; column < texture.columns; column++)
+        {
+            GLuint tile = texture.tiles[row * texture.columns + column];
+            glBindTexture(GL_TEXTURE_2D, tile);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, texture.tile_width(column), texture.tile_height(row), 0,
+                         GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            set_texture_alpha_mode(tile, alpha_mode);
+        }
+
+    std::vector<unsigned char> band((size_t) band_rows * texture.width * 4);
+    while (stream.rows_read() < texture.height)
+    {
+        int first_row = stream.rows_read();
+        int rows      = stream.read_rows(band.data(), band_rows);
+        if (rows == 0) break;
+
+        size_t pixel_count = (size_t) rows * texture.width;
+        if (alpha_mode == PREMULTIPLIED_ALPHA) premultiply_alpha(band.data(), pixel_count);
+        else if (alpha_mode == ADDITIVE)       premultiply_additive(band.data(), pixel_count);
+
+        upload_band(texture, band.data(), first_row, rows);
+    }
+
+    // A truncated file leaves the remaining rows undefined but the texture usable
+    return stream.rows_read() == texture.height;
+}
+
+void delete_tiled_texture(TiledTexture &texture)
+{
+    if (!texture.tiles.empty()) glDeleteTextures((GLsizei) texture.tiles.size(), texture.tiles.data());
+    texture.tiles.clear();
+    texture.columns = texture.rows = 0;
+}
+
+void draw_tiled_texture(const TiledTexture &texture, ShaderProgram &program, const glm::mat4 &model_matrix)
+{
+    for (int row = 0; row < texture.rows; row++)
+        for (int column = 0; column < texture.columns; column++)
+        {
+            // Place this tile's share of the unit quad, measured from the top
+            // left corner since image rows run downwards
+            float tile_width  = (float) texture.tile_width(column) / texture.width,
+                  tile_height = (float) texture.tile_height(row)   / texture.height;
+            float centre_x = (float) column * texture.tile_size / texture.width  + tile_width  * 0.5f - 0.5f,
+                  centre_y = 0.5f - (float) row * texture.tile_size / texture.height - tile_height * 0.5f;
+
+            glm::mat4 tile_matrix = glm::translate(model_matrix, glm::vec3(centre_x, centre_y, 0.0f));
+            tile_matrix = glm::scale(tile_matrix, glm::vec3(tile_width, tile_height, 1.0f));
+
+            program.set_model_matrix(tile_matrix);
+            glBindTexture(GL_TEXTURE_2D, texture.tiles[row * texture.columns + column]);
+            glDrawArrays(GL_TRIANGLES, 0, 6);
+        }
+}
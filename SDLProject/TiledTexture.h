@@ -0,0 +1,53 @@
+/**
+ * @file TiledTexture.h
+ * @brief Images larger than GL_MAX_TEXTURE_SIZE (or too large to decode in
+ * one go) split into a grid of textures, filled band by band from an
+ * ImageStream with glTexSubImage2D.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+#ifdef _WINDOWS
+    #include <GL/glew.h>
+#endif
+#define GL_GLEXT_PROTOTYPES 1
+#include <SDL_opengl.h>
+#include <algorithm>
+#include <vector>
+#include "glm/mat4x4.hpp"
+#include "ShaderProgram.h"
+#include "Texture.h"
+
+struct TiledTexture
+{
+    int                 width     = 0;
+    int                 height    = 0;
+    int                 tile_size = 0;
+    int                 columns   = 0;
+    int                 rows      = 0;
+    std::vector<GLuint> tiles; // row-major, row 0 at the top of the image
+
+    int tile_width(int column) const { return std::min(tile_size, width  - column * tile_size); }
+    int tile_height(int row)   const { return std::min(tile_size, height - row    * tile_size); }
+};
+
+/**
+ * Streams the image into tile_size x tile_size textures. Only band_rows
+ * scanlines are held on the CPU at a time (for streamable files, see
+ * ImageStream), so a 16K x 16K background costs a few MB of RAM rather than
+ * 1 GB. Returns false if the file can't be read.
+ */
+bool load_tiled_texture(TiledTexture &texture, const char *filepath, int tile_size = 2048,
+                        AlphaMode alpha_mode = PREMULTIPLIED_ALPHA, int band_rows = 64);
+
+void delete_tiled_texture(TiledTexture &texture);
+
+/**
+ * Draws every tile over the unit quad that model_matrix places, exactly where
+ * a single texture of the whole image would have gone. Expects the six
+ * SpriteVertex quad vertices to be bound with bind_sprite_vertices().
+ */
+void draw_tiled_texture(const TiledTexture &texture, ShaderProgram &program, const glm::mat4 &model_matrix);
@@ -0,0 +1,235 @@
+/**
+ * @file TransformHierarchy.cpp
+ * @brief Node bookkeeping and the breadth-first update. Structural changes
+ * only edit the per-handle links; the flat arrays are re-sorted once, at
+ * the next update(), however many changes were made.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#include "TransformHierarchy.h"
+#include <algorithm>
+#include <cassert>
+
+namespace
+{
+    const uint32_t ROOT_PARENT = 0xFFFFFFFFu;
+}
+
+/* ------------------------------ Structure ------------------------------ */
+
+void TransformHierarchy::link(TransformNode node, TransformNode parent)
+{
+    TransformNode &head = parent == NO_TRANSFORM_NODE ? m_first_root : m_links[parent].first_child;
+
+    Links &links = m_links[node];
+    links.parent       = parent;
+    links.prev_sibling = NO_TRANSFORM_NODE;
+    links.next_sibling = head;
+    if (head != NO_TRANSFORM_NODE) m_links[head].prev_sibling = node;
+    head = node;
+}
+
+void TransformHierarchy::unlink(TransformNode node)
+{
+    Links &links = m_links[node];
+    if (links.prev_sibling != NO_TRANSFORM_NODE)  m_links[links.prev_sibling].next_sibling = links.next_sibling;
+    else if (links.parent != NO_TRANSFORM_NODE)   m_links[links.parent].first_child = links.next_sibling;
+    else                                          m_first_root = links.next_sibling;
+    if (links.next_sibling != NO_TRANSFORM_NODE)  m_links[links.next_sibling].prev_sibling = links.prev_sibling;
+
+    links.parent = links.prev_sibling = links.next_sibling = NO_TRANSFORM_NODE;
+}
+
+TransformNode TransformHierarchy::create(TransformNode parent, const glm::affine2d &local)
+{
+    assert(parent == NO_TRANSFORM_NODE || (parent < m_links.size() && m_links[parent].alive));
+
+    TransformNode node;
+    if (!m_free_nodes.empty())
+    {
+        node = m_free_nodes.back();
+        m_free_nodes.pop_back();
+    }
+    else
+    {
+        node = (TransformNode) m_links.size();
+        m_links.push_back(Links());
+    }
+
+    m_links[node] = Links();
+    m_links[node].alive = true;
+    link(node, parent);
+
+    // Appended for now; the next update() sorts it into place
+    uint32_t index = (uint32_t) m_local.size();
+    m_links[node].index = index;
+    m_local.push_back(local);
+    m_world.push_back(local);
+    m_parent.push_back(parent == NO_TRANSFORM_NODE ? ROOT_PARENT : m_links[parent].index);
+    m_first_child.push_back(0);
+    m_child_count.push_back(0);
+    m_dirty.push_back(0);
+    mark_dirty(index);
+
+    m_order_changed = true;
+    m_node_count++;
+    return node;
+}
+
+void TransformHierarchy::destroy(TransformNode node)
+{
+    assert(node < m_links.size() && m_links[node].alive);
+
+    unlink(node);
+
+    // Free the subtree; its array entries are dropped by the next sort
+    std::vector<TransformNode> pending(1, node);
+    while (!pending.empty())
+    {
+        TransformNode current = pending.back();
+        pending.pop_back();
+        for (TransformNode child = m_links[current].first_child; child != NO_TRANSFORM_NODE;
+             child = m_links[child].next_sibling)
+        {
+            pending.push_back(child);
+        }
+
+        m_links[current].alive = false;
+        m_free_nodes.push_back(current);
+        m_node_count--;
+    }
+
+    m_order_changed = true;
+}
+
+void TransformHierarchy::set_parent(TransformNode node, TransformNode parent)
+{
+    assert(node < m_links.size() && m_links[node].alive);
+    assert(parent == NO_TRANSFORM_NODE || (parent < m_links.size() && m_links[parent].alive));
+    if (m_links[node].parent == parent) return;
+
+#ifndef NDEBUG
+    for (TransformNode ancestor = parent; ancestor != NO_TRANSFORM_NODE; ancestor = m_links[ancestor].parent)
+        assert(ancestor != node && "a node cannot be moved under its own subtree");
+#endif
+
+    unlink(node);
+    link(node, parent);
+    mark_dirty(m_links[node].index);
+    m_order_changed = true;
+}
+
+// Rebuilds the arrays from the links, roots first and then each level in
+// turn. Every node is placed before its children are queued, so the links
+// of a parent already hold its new index when its children read it.
+void TransformHierarchy::sort_breadth_first()
+{
+    std::vector<TransformNode> order;
+    order.reserve(m_node_count);
+    for (TransformNode root = m_first_root; root != NO_TRANSFORM_NODE; root = m_links[root].next_sibling)
+        order.push_back(root);
+
+    std::vector<glm::affine2d> local(m_node_count), world(m_node_count);
+    std::vector<uint32_t> parent(m_node_count), first_child(m_node_count), child_count(m_node_count);
+    std::vector<uint8_t> dirty(m_node_count);
+
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        Links &links = m_links[order[i]];
+        uint32_t previous = links.index;
+
+        local[i] = m_local[previous];
+        world[i] = m_world[previous];
+        dirty[i] = m_dirty[previous];
+        parent[i] = links.parent == NO_TRANSFORM_NODE ? ROOT_PARENT : m_links[links.parent].index;
+        links.index = (uint32_t) i;
+
+        first_child[i] = (uint32_t) order.size();
+        for (TransformNode child = links.first_child; child != NO_TRANSFORM_NODE; child = m_links[child].next_sibling)
+            order.push_back(child);
+        child_count[i] = (uint32_t) order.size() - first_child[i];
+    }
+    assert(order.size() == m_node_count);
+
+    m_local.swap(local);
+    m_world.swap(world);
+    m_parent.swap(parent);
+    m_first_child.swap(first_child);
+    m_child_count.swap(child_count);
+    m_dirty.swap(dirty);
+
+    // The sort renumbered the dirty nodes too, and leaves them ascending
+    m_dirty_indices.clear();
+    for (size_t i = 0; i < m_node_count; i++)
+        if (m_dirty[i]) m_dirty_indices.push_back((uint32_t) i);
+
+    m_order_changed = false;
+}
+
+/* ------------------------------- Update ------------------------------- */
+
+void TransformHierarchy::mark_dirty(uint32_t index)
+{
+    if (m_dirty[index]) return;
+    m_dirty[index] = 1;
+    m_dirty_indices.push_back(index);
+}
+
+void TransformHierarchy::set_local(TransformNode node, const glm::affine2d &local)
+{
+    assert(node < m_links.size() && m_links[node].alive);
+
+    uint32_t index = m_links[node].index;
+    m_local[index] = local;
+    mark_dirty(index);
+}
+
+// The children of a run of nodes on one level are the next level's run, so
+// the subtree is walked as one contiguous range per level
+void TransformHierarchy::update_subtree(uint32_t root)
+{
+    m_world[root] = m_parent[root] == ROOT_PARENT ? m_local[root] : m_world[m_parent[root]] * m_local[root];
+    m_dirty[root] = 0;
+    m_updated_count++;
+
+    uint32_t begin = root, end = root + 1;
+    for (;;)
+    {
+        uint32_t next_begin = m_first_child[begin];
+        uint32_t next_end   = m_first_child[end - 1] + m_child_count[end - 1];
+        if (next_begin == next_end) break;
+
+        for (uint32_t i = next_begin; i < next_end; i++)
+        {
+            m_world[i] = m_world[m_parent[i]] * m_local[i];
+            m_dirty[i] = 0;
+        }
+        m_updated_count += next_end - next_begin;
+
+        begin = next_begin;
+        end   = next_end;
+    }
+}
+
+void TransformHierarchy::update()
+{
+    m_updated_count = 0;
+
+    if (m_order_changed) sort_breadth_first();
+    else std::sort(m_dirty_indices.begin(), m_dirty_indices.end());
+
+    // Ascending order reaches ancestors first; a node whose flag is already
+    // clear was recomputed as part of one
+    for (uint32_t index : m_dirty_indices)
+        if (m_dirty[index]) update_subtree(index);
+
+    m_dirty_indices.clear();
+}
+
+void TransformHierarchy::get_world_bounds(const TransformNode *nodes, size_t count, glm::vec2 local_min,
+                                          glm::vec2 local_max, glm::vec2 *min, glm::vec2 *max) const
+{
+    for (size_t i = 0; i < count; i++) glm::transformAABB(get_world(nodes[i]), local_min, local_max, min[i], max[i]);
+}
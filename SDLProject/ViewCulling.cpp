@@ -0,0 +1,150 @@
+/**
+ * @file ViewCulling.cpp
+ * @brief The box tests. Boxes are read straight from the vec2 arrays, two
+ * per SSE2 register or four per AVX2 register as (x, y) pairs, compared
+ * against the view in every lane at once, and the lane masks reduced to one
+ * bit per box.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#include "ViewCulling.h"
+#include "MatrixBatch.h"
+#include "glm/glm.hpp"
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define VIEW_CULLING_X86 1
+    #include <immintrin.h>
+#endif
+
+namespace
+{
+    // Appends first + k for each box k whose x and y lane bits, 2k and
+    // 2k + 1, are both set. Branch-free: every slot is written, and the
+    // count only moves past the visible boxes.
+    inline size_t append_visible(unsigned lane_bits, size_t box_count, size_t first, uint32_t *visible, size_t n)
+    {
+        unsigned both = lane_bits & (lane_bits >> 1);
+        for (size_t k = 0; k < box_count; k++)
+        {
+            visible[n] = (uint32_t) (first + k);
+            n += (both >> (2 * k)) & 1u;
+        }
+        return n;
+    }
+
+    // Boxes [first, count), one at a time; the vector kernels finish with this
+    size_t cull_scalar(const glm::vec2 *min, const glm::vec2 *max, size_t first, size_t count,
+                       glm::vec2 view_min, glm::vec2 view_max, uint32_t *visible, size_t n)
+    {
+        for (size_t i = first; i < count; i++)
+        {
+            bool in_view = min[i].x <= view_max.x && min[i].y <= view_max.y &&
+                           max[i].x >= view_min.x && max[i].y >= view_min.y;
+            visible[n] = (uint32_t) i;
+            n += in_view ? 1 : 0;
+        }
+        return n;
+    }
+
+#ifdef VIEW_CULLING_X86
+    /* -------------------------------- SSE2 ------------------------------- */
+
+    size_t cull_sse2(const glm::vec2 *min, const glm::vec2 *max, size_t count,
+                     glm::vec2 view_min, glm::vec2 view_max, uint32_t *visible)
+    {
+        const __m128 low  = _mm_setr_ps(view_min.x, view_min.y, view_min.x, view_min.y);
+        const __m128 high = _mm_setr_ps(view_max.x, view_max.y, view_max.x, view_max.y);
+
+        size_t i = 0, n = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 in_0 = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(&min[i].x), high),
+                                     _mm_cmpge_ps(_mm_loadu_ps(&max[i].x), low));
+            __m128 in_1 = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(&min[i + 2].x), high),
+                                     _mm_cmpge_ps(_mm_loadu_ps(&max[i + 2].x), low));
+
+            unsigned lane_bits = (unsigned) _mm_movemask_ps(in_0) | (unsigned) _mm_movemask_ps(in_1) << 4;
+            if (lane_bits == 0) continue;
+            n = append_visible(lane_bits, 4, i, visible, n);
+        }
+
+        return cull_scalar(min, max, i, count, view_min, view_max, visible, n);
+    }
+
+    /* -------------------------------- AVX2 ------------------------------- */
+
+#if defined(__clang__)
+    #pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__GNUC__)
+    #pragma GCC push_options
+    #pragma GCC target("avx2")
+#endif
+
+    size_t cull_avx2(const glm::vec2 *min, const glm::vec2 *max, size_t count,
+                     glm::vec2 view_min, glm::vec2 view_max, uint32_t *visible)
+    {
+        const __m256 low  = _mm256_setr_ps(view_min.x, view_min.y, view_min.x, view_min.y,
+                                           view_min.x, view_min.y, view_min.x, view_min.y);
+        const __m256 high = _mm256_setr_ps(view_max.x, view_max.y, view_max.x, view_max.y,
+                                           view_max.x, view_max.y, view_max.x, view_max.y);
+
+        size_t i = 0, n = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 in_0 = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(&min[i].x), high, _CMP_LE_OQ),
+                                        _mm256_cmp_ps(_mm256_loadu_ps(&max[i].x), low, _CMP_GE_OQ));
+            __m256 in_1 = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(&min[i + 4].x), high, _CMP_LE_OQ),
+                                        _mm256_cmp_ps(_mm256_loadu_ps(&max[i + 4].x), low, _CMP_GE_OQ));
+
+            unsigned lane_bits = (unsigned) _mm256_movemask_ps(in_0) | (unsigned) _mm256_movemask_ps(in_1) << 8;
+            if (lane_bits == 0) continue;
+            n = append_visible(lane_bits, 8, i, visible, n);
+        }
+
+        return cull_scalar(min, max, i, count, view_min, view_max, visible, n);
+    }
+
+#if defined(__clang__)
+    #pragma clang attribute pop
+#elif defined(__GNUC__)
+    #pragma GCC pop_options
+#endif
+#endif
+}
+
+void get_visible_rect(const glm::mat4 &view_projection, glm::vec2 &view_min, glm::vec2 &view_max)
+{
+    // Orthographic, so w stays 1 and the xy part of the matrix is a 2D
+    // affine map: invert it and take the box around the screen's corners
+    glm::mat3 screen_from_world(glm::vec3(view_projection[0].x, view_projection[0].y, 0.0f),
+                                glm::vec3(view_projection[1].x, view_projection[1].y, 0.0f),
+                                glm::vec3(view_projection[3].x, view_projection[3].y, 1.0f));
+    glm::mat3 world_from_screen = glm::inverse(screen_from_world);
+
+    view_min = glm::vec2(INFINITY);
+    view_max = glm::vec2(-INFINITY);
+    for (int corner = 0; corner < 4; corner++)
+    {
+        glm::vec3 screen((corner & 1) ? 1.0f : -1.0f, (corner & 2) ? 1.0f : -1.0f, 1.0f);
+        glm::vec2 world = glm::vec2(world_from_screen * screen);
+        view_min = glm::min(view_min, world);
+        view_max = glm::max(view_max, world);
+    }
+}
+
+size_t cull_boxes(const glm::vec2 *min, const glm::vec2 *max, size_t count,
+                  glm::vec2 view_min, glm::vec2 view_max, uint32_t *visible)
+{
+    switch (get_matrix_batch_isa())
+    {
+#ifdef VIEW_CULLING_X86
+        case MATRIX_BATCH_AVX512:
+        case MATRIX_BATCH_AVX2:   return cull_avx2(min, max, count, view_min, view_max, visible);
+        case MATRIX_BATCH_SSE2:   return cull_sse2(min, max, count, view_min, view_max, visible);
+#endif
+        default:                  return cull_scalar(min, max, 0, count, view_min, view_max, visible, 0);
+    }
+}
@@ -0,0 +1,36 @@
+/**
+ * @file ViewCulling.h
+ * @brief Drops sprites that are off screen before they reach the renderer.
+ * World-space bounding boxes are tested against the rectangle the camera
+ * sees, four boxes per iteration with SSE2 or eight with AVX2 (whichever
+ * get_matrix_batch_isa() allows), and the survivors come out as a compact
+ * list of indices. Runs where every box is off screen cost a couple of
+ * compares and a branch.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "glm/mat4x4.hpp"
+#include "glm/vec2.hpp"
+
+/**
+ * The world-space rectangle on the z = 0 plane that view_projection maps
+ * onto the screen, for an orthographic projection. If the view is rotated
+ * this is the bounding box of what is visible, so culling stays
+ * conservative.
+ */
+void get_visible_rect(const glm::mat4 &view_projection, glm::vec2 &view_min, glm::vec2 &view_max);
+
+/**
+ * Writes the index of every box [min[i], max[i]] that overlaps or touches
+ * [view_min, view_max] to visible, in ascending order, and returns how many
+ * there are. visible needs room for count indices. Boxes with a NaN bound
+ * are culled.
+ */
+size_t cull_boxes(const glm::vec2 *min, const glm::vec2 *max, size_t count,
+                  glm::vec2 view_min, glm::vec2 view_max, uint32_t *visible);
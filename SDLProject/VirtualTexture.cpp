@@ -0,0 +1,540 @@
+/**
+ * @file VirtualTexture.cpp
+ * @brief Page file builder, background page loading and the LRU page cache.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#define GL_SILENCE_DEPRECATION
+
+#include "VirtualTexture.h"
+#include "ImageStream.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "glm/glm.hpp"
+
+namespace
+{
+    constexpr char     PAGE_FILE_MAGIC[4] = { 'V', 'T', 'E', 'X' };
+    constexpr uint64_t NO_PAGE            = ~0ull;
+    constexpr int      BUILD_BAND_ROWS    = 64;
+
+    struct LevelSize { int width, height, pages_x, pages_y; };
+
+    /**
+     * Level l covers level-0 texels in 2^l x 2^l blocks, down to the first
+     * level that fits in one page. Shared by the builder and the reader so
+     * the file only has to store level 0.
+     */
+    std::vector<LevelSize> pyramid_levels(int width, int height, int page_size)
+    {
+        std::vector<LevelSize> levels;
+        for (;;)
+        {
+            levels.push_back({ width, height, (width + page_size - 1) / page_size, (height + page_size - 1) / page_size });
+            if (width <= page_size && height <= page_size) return levels;
+            width  = (width  + 1) / 2;
+            height = (height + 1) / 2;
+        }
+    }
+
+    /**
+     * Receives one level's rows top to bottom, holds just enough of them for
+     * a row of bordered pages, and writes each page row as soon as its bottom
+     * border arrives. Every second row pair is box-filtered into the next
+     * level, so the whole pyramid is built in one pass over the source.
+     */
+    class PyramidWriter
+    {
+    private:
+        struct Level
+        {
+            LevelSize                  size;
+            size_t                     first_page;
+            std::vector<unsigned char> window;   // rows [page_row * P - B, (page_row + 1) * P + B)
+            std::vector<unsigned char> pending;  // unpaired row waiting to be downsampled
+            bool                       has_pending = false;
+            int                        rows_received = 0;
+            int                        page_row      = 0;
+        };
+
+        std::ofstream         &m_file;
+        std::vector<uint64_t> &m_offsets;
+        std::vector<Level>     m_levels;
+        std::vector<unsigned char> m_page;
+        int m_page_size, m_border, m_stride;
+
+        unsigned char *window_row(Level &level, int index)
+        {
+            return level.window.data() + (size_t) index * level.size.width * 4;
+        }
+
+        void write_page_row(Level &level)
+        {
+            const int width = level.size.width;
+            for (int column = 0; column < level.size.pages_x; column++)
+            {
+                for (int y = 0; y < m_stride; y++)
+                {
+                    const unsigned char *source = window_row(level, y);
+                    unsigned char       *target = m_page.data() + (size_t) y * m_stride * 4;
+                    for (int x = 0; x < m_stride; x++)
+                    {
+                        int source_x = std::min(std::max(column * m_page_size - m_border + x, 0), width - 1);
+                        std::memcpy(target + x * 4, source + source_x * 4, 4);
+                    }
+                }
+
+                m_offsets[level.first_page + (size_t) level.page_row * level.size.pages_x + column] = (uint64_t) m_file.tellp();
+                m_file.write((const char *) m_page.data(), m_page.size());
+            }
+
+            // The last 2B rows are the top border and first rows of the next page row
+            const size_t row_bytes = (size_t) width * 4;
+            std::memmove(window_row(level, 0), window_row(level, m_page_size), 2 * m_border * row_bytes);
+            level.page_row++;
+        }
+
+        void downsample(size_t level_index, const unsigned char *upper, const unsigned char *lower)
+        {
+            const Level &level = m_levels[level_index];
+            const int    width = level.size.width, half_width = m_levels[level_index + 1].size.width;
+
+            std::vector<unsigned char> half((size_t) half_width * 4);
+            for (int x = 0; x < half_width; x++)
+            {
+                int left = 2 * x, right = std::min(2 * x + 1, width - 1);
+                for (int c = 0; c < 4; c++)
+                    half[x * 4 + c] = (unsigned char) ((upper[left * 4 + c] + upper[right * 4 + c] +
+                                                        lower[left * 4 + c] + lower[right * 4 + c] + 2) >> 2);
+            }
+            push_row(level_index + 1, half.data());
+        }
+
+    public:
+        PyramidWriter(std::ofstream &file, std::vector<uint64_t> &offsets, const std::vector<LevelSize> &sizes,
+                      int page_size, int border)
+            : m_file(file), m_offsets(offsets), m_page_size(page_size), m_border(border),
+              m_stride(page_size + 2 * border)
+        {
+            size_t first_page = 0;
+            for (const LevelSize &size : sizes)
+            {
+                Level level;
+                level.size       = size;
+                level.first_page = first_page;
+                level.window.resize((size_t) m_stride * size.width * 4);
+                level.pending.resize((size_t) size.width * 4);
+                m_levels.push_back(std::move(level));
+                first_page += (size_t) size.pages_x * size.pages_y;
+            }
+            m_offsets.assign(first_page, 0);
+            m_page.resize((size_t) m_stride * m_stride * 4);
+        }
+
+        void push_row(size_t level_index, const unsigned char *row)
+        {
+            Level       &level     = m_levels[level_index];
+            const size_t row_bytes = (size_t) level.size.width * 4;
+            const int    y         = level.rows_received++;
+
+            // Clamp to edge above the first row
+            if (y == 0) for (int i = 0; i < m_border; i++) std::memcpy(window_row(level, i), row, row_bytes);
+            std::memcpy(window_row(level, y - (level.page_row * m_page_size - m_border)), row, row_bytes);
+
+            if (y == (level.page_row + 1) * m_page_size + m_border - 1) write_page_row(level);
+
+            if (y == level.size.height - 1)
+            {
+                // Clamp to edge below the last row for whatever page rows remain
+                while (level.page_row < level.size.pages_y)
+                {
+                    for (int i = y - (level.page_row * m_page_size - m_border) + 1; i < m_stride; i++)
+                        std::memcpy(window_row(level, i), row, row_bytes);
+                    write_page_row(level);
+                }
+            }
+
+            if (level_index + 1 == m_levels.size()) return;
+
+            if (level.has_pending)
+            {
+                downsample(level_index, level.pending.data(), row);
+                level.has_pending = false;
+            }
+            else if (y == level.size.height - 1) downsample(level_index, row, row); // odd height
+            else
+            {
+                std::memcpy(level.pending.data(), row, row_bytes);
+                level.has_pending = true;
+            }
+        }
+    };
+
+    size_t page_bytes(int stride) { return (size_t) stride * stride * 4; }
+}
+
+bool build_virtual_texture_file(const char *image_path, const char *page_file_path, AlphaMode alpha_mode,
+                                int page_size)
+{
+    ImageStream stream;
+    if (!stream.open(image_path)) return false;
+
+    std::ofstream file(page_file_path, std::ios::binary);
+    if (!file) return false;
+
+    const int width = stream.get_width(), height = stream.get_height();
+    std::vector<LevelSize> levels = pyramid_levels(width, height, page_size);
+
+    int32_t header[6] = { width, height, page_size, VIRTUAL_PAGE_BORDER, (int32_t) alpha_mode, (int32_t) levels.size() };
+    file.write(PAGE_FILE_MAGIC, sizeof(PAGE_FILE_MAGIC));
+    file.write((const char *) header, sizeof(header));
+
+    // Reserve the page table; it is filled in once every page has been placed
+    std::vector<uint64_t> offsets;
+    PyramidWriter writer(file, offsets, levels, page_size, VIRTUAL_PAGE_BORDER);
+    const std::streampos table_position = file.tellp();
+    file.write((const char *) offsets.data(), offsets.size() * sizeof(uint64_t));
+
+    std::vector<unsigned char> band((size_t) BUILD_BAND_ROWS * width * 4);
+    while (stream.rows_read() < height)
+    {
+        int rows = stream.read_rows(band.data(), BUILD_BAND_ROWS);
+        if (rows == 0) return false;
+
+        size_t pixel_count = (size_t) rows * width;
+        if (alpha_mode == PREMULTIPLIED_ALPHA) premultiply_alpha(band.data(), pixel_count);
+        else if (alpha_mode == ADDITIVE)       premultiply_additive(band.data(), pixel_count);
+
+        for (int row = 0; row < rows; row++) writer.push_row(0, band.data() + (size_t) row * width * 4);
+    }
+
+    file.seekp(table_position);
+    file.write((const char *) offsets.data(), offsets.size() * sizeof(uint64_t));
+    return (bool) file;
+}
+
+VirtualTexture::~VirtualTexture()
+{
+    close();
+}
+
+bool VirtualTexture::open(const char *page_file_path, int cache_pages_across, unsigned thread_count)
+{
+    close();
+
+    std::ifstream file(page_file_path, std::ios::binary);
+    if (!file) return false;
+
+    char    magic[4];
+    int32_t header[6];
+    file.read(magic, sizeof(magic));
+    file.read((char *) header, sizeof(header));
+    if (!file || std::memcmp(magic, PAGE_FILE_MAGIC, sizeof(magic)) != 0 || header[0] <= 0 || header[1] <= 0 ||
+        header[2] <= 0 || header[3] < 0 || header[4] > ADDITIVE) return false;
+
+    m_width      = header[0];
+    m_height     = header[1];
+    m_page_size  = header[2];
+    m_border     = header[3];
+    m_stride     = m_page_size + 2 * m_border;
+    m_alpha_mode = (AlphaMode) header[4];
+    m_page_file_path = page_file_path;
+
+    size_t page_count = 0;
+    for (const LevelSize &size : pyramid_levels(m_width, m_height, m_page_size))
+    {
+        m_levels.push_back({ size.width, size.height, size.pages_x, size.pages_y, page_count });
+        page_count += (size_t) size.pages_x * size.pages_y;
+    }
+    if ((int) m_levels.size() != header[5]) return false;
+
+    m_page_offsets.resize(page_count);
+    file.read((char *) m_page_offsets.data(), page_count * sizeof(uint64_t));
+    if (!file) return false;
+
+    GLint max_texture_size;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_texture_size);
+
+    // The indirection table stores slot coordinates in 8 bits
+    m_slots_across = std::min(std::min(cache_pages_across, (int) max_texture_size / m_stride), 256);
+    if (m_slots_across < 1 || m_levels[0].pages_x > max_texture_size || m_levels[0].pages_y > max_texture_size)
+        return false;
+    m_slot_keys.assign((size_t) m_slots_across * m_slots_across, NO_PAGE);
+
+    const int cache_size = m_slots_across * m_stride;
+    glGenTextures(1, &m_cache_texture_id);
+    glBindTexture(GL_TEXTURE_2D, m_cache_texture_id);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, cache_size, cache_size, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    set_texture_alpha_mode(m_cache_texture_id, m_alpha_mode);
+
+    m_table.assign((size_t) m_levels[0].pages_x * m_levels[0].pages_y * 4, 0);
+    glGenTextures(1, &m_table_texture_id);
+    glBindTexture(GL_TEXTURE_2D, m_table_texture_id);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_levels[0].pages_x, m_levels[0].pages_y, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, m_table.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    // The coarsest level is a single page; keep it resident for good
+    LoadedPage root = { page_key((int) m_levels.size() - 1, 0, 0), {} };
+    if (!read_page(file, root.key, root.pixels)) return false;
+    upload_page(root);
+    m_resident[root.key].last_used = UINT64_MAX;
+    rebuild_table();
+
+    m_stopping = false;
+    for (unsigned i = 0; i < std::max(1u, thread_count); i++) m_workers.emplace_back(&VirtualTexture::worker_loop, this);
+    return true;
+}
+
+void VirtualTexture::close()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    for (std::thread &worker : m_workers) worker.join();
+    m_workers.clear();
+
+    if (m_cache_texture_id) glDeleteTextures(1, &m_cache_texture_id);
+    if (m_table_texture_id) glDeleteTextures(1, &m_table_texture_id);
+    m_cache_texture_id = m_table_texture_id = 0;
+
+    m_levels.clear();
+    m_page_offsets.clear();
+    m_slot_keys.clear();
+    m_resident.clear();
+    m_table.clear();
+    m_requests.clear();
+    m_in_flight.clear();
+    m_loaded.clear();
+}
+
+bool VirtualTexture::read_page(std::ifstream &file, uint64_t key, std::vector<unsigned char> &pixels) const
+{
+    const Level &level = m_levels[key >> 48];
+    const int    x = (int) (key & 0xFFFFFF), y = (int) ((key >> 24) & 0xFFFFFF);
+
+    pixels.resize(page_bytes(m_stride));
+    file.clear();
+    file.seekg((std::streamoff) m_page_offsets[level.first_page + (size_t) y * level.pages_x + x]);
+    file.read((char *) pixels.data(), pixels.size());
+    return (bool) file;
+}
+
+void VirtualTexture::worker_loop()
+{
+    std::ifstream file(m_page_file_path, std::ios::binary);
+
+    for (;;)
+    {
+        uint64_t key;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this] { return m_stopping || !m_requests.empty(); });
+            if (m_stopping) return;
+
+            key = m_requests.front();
+            m_requests.pop_front();
+            m_in_flight.push_back(key);
+        }
+
+        // An unreadable page comes back empty so it still leaves m_in_flight
+        LoadedPage page = { key, {} };
+        if (!read_page(file, key, page.pixels)) page.pixels.clear();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_loaded.push_back(std::move(page));
+    }
+}
+
+int VirtualTexture::allocate_slot()
+{
+    for (size_t slot = 0; slot < m_slot_keys.size(); slot++)
+        if (m_slot_keys[slot] == NO_PAGE) return (int) slot;
+
+    // Evict the least recently used page that this frame doesn't need
+    auto victim = m_resident.end();
+    for (auto it = m_resident.begin(); it != m_resident.end(); ++it)
+        if (it->second.last_used < m_frame && (victim == m_resident.end() || it->second.last_used < victim->second.last_used))
+            victim = it;
+    if (victim == m_resident.end()) return -1;
+
+    int slot = victim->second.slot;
+    m_resident.erase(victim);
+    m_slot_keys[slot] = NO_PAGE;
+    m_table_dirty = true;
+    return slot;
+}
+
+void VirtualTexture::upload_page(const LoadedPage &page)
+{
+    if (page.pixels.empty() || m_resident.count(page.key)) return;
+
+    int slot = allocate_slot();
+    if (slot < 0) return;
+
+    glBindTexture(GL_TEXTURE_2D, m_cache_texture_id);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, (slot % m_slots_across) * m_stride, (slot / m_slots_across) * m_stride,
+                    m_stride, m_stride, GL_RGBA, GL_UNSIGNED_BYTE, page.pixels.data());
+
+    m_resident[page.key] = { slot, m_frame };
+    m_slot_keys[slot] = page.key;
+    m_table_dirty = true;
+}
+
+void VirtualTexture::rebuild_table()
+{
+    // Paint coarse to fine so each level-0 page ends up pointing at the
+    // finest resident page that covers it
+    std::vector<std::pair<uint64_t, int>> pages;
+    for (const auto &entry : m_resident) pages.push_back({ entry.first, entry.second.slot });
+    std::sort(pages.begin(), pages.end(), [](const std::pair<uint64_t, int> &a, const std::pair<uint64_t, int> &b)
+              { return (a.first >> 48) > (b.first >> 48); });
+
+    const int table_width = m_levels[0].pages_x, table_height = m_levels[0].pages_y;
+    for (const auto &page : pages)
+    {
+        const int level = (int) (page.first >> 48), span = 1 << level;
+        const int x = (int) (page.first & 0xFFFFFF), y = (int) ((page.first >> 24) & 0xFFFFFF);
+
+        for (int table_y = y * span; table_y < std::min((y + 1) * span, table_height); table_y++)
+            for (int table_x = x * span; table_x < std::min((x + 1) * span, table_width); table_x++)
+            {
+                unsigned char *entry = &m_table[((size_t) table_y * table_width + table_x) * 4];
+                entry[0] = (unsigned char) (page.second % m_slots_across);
+                entry[1] = (unsigned char) (page.second / m_slots_across);
+                entry[2] = (unsigned char) level;
+                entry[3] = 255;
+            }
+    }
+
+    glBindTexture(GL_TEXTURE_2D, m_table_texture_id);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, table_width, table_height, GL_RGBA, GL_UNSIGNED_BYTE, m_table.data());
+    m_table_dirty = false;
+}
+
+void VirtualTexture::update(const glm::mat4 &projection_matrix, const glm::mat4 &view_matrix,
+                            const glm::mat4 &model_matrix, int viewport_width, int viewport_height)
+{
+    if (m_levels.empty()) return;
+    m_frame++;
+
+    const glm::mat4 mvp = projection_matrix * view_matrix * model_matrix;
+
+    // Screen pixels covered by one unit of the quad along each axis decide
+    // how many texels land on a pixel, and so the level worth loading
+    float pixels_x = glm::length(glm::vec2(mvp[0].x * viewport_width, mvp[0].y * viewport_height)) * 0.5f,
+          pixels_y = glm::length(glm::vec2(mvp[1].x * viewport_width, mvp[1].y * viewport_height)) * 0.5f;
+    float texels_per_pixel = std::max(m_width / std::max(pixels_x, 1e-6f), m_height / std::max(pixels_y, 1e-6f));
+
+    const int coarsest = (int) m_levels.size() - 1;
+    int level = std::min(std::max((int) std::floor(std::log2(std::max(texels_per_pixel, 1.0f))), 0), coarsest);
+
+    // Visible part of the quad in texture coordinates (v = 0 at the top row)
+    const glm::mat4 inverse = glm::inverse(mvp);
+    const float     depth   = (mvp * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)).z;
+    float u0 = 1.0f, v0 = 1.0f, u1 = 0.0f, v1 = 0.0f;
+    for (int corner = 0; corner < 4; corner++)
+    {
+        glm::vec4 local = inverse * glm::vec4(corner & 1 ? 1.0f : -1.0f, corner & 2 ? 1.0f : -1.0f, depth, 1.0f);
+        float u = local.x / local.w + 0.5f, v = 0.5f - local.y / local.w;
+        u0 = std::min(u0, u); u1 = std::max(u1, u);
+        v0 = std::min(v0, v); v1 = std::max(v1, v);
+    }
+    u0 = std::max(u0, 0.0f); v0 = std::max(v0, 0.0f);
+    u1 = std::min(u1, 1.0f); v1 = std::min(v1, 1.0f);
+
+    std::vector<std::pair<float, uint64_t>> missing;
+    if (u0 < u1 && v0 < v1)
+    {
+        // One page of margin for panning; go coarser until the set fits the cache
+        int x0, y0, x1, y1;
+        for (;; level++)
+        {
+            const Level &mip   = m_levels[level];
+            const float  scale = 1.0f / ((float) m_page_size * (1 << level));
+            x0 = std::max((int) std::floor(u0 * m_width  * scale) - 1, 0);
+            y0 = std::max((int) std::floor(v0 * m_height * scale) - 1, 0);
+            x1 = std::min((int) std::floor(u1 * m_width  * scale) + 1, mip.pages_x - 1);
+            y1 = std::min((int) std::floor(v1 * m_height * scale) + 1, mip.pages_y - 1);
+            if (level == coarsest || (size_t) (x1 - x0 + 1) * (y1 - y0 + 1) < m_slot_keys.size()) break;
+        }
+
+        const float centre_x = (x0 + x1) * 0.5f, centre_y = (y0 + y1) * 0.5f;
+        for (int y = y0; y <= y1; y++)
+            for (int x = x0; x <= x1; x++)
+            {
+                uint64_t key = page_key(level, x, y);
+                auto resident = m_resident.find(key);
+                if (resident == m_resident.end())
+                    missing.push_back({ (x - centre_x) * (x - centre_x) + (y - centre_y) * (y - centre_y), key });
+                else if (resident->second.last_used != UINT64_MAX) resident->second.last_used = m_frame;
+            }
+        std::sort(missing.begin(), missing.end());
+    }
+    m_wanted_level = level;
+
+    // Replace last frame's queue so pages that scrolled away are never read,
+    // then take at most m_max_uploads finished pages off the workers
+    std::vector<LoadedPage> ready;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_requests.clear();
+        for (const auto &page : missing)
+            if (std::find(m_in_flight.begin(), m_in_flight.end(), page.second) == m_in_flight.end())
+                m_requests.push_back(page.second);
+
+        size_t count = std::min(m_loaded.size(), (size_t) std::max(m_max_uploads, 0));
+        for (size_t i = 0; i < count; i++)
+        {
+            m_in_flight.erase(std::find(m_in_flight.begin(), m_in_flight.end(), m_loaded[i].key));
+            ready.push_back(std::move(m_loaded[i]));
+        }
+        m_loaded.erase(m_loaded.begin(), m_loaded.begin() + count);
+    }
+    m_wake.notify_all();
+
+    m_uploads = 0;
+    for (const LoadedPage &page : ready)
+    {
+        if (page.pixels.empty() || m_resident.count(page.key)) continue;
+        upload_page(page);
+        m_uploads++;
+    }
+
+    if (m_table_dirty) rebuild_table();
+}
+
+void VirtualTexture::draw(ShaderProgram &program, const glm::mat4 &model_matrix)
+{
+    if (m_levels.empty()) return;
+
+    const GLuint program_id = program.get_program_id();
+    glUseProgram(program_id);
+    glUniform1i(glGetUniformLocation(program_id, "pageCache"), 0);
+    glUniform1i(glGetUniformLocation(program_id, "pageTable"), 1);
+    glUniform2f(glGetUniformLocation(program_id, "virtualSize"), (float) m_width, (float) m_height);
+    glUniform2f(glGetUniformLocation(program_id, "tableSize"), (float) m_levels[0].pages_x, (float) m_levels[0].pages_y);
+    glUniform1f(glGetUniformLocation(program_id, "pageSize"), (float) m_page_size);
+    glUniform1f(glGetUniformLocation(program_id, "pageBorder"), (float) m_border);
+    glUniform1f(glGetUniformLocation(program_id, "cacheSize"), (float) (m_slots_across * m_stride));
+
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, m_table_texture_id);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, m_cache_texture_id);
+
+    program.set_model_matrix(model_matrix);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+}
@@ -0,0 +1,152 @@
+/**
+ * @file VirtualTexture.h
+ * @brief Sparse virtual texturing for maps too large for one GL texture. The
+ * image is cut offline into fixed-size pages (with a mip pyramid) in a page
+ * file; at run time only the pages the camera can see are read by background
+ * threads into an LRU cache texture, and an indirection table tells the
+ * fragment shader where each page lives.
+ * @date 2026-10-18
+ *
+ * @copyright NYU Tandon School of Engineering (c) 2024
+ */
+
+#pragma once
+
+#ifdef _WINDOWS
+    #include <GL/glew.h>
+#endif
+#define GL_GLEXT_PROTOTYPES 1
+#include <SDL_opengl.h>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "glm/mat4x4.hpp"
+#include "ShaderProgram.h"
+#include "Texture.h"
+
+constexpr int VIRTUAL_PAGE_SIZE   = 256, // payload texels per page side
+              VIRTUAL_PAGE_BORDER = 1;   // duplicated texels around each page for bilinear filtering
+
+/**
+ * Cuts the image into a page file, streaming it through ImageStream so the
+ * source never has to fit in memory. Every level of the pyramid is written,
+ * down to the one that fits in a single page. Pixels are stored already
+ * converted to alpha_mode.
+ */
+bool build_virtual_texture_file(const char *image_path, const char *page_file_path,
+                                AlphaMode alpha_mode = PREMULTIPLIED_ALPHA,
+                                int page_size = VIRTUAL_PAGE_SIZE);
+
+class VirtualTexture
+{
+private:
+    struct Level
+    {
+        int width, height, pages_x, pages_y;
+        size_t first_page; // index of this level's first page in m_page_offsets
+    };
+
+    struct Resident
+    {
+        int      slot;
+        uint64_t last_used; // frame stamp for LRU eviction
+    };
+
+    struct LoadedPage
+    {
+        uint64_t                   key;
+        std::vector<unsigned char> pixels;
+    };
+
+    // Page file description
+    int                   m_width = 0, m_height = 0, m_page_size = 0, m_border = 0, m_stride = 0;
+    AlphaMode             m_alpha_mode = PREMULTIPLIED_ALPHA;
+    std::vector<Level>    m_levels;
+    std::vector<uint64_t> m_page_offsets;
+    std::string           m_page_file_path;
+
+    // Physical cache: m_slots_across^2 page slots in one texture
+    GLuint                m_cache_texture_id = 0;
+    int                   m_slots_across     = 0;
+    std::vector<uint64_t> m_slot_keys;  // page held in each slot, or NO_PAGE
+    std::unordered_map<uint64_t, Resident> m_resident;
+
+    // Indirection: one RGBA8 texel per level-0 page (slot x, slot y, level)
+    GLuint                     m_table_texture_id = 0;
+    std::vector<unsigned char> m_table;
+    bool                       m_table_dirty = true;
+
+    // Background loading
+    std::vector<std::thread>  m_workers;
+    std::mutex                m_mutex;
+    std::condition_variable   m_wake;
+    std::deque<uint64_t>      m_requests;  // rebuilt every frame, nearest first
+    std::vector<uint64_t>     m_in_flight; // popped by a worker, not yet uploaded
+    std::vector<LoadedPage>   m_loaded;
+    bool                      m_stopping = false;
+
+    uint64_t m_frame           = 0;
+    int      m_wanted_level    = 0;
+    int      m_uploads         = 0;
+    int      m_max_uploads     = 8;
+
+    static uint64_t page_key(int level, int x, int y)
+    {
+        return ((uint64_t) level << 48) | ((uint64_t) y << 24) | (uint64_t) x;
+    }
+
+    bool read_page(std::ifstream &file, uint64_t key, std::vector<unsigned char> &pixels) const;
+    void worker_loop();
+    int  allocate_slot();
+    void upload_page(const LoadedPage &page);
+    void rebuild_table();
+
+public:
+    VirtualTexture() {}
+    ~VirtualTexture();
+
+    VirtualTexture(const VirtualTexture &) = delete;
+    VirtualTexture &operator=(const VirtualTexture &) = delete;
+
+    /**
+     * Opens a page file written by build_virtual_texture_file(). The cache
+     * holds cache_pages_across^2 pages (clamped to GL_MAX_TEXTURE_SIZE), which
+     * is the whole GPU and CPU budget however large the map is. The coarsest
+     * level is loaded synchronously and pinned so there is always something
+     * to draw.
+     */
+    bool open(const char *page_file_path, int cache_pages_across = 8, unsigned thread_count = 2);
+    void close();
+
+    /**
+     * Works out which pages the camera can see when the unit quad is drawn
+     * with model_matrix, queues the missing ones for the workers and uploads
+     * up to max_uploads_per_frame pages that have finished loading. Call once
+     * per frame on the GL thread, before draw().
+     */
+    void update(const glm::mat4 &projection_matrix, const glm::mat4 &view_matrix, const glm::mat4 &model_matrix,
+                int viewport_width, int viewport_height);
+
+    /**
+     * Binds the cache and indirection textures to units 0 and 1 and draws the
+     * unit quad. program must be built from shaders/fragment_virtual.glsl and
+     * the usual vertex and texture coordinate arrays must be bound.
+     */
+    void draw(ShaderProgram &program, const glm::mat4 &model_matrix);
+
+    void set_max_uploads_per_frame(int uploads) { m_max_uploads = uploads; };
+
+    int    get_width()           const { return m_width;                 };
+    int    get_height()          const { return m_height;                };
+    int    get_level_count()     const { return (int) m_levels.size();   };
+    int    get_wanted_level()    const { return m_wanted_level;          };
+    size_t get_resident_pages()  const { return m_resident.size();       };
+    size_t get_cache_capacity()  const { return m_slot_keys.size();      };
+    int    get_uploads_last_frame() const { return m_uploads;            };
+};
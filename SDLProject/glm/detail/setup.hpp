@@ -273,9 +273,32 @@
 		((GLM_COMPILER & GLM_COMPILER_CUDA) && (GLM_COMPILER >= GLM_COMPILER_CUDA70))))
 #endif
 
+// P0595 std::is_constant_evaluated http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2018/p0595r2.html
+// The builtin behind it is available in every language mode from GCC 9, Clang 9 and VC 16.5
+#if defined(__has_builtin)
+#	if __has_builtin(__builtin_is_constant_evaluated)
+#		define GLM_HAS_IS_CONSTANT_EVALUATED 1
+#	endif
+#endif
+#ifndef GLM_HAS_IS_CONSTANT_EVALUATED
+#	if (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#		define GLM_HAS_IS_CONSTANT_EVALUATED 1
+#	else
+#		define GLM_HAS_IS_CONSTANT_EVALUATED 0
+#	endif
+#endif
+
+#if GLM_HAS_IS_CONSTANT_EVALUATED
+#	define GLM_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#	define GLM_IS_CONSTANT_EVALUATED() false
+#endif
+
 // N2235 Generalized Constant Expressions http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2007/n2235.pdf
 // N3652 Extended Constant Expressions http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2013/n3652.html
-#if (GLM_ARCH & GLM_ARCH_SIMD_BIT) // Compiler SIMD intrinsics don't support constexpr...
+// Compiler SIMD intrinsics don't support constexpr: unless the SIMD paths can
+// step aside during constant evaluation, constexpr is disabled altogether.
+#if (GLM_ARCH & GLM_ARCH_SIMD_BIT) && !GLM_HAS_IS_CONSTANT_EVALUATED
 #	define GLM_HAS_CONSTEXPR 0
 #elif (GLM_COMPILER & GLM_COMPILER_CLANG)
 #	define GLM_HAS_CONSTEXPR __has_feature(cxx_relaxed_constexpr)
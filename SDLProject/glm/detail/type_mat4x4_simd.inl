@@ -1,6 +1,63 @@
 /// @ref core
 
-namespace glm
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
 {
+	// Packed columns go through unaligned loads. Constant evaluation can't
+	// run intrinsics, so it takes the scalar path, which sums the four
+	// products in the same order as glm_mat4_mul_vec4.
+	template<qualifier Q>
+	struct compute_mat4_mul_vec4<float, Q, false>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call_simd(mat<4, 4, float, Q> const& m, vec<4, float, Q> const& v)
+		{
+			glm_vec4 const Columns[4] = {
+				_mm_loadu_ps(&m[0].x),
+				_mm_loadu_ps(&m[1].x),
+				_mm_loadu_ps(&m[2].x),
+				_mm_loadu_ps(&m[3].x)};
+
+			vec<4, float, Q> Result;
+			_mm_storeu_ps(&Result.x, glm_mat4_mul_vec4(Columns, _mm_loadu_ps(&v.x)));
+			return Result;
+		}
 
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<4, float, Q> call(mat<4, 4, float, Q> const& m, vec<4, float, Q> const& v)
+		{
+			if(GLM_IS_CONSTANT_EVALUATED())
+				return (m[0] * v[0] + m[1] * v[1]) + (m[2] * v[2] + m[3] * v[3]);
+			return call_simd(m, v);
+		}
+	};
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	template<qualifier Q>
+	struct compute_mat4_mul_vec4<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(mat<4, 4, float, Q> const& m, vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_mat4_mul_vec4(&m[0].data, v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat4_mul<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m1, mat<4, 4, float, Q> const& m2)
+		{
+			mat<4, 4, float, Q> Result;
+			glm_mat4_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+#	endif
+}//namespace detail
 }//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -135,7 +135,11 @@
 #endif
 
 #ifdef GLM_ENABLE_EXPERIMENTAL
+#include "./gtx/affine_2d.hpp"
 #include "./gtx/associated_min_max.hpp"
+#include "./gtx/batch_intersect.hpp"
+#include "./gtx/batch_math.hpp"
+#include "./gtx/batch_packing.hpp"
 #include "./gtx/bit.hpp"
 #include "./gtx/closest_point.hpp"
 #include "./gtx/color_encoding.hpp"
@@ -148,6 +152,8 @@
 #include "./gtx/extend.hpp"
 #include "./gtx/extended_min_max.hpp"
 #include "./gtx/fast_exponential.hpp"
+#include "./gtx/fast_hash.hpp"
+#include "./gtx/fast_random.hpp"
 #include "./gtx/fast_square_root.hpp"
 #include "./gtx/fast_trigonometry.hpp"
 #include "./gtx/functions.hpp"
@@ -0,0 +1,181 @@
+/// @ref gtx_affine_2d
+/// @file glm/gtx/affine_2d.hpp
+///
+/// @see core (dependence)
+/// @see gtx_matrix_transform_2d (dependence)
+///
+/// @defgroup gtx_affine_2d GLM_GTX_affine_2d
+/// @ingroup gtx
+///
+/// Include <glm/gtx/affine_2d.hpp> to use the features of this extension.
+///
+/// A 2D affine transform stored as the top two rows of a 3 * 3 matrix: the
+/// images of the x and y axes plus a translation, 6 components instead of
+/// the 16 of a mat4. Composition costs 12 multiplications. The builders
+/// follow gtx_matrix_transform_2d: each post-multiplies its input, so
+/// translate(rotate(taffine2d(1), a), v) rotates about the translated origin.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "./matrix_transform_2d.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_affine_2d is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_affine_2d extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_affine_2d
+	/// @{
+
+	template<typename T, qualifier Q = defaultp>
+	struct taffine2d
+	{
+		// -- Implementation detail --
+
+		typedef T value_type;
+		typedef vec<2, T, Q> col_type;
+
+		// -- Data --
+
+		/// Columns of the 2 * 3 matrix: value[0] and value[1] are where the x
+		/// and y axes go, value[2] is the translation.
+		col_type value[3];
+
+		// -- Component accesses --
+
+		typedef length_t length_type;
+		/// Return the count of columns
+		GLM_FUNC_DECL static GLM_CONSTEXPR length_type length(){return 3;}
+
+		GLM_FUNC_DECL col_type & operator[](length_type i);
+		GLM_FUNC_DECL col_type const& operator[](length_type i) const;
+
+		// -- Implicit basic constructors --
+
+		GLM_FUNC_DECL GLM_CONSTEXPR taffine2d() GLM_DEFAULT;
+		GLM_FUNC_DECL GLM_CONSTEXPR taffine2d(taffine2d<T, Q> const& a) GLM_DEFAULT;
+
+		// -- Explicit basic constructors --
+
+		/// Uniform scale by s about the origin; taffine2d(1) is the identity.
+		GLM_FUNC_DECL explicit GLM_CONSTEXPR taffine2d(T s);
+		GLM_FUNC_DECL GLM_CONSTEXPR taffine2d(col_type const& x, col_type const& y, col_type const& translation);
+
+		// -- Conversion constructors --
+
+		template<typename U, qualifier P>
+		GLM_FUNC_DECL GLM_CONSTEXPR GLM_EXPLICIT taffine2d(taffine2d<U, P> const& a);
+
+		GLM_FUNC_DECL GLM_EXPLICIT GLM_CONSTEXPR taffine2d(mat<3, 2, T, Q> const& m);
+		/// Drops the bottom row, which is assumed to be (0, 0, 1).
+		GLM_FUNC_DECL GLM_EXPLICIT GLM_CONSTEXPR taffine2d(mat<3, 3, T, Q> const& m);
+
+		// -- Unary arithmetic operators --
+
+		GLM_FUNC_DECL taffine2d<T, Q> & operator=(taffine2d<T, Q> const& a) GLM_DEFAULT;
+
+		/// Applies a after this transform's own, like *this = *this * a.
+		GLM_FUNC_DECL taffine2d<T, Q> & operator*=(taffine2d<T, Q> const& a);
+	};
+
+	// -- Binary operators --
+
+	/// Composition: (a * b) applies b first, then a, as with matrices.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL taffine2d<T, Q> operator*(taffine2d<T, Q> const& a, taffine2d<T, Q> const& b);
+
+	/// Transforms a point, i.e. with the translation.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<2, T, Q> operator*(taffine2d<T, Q> const& a, vec<2, T, Q> const& p);
+
+	// -- Boolean operators --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool operator==(taffine2d<T, Q> const& a, taffine2d<T, Q> const& b);
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool operator!=(taffine2d<T, Q> const& a, taffine2d<T, Q> const& b);
+
+	// -- Builders, as in gtx_matrix_transform_2d --
+
+	/// @see gtx_affine_2d
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL taffine2d<T, Q> translate(taffine2d<T, Q> const& a, vec<2, T, Q> const& v);
+
+	/// @param angle Rotation angle expressed in radians, counter-clockwise.
+	/// @see gtx_affine_2d
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL taffine2d<T, Q> rotate(taffine2d<T, Q> const& a, T angle);
+
+	/// @see gtx_affine_2d
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL taffine2d<T, Q> scale(taffine2d<T, Q> const& a, vec<2, T, Q> const& v);
+
+	/// @see gtx_affine_2d
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL taffine2d<T, Q> shearX(taffine2d<T, Q> const& a, T y);
+
+	/// @see gtx_affine_2d
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL taffine2d<T, Q> shearY(taffine2d<T, Q> const& a, T x);
+
+	// -- Operations --
+
+	/// Inverse transform. The result is undefined if the 2 * 2 part is singular.
+	/// @see gtx_affine_2d
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL taffine2d<T, Q> inverse(taffine2d<T, Q> const& a);
+
+	/// Determinant of the 2 * 2 part: the signed area scale.
+	/// @see gtx_affine_2d
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL T determinant(taffine2d<T, Q> const& a);
+
+	/// Same as a * p.
+	/// @see gtx_affine_2d
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<2, T, Q> transformPoint(taffine2d<T, Q> const& a, vec<2, T, Q> const& p);
+
+	/// Transforms a direction: the translation is ignored.
+	/// @see gtx_affine_2d
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<2, T, Q> transformVector(taffine2d<T, Q> const& a, vec<2, T, Q> const& v);
+
+	/// Tightest axis-aligned box around the transformed box [boxMin, boxMax],
+	/// from the centre and half extents rather than the four corners.
+	/// @see gtx_affine_2d
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void transformAABB(taffine2d<T, Q> const& a,
+		vec<2, T, Q> const& boxMin, vec<2, T, Q> const& boxMax,
+		vec<2, T, Q>& outMin, vec<2, T, Q>& outMax);
+
+	// -- Conversions --
+
+	/// @see gtx_affine_2d
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 2, T, Q> toMat3x2(taffine2d<T, Q> const& a);
+
+	/// Homogeneous 3 * 3 matrix, for gtx_matrix_transform_2d.
+	/// @see gtx_affine_2d
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 3, T, Q> toMat3(taffine2d<T, Q> const& a);
+
+	/// Embeds the transform in the z = 0 plane for upload as a model matrix.
+	/// @see gtx_affine_2d
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<4, 4, T, Q> toMat4(taffine2d<T, Q> const& a);
+
+	typedef taffine2d<float, defaultp>	affine2d;
+	typedef taffine2d<double, defaultp>	daffine2d;
+
+	/// @}
+}//namespace glm
+
+#include "affine_2d.inl"
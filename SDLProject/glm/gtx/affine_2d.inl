@@ -0,0 +1,231 @@
+/// @ref gtx_affine_2d
+
+#include "../trigonometric.hpp"
+
+namespace glm
+{
+	// -- Component accesses --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER typename taffine2d<T, Q>::col_type & taffine2d<T, Q>::operator[](typename taffine2d<T, Q>::length_type i)
+	{
+		assert(i >= 0 && i < this->length());
+		return this->value[i];
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER typename taffine2d<T, Q>::col_type const& taffine2d<T, Q>::operator[](typename taffine2d<T, Q>::length_type i) const
+	{
+		assert(i >= 0 && i < this->length());
+		return this->value[i];
+	}
+
+	// -- Implicit basic constructors --
+
+#	if GLM_CONFIG_DEFAULTED_FUNCTIONS == GLM_DISABLE
+		template<typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR taffine2d<T, Q>::taffine2d()
+#			if GLM_CONFIG_CTOR_INIT == GLM_CTOR_INITIALIZER_LIST
+			: value{col_type(1, 0), col_type(0, 1), col_type(0, 0)}
+#			endif
+		{
+#			if GLM_CONFIG_CTOR_INIT == GLM_CTOR_INITIALISATION
+				this->value[0] = col_type(1, 0);
+				this->value[1] = col_type(0, 1);
+				this->value[2] = col_type(0, 0);
+#			endif
+		}
+
+		template<typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR taffine2d<T, Q>::taffine2d(taffine2d<T, Q> const& a)
+			: value{a.value[0], a.value[1], a.value[2]}
+		{}
+#	endif
+
+	// -- Explicit basic constructors --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR taffine2d<T, Q>::taffine2d(T s)
+		: value{col_type(s, 0), col_type(0, s), col_type(0, 0)}
+	{}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR taffine2d<T, Q>::taffine2d(col_type const& x, col_type const& y, col_type const& translation)
+		: value{x, y, translation}
+	{}
+
+	// -- Conversion constructors --
+
+	template<typename T, qualifier Q>
+	template<typename U, qualifier P>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR taffine2d<T, Q>::taffine2d(taffine2d<U, P> const& a)
+		: value{col_type(a.value[0]), col_type(a.value[1]), col_type(a.value[2])}
+	{}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR taffine2d<T, Q>::taffine2d(mat<3, 2, T, Q> const& m)
+		: value{m[0], m[1], m[2]}
+	{}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR taffine2d<T, Q>::taffine2d(mat<3, 3, T, Q> const& m)
+		: value{col_type(m[0]), col_type(m[1]), col_type(m[2])}
+	{}
+
+	// -- Unary arithmetic operators --
+
+#	if GLM_CONFIG_DEFAULTED_FUNCTIONS == GLM_DISABLE
+		template<typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER taffine2d<T, Q> & taffine2d<T, Q>::operator=(taffine2d<T, Q> const& a)
+		{
+			this->value[0] = a[0];
+			this->value[1] = a[1];
+			this->value[2] = a[2];
+			return *this;
+		}
+#	endif
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER taffine2d<T, Q> & taffine2d<T, Q>::operator*=(taffine2d<T, Q> const& a)
+	{
+		return (*this = *this * a);
+	}
+
+	// -- Binary operators --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER taffine2d<T, Q> operator*(taffine2d<T, Q> const& a, taffine2d<T, Q> const& b)
+	{
+		// The implicit bottom row (0, 0, 1) of both sides is never multiplied:
+		// 8 products for the 2 * 2 part and 4 for the translation.
+		return taffine2d<T, Q>(
+			a[0] * b[0][0] + a[1] * b[0][1],
+			a[0] * b[1][0] + a[1] * b[1][1],
+			a[0] * b[2][0] + a[1] * b[2][1] + a[2]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<2, T, Q> operator*(taffine2d<T, Q> const& a, vec<2, T, Q> const& p)
+	{
+		return a[0] * p.x + a[1] * p.y + a[2];
+	}
+
+	// -- Boolean operators --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool operator==(taffine2d<T, Q> const& a, taffine2d<T, Q> const& b)
+	{
+		return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool operator!=(taffine2d<T, Q> const& a, taffine2d<T, Q> const& b)
+	{
+		return !(a == b);
+	}
+
+	// -- Builders --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER taffine2d<T, Q> translate(taffine2d<T, Q> const& a, vec<2, T, Q> const& v)
+	{
+		return taffine2d<T, Q>(a[0], a[1], a[0] * v[0] + a[1] * v[1] + a[2]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER taffine2d<T, Q> rotate(taffine2d<T, Q> const& a, T angle)
+	{
+		T const c = cos(angle);
+		T const s = sin(angle);
+		return taffine2d<T, Q>(a[0] * c + a[1] * s, a[0] * -s + a[1] * c, a[2]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER taffine2d<T, Q> scale(taffine2d<T, Q> const& a, vec<2, T, Q> const& v)
+	{
+		return taffine2d<T, Q>(a[0] * v[0], a[1] * v[1], a[2]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER taffine2d<T, Q> shearX(taffine2d<T, Q> const& a, T y)
+	{
+		return taffine2d<T, Q>(a[0] + a[1] * y, a[1], a[2]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER taffine2d<T, Q> shearY(taffine2d<T, Q> const& a, T x)
+	{
+		return taffine2d<T, Q>(a[0], a[0] * x + a[1], a[2]);
+	}
+
+	// -- Operations --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T determinant(taffine2d<T, Q> const& a)
+	{
+		return a[0][0] * a[1][1] - a[1][0] * a[0][1];
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER taffine2d<T, Q> inverse(taffine2d<T, Q> const& a)
+	{
+		T const OneOverDeterminant = static_cast<T>(1) / determinant(a);
+
+		vec<2, T, Q> const X( a[1][1] * OneOverDeterminant, -a[0][1] * OneOverDeterminant);
+		vec<2, T, Q> const Y(-a[1][0] * OneOverDeterminant,  a[0][0] * OneOverDeterminant);
+		return taffine2d<T, Q>(X, Y, -(X * a[2][0] + Y * a[2][1]));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<2, T, Q> transformPoint(taffine2d<T, Q> const& a, vec<2, T, Q> const& p)
+	{
+		return a * p;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<2, T, Q> transformVector(taffine2d<T, Q> const& a, vec<2, T, Q> const& v)
+	{
+		return a[0] * v.x + a[1] * v.y;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformAABB(taffine2d<T, Q> const& a,
+		vec<2, T, Q> const& boxMin, vec<2, T, Q> const& boxMax,
+		vec<2, T, Q>& outMin, vec<2, T, Q>& outMax)
+	{
+		vec<2, T, Q> const Center = (boxMin + boxMax) * static_cast<T>(0.5);
+		vec<2, T, Q> const HalfExtent = (boxMax - boxMin) * static_cast<T>(0.5);
+
+		vec<2, T, Q> const NewCenter = a * Center;
+		vec<2, T, Q> const NewHalfExtent = abs(a[0]) * HalfExtent.x + abs(a[1]) * HalfExtent.y;
+		outMin = NewCenter - NewHalfExtent;
+		outMax = NewCenter + NewHalfExtent;
+	}
+
+	// -- Conversions --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 2, T, Q> toMat3x2(taffine2d<T, Q> const& a)
+	{
+		return mat<3, 2, T, Q>(a[0], a[1], a[2]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 3, T, Q> toMat3(taffine2d<T, Q> const& a)
+	{
+		return mat<3, 3, T, Q>(
+			vec<3, T, Q>(a[0], 0),
+			vec<3, T, Q>(a[1], 0),
+			vec<3, T, Q>(a[2], 1));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> toMat4(taffine2d<T, Q> const& a)
+	{
+		return mat<4, 4, T, Q>(
+			vec<4, T, Q>(a[0], 0, 0),
+			vec<4, T, Q>(a[1], 0, 0),
+			vec<4, T, Q>(0, 0, 1, 0),
+			vec<4, T, Q>(a[2], 0, 1));
+	}
+}//namespace glm
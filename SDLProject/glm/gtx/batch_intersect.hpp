@@ -0,0 +1,127 @@
+/// @ref gtx_batch_intersect
+/// @file glm/gtx/batch_intersect.hpp
+///
+/// @see core (dependence)
+/// @see gtx_intersect (extended)
+///
+/// @defgroup gtx_batch_intersect GLM_GTX_batch_intersect
+/// @ingroup gtx
+///
+/// Include <glm/gtx/batch_intersect.hpp> to use the features of this extension.
+///
+/// Ray tests against many shapes at once, for picking and collision against
+/// thousands of sprites: one ray against arrays of shapes, or arrays of rays
+/// against one shape. Shapes and rays are passed as one float array per
+/// component (x[i], y[i], ...), and with GLM_FORCE_INTRINSICS (or one of the
+/// GLM_FORCE_SSE2 / GLM_FORCE_AVX family) 4 or 8 of them are tested per
+/// instruction; otherwise, and for the tail, the same arithmetic runs one
+/// shape at a time, so the results do not depend on the array length.
+///
+/// Every test covers the ray segment Orig + t * Dir for t in [0, MaxDistance]
+/// (pass infinity for an unbounded ray); distances are in units of Dir, so
+/// lengths when Dir is normalized. A ray starting inside a solid shape hits
+/// it at t = 0; with a zero Dir, the rectangle tests become point-in-box
+/// tests at t = 0. Rays exactly grazing an edge may report either result.
+///
+/// Each function writes bit i % 32 of hits[i / 32] for shape or ray i,
+/// clearing the unused high bits of the last word, so hits needs
+/// (count + 31) / 32 words. If distance is not null, distance[i] receives
+/// the entry distance, or infinity on a miss. The return value is the
+/// number of hits.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../ext/scalar_uint_sized.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_batch_intersect is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_batch_intersect extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_batch_intersect
+	/// @{
+
+	/// One ray against axis-aligned rectangles [min, max].
+	/// From GLM_GTX_batch_intersect extension.
+	GLM_FUNC_DECL std::size_t batchIntersectRayAABB(
+		vec2 const& Orig, vec2 const& Dir, float MaxDistance,
+		float const* min_x, float const* min_y, float const* max_x, float const* max_y,
+		std::size_t count, uint32* hits, float* distance);
+
+	/// One ray against circles.
+	/// From GLM_GTX_batch_intersect extension.
+	GLM_FUNC_DECL std::size_t batchIntersectRayCircle(
+		vec2 const& Orig, vec2 const& Dir, float MaxDistance,
+		float const* center_x, float const* center_y, float const* radius,
+		std::size_t count, uint32* hits, float* distance);
+
+	/// One ray against oriented rectangles: the box's local x axis is the unit
+	/// vector (axis_x, axis_y), its local y axis (-axis_y, axis_x), and it
+	/// extends half_x and half_y either side of the center along them.
+	/// From GLM_GTX_batch_intersect extension.
+	GLM_FUNC_DECL std::size_t batchIntersectRayOBB(
+		vec2 const& Orig, vec2 const& Dir, float MaxDistance,
+		float const* center_x, float const* center_y, float const* axis_x, float const* axis_y,
+		float const* half_x, float const* half_y,
+		std::size_t count, uint32* hits, float* distance);
+
+	/// One ray against segments from a to b. Parallel segments never hit.
+	/// From GLM_GTX_batch_intersect extension.
+	GLM_FUNC_DECL std::size_t batchIntersectRaySegment(
+		vec2 const& Orig, vec2 const& Dir, float MaxDistance,
+		float const* a_x, float const* a_y, float const* b_x, float const* b_y,
+		std::size_t count, uint32* hits, float* distance);
+
+	/// Rays against one axis-aligned rectangle [Min, Max].
+	/// From GLM_GTX_batch_intersect extension.
+	GLM_FUNC_DECL std::size_t batchIntersectRaysAABB(
+		float const* orig_x, float const* orig_y, float const* dir_x, float const* dir_y, float MaxDistance,
+		vec2 const& Min, vec2 const& Max,
+		std::size_t count, uint32* hits, float* distance);
+
+	/// Rays against one circle.
+	/// From GLM_GTX_batch_intersect extension.
+	GLM_FUNC_DECL std::size_t batchIntersectRaysCircle(
+		float const* orig_x, float const* orig_y, float const* dir_x, float const* dir_y, float MaxDistance,
+		vec2 const& Center, float Radius,
+		std::size_t count, uint32* hits, float* distance);
+
+	/// One ray against spheres.
+	/// From GLM_GTX_batch_intersect extension.
+	GLM_FUNC_DECL std::size_t batchIntersectRaySphere(
+		vec3 const& Orig, vec3 const& Dir, float MaxDistance,
+		float const* center_x, float const* center_y, float const* center_z, float const* radius,
+		std::size_t count, uint32* hits, float* distance);
+
+	/// One ray against triangles, either winding; triangles whose plane
+	/// contains the ray direction (|det| <= epsilon, as in
+	/// intersectRayTriangle) never hit.
+	/// From GLM_GTX_batch_intersect extension.
+	GLM_FUNC_DECL std::size_t batchIntersectRayTriangle(
+		vec3 const& Orig, vec3 const& Dir, float MaxDistance,
+		float const* v0_x, float const* v0_y, float const* v0_z,
+		float const* v1_x, float const* v1_y, float const* v1_z,
+		float const* v2_x, float const* v2_y, float const* v2_z,
+		std::size_t count, uint32* hits, float* distance);
+
+	/// One ray against planes through a point with a normal. As with
+	/// intersectRayPlane, only planes facing the ray (dot(Dir, normal) < -epsilon) hit.
+	/// From GLM_GTX_batch_intersect extension.
+	GLM_FUNC_DECL std::size_t batchIntersectRayPlane(
+		vec3 const& Orig, vec3 const& Dir, float MaxDistance,
+		float const* point_x, float const* point_y, float const* point_z,
+		float const* normal_x, float const* normal_y, float const* normal_z,
+		std::size_t count, uint32* hits, float* distance);
+
+	/// @}
+}//namespace glm
+
+#include "batch_intersect.inl"
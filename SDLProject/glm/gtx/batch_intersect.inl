@@ -0,0 +1,478 @@
+/// @ref gtx_batch_intersect
+
+#include <cstring>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// The kernels below are written once against these lane types. min and
+	// max follow minps/maxps: when one operand is NaN they return the second,
+	// which the slab tests rely on to ignore the 0 * inf of an axis-parallel ray.
+	struct intersect_lanes1
+	{
+		typedef float vec;
+		typedef bool mask;
+
+		GLM_FUNC_QUALIFIER static vec set(float x) {return x;}
+		GLM_FUNC_QUALIFIER static vec load(float const* p) {return *p;}
+		GLM_FUNC_QUALIFIER static void store(float* p, vec a) {*p = a;}
+		GLM_FUNC_QUALIFIER static vec add(vec a, vec b) {return a + b;}
+		GLM_FUNC_QUALIFIER static vec sub(vec a, vec b) {return a - b;}
+		GLM_FUNC_QUALIFIER static vec mul(vec a, vec b) {return a * b;}
+		GLM_FUNC_QUALIFIER static vec div(vec a, vec b) {return a / b;}
+		GLM_FUNC_QUALIFIER static vec min(vec a, vec b) {return a < b ? a : b;}
+		GLM_FUNC_QUALIFIER static vec max(vec a, vec b) {return a > b ? a : b;}
+		GLM_FUNC_QUALIFIER static vec sqrt(vec a) {return std::sqrt(a);}
+		GLM_FUNC_QUALIFIER static vec abs(vec a) {return std::abs(a);}
+		GLM_FUNC_QUALIFIER static mask le(vec a, vec b) {return a <= b;}
+		GLM_FUNC_QUALIFIER static mask ge(vec a, vec b) {return a >= b;}
+		GLM_FUNC_QUALIFIER static mask lt(vec a, vec b) {return a < b;}
+		GLM_FUNC_QUALIFIER static mask gt(vec a, vec b) {return a > b;}
+		GLM_FUNC_QUALIFIER static mask both(mask a, mask b) {return a && b;}
+		GLM_FUNC_QUALIFIER static vec select(mask m, vec a, vec b) {return m ? a : b;}
+		GLM_FUNC_QUALIFIER static unsigned int bits(mask m) {return m ? 1u : 0u;}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		struct intersect_lanes4
+		{
+			typedef glm_f32vec4 vec;
+			typedef glm_f32vec4 mask;
+
+			GLM_FUNC_QUALIFIER static vec set(float x) {return _mm_set1_ps(x);}
+			GLM_FUNC_QUALIFIER static vec load(float const* p) {return _mm_loadu_ps(p);}
+			GLM_FUNC_QUALIFIER static void store(float* p, vec a) {_mm_storeu_ps(p, a);}
+			GLM_FUNC_QUALIFIER static vec add(vec a, vec b) {return _mm_add_ps(a, b);}
+			GLM_FUNC_QUALIFIER static vec sub(vec a, vec b) {return _mm_sub_ps(a, b);}
+			GLM_FUNC_QUALIFIER static vec mul(vec a, vec b) {return _mm_mul_ps(a, b);}
+			GLM_FUNC_QUALIFIER static vec div(vec a, vec b) {return _mm_div_ps(a, b);}
+			GLM_FUNC_QUALIFIER static vec min(vec a, vec b) {return _mm_min_ps(a, b);}
+			GLM_FUNC_QUALIFIER static vec max(vec a, vec b) {return _mm_max_ps(a, b);}
+			GLM_FUNC_QUALIFIER static vec sqrt(vec a) {return _mm_sqrt_ps(a);}
+			GLM_FUNC_QUALIFIER static vec abs(vec a) {return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);}
+			GLM_FUNC_QUALIFIER static mask le(vec a, vec b) {return _mm_cmple_ps(a, b);}
+			GLM_FUNC_QUALIFIER static mask ge(vec a, vec b) {return _mm_cmpge_ps(a, b);}
+			GLM_FUNC_QUALIFIER static mask lt(vec a, vec b) {return _mm_cmplt_ps(a, b);}
+			GLM_FUNC_QUALIFIER static mask gt(vec a, vec b) {return _mm_cmpgt_ps(a, b);}
+			GLM_FUNC_QUALIFIER static mask both(mask a, mask b) {return _mm_and_ps(a, b);}
+			GLM_FUNC_QUALIFIER static vec select(mask m, vec a, vec b) {return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));}
+			GLM_FUNC_QUALIFIER static unsigned int bits(mask m) {return static_cast<unsigned int>(_mm_movemask_ps(m));}
+		};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+		struct intersect_lanes8
+		{
+			typedef glm_f32vec8 vec;
+			typedef glm_f32vec8 mask;
+
+			GLM_FUNC_QUALIFIER static vec set(float x) {return _mm256_set1_ps(x);}
+			GLM_FUNC_QUALIFIER static vec load(float const* p) {return _mm256_loadu_ps(p);}
+			GLM_FUNC_QUALIFIER static void store(float* p, vec a) {_mm256_storeu_ps(p, a);}
+			GLM_FUNC_QUALIFIER static vec add(vec a, vec b) {return _mm256_add_ps(a, b);}
+			GLM_FUNC_QUALIFIER static vec sub(vec a, vec b) {return _mm256_sub_ps(a, b);}
+			GLM_FUNC_QUALIFIER static vec mul(vec a, vec b) {return _mm256_mul_ps(a, b);}
+			GLM_FUNC_QUALIFIER static vec div(vec a, vec b) {return _mm256_div_ps(a, b);}
+			GLM_FUNC_QUALIFIER static vec min(vec a, vec b) {return _mm256_min_ps(a, b);}
+			GLM_FUNC_QUALIFIER static vec max(vec a, vec b) {return _mm256_max_ps(a, b);}
+			GLM_FUNC_QUALIFIER static vec sqrt(vec a) {return _mm256_sqrt_ps(a);}
+			GLM_FUNC_QUALIFIER static vec abs(vec a) {return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);}
+			GLM_FUNC_QUALIFIER static mask le(vec a, vec b) {return _mm256_cmp_ps(a, b, _CMP_LE_OQ);}
+			GLM_FUNC_QUALIFIER static mask ge(vec a, vec b) {return _mm256_cmp_ps(a, b, _CMP_GE_OQ);}
+			GLM_FUNC_QUALIFIER static mask lt(vec a, vec b) {return _mm256_cmp_ps(a, b, _CMP_LT_OQ);}
+			GLM_FUNC_QUALIFIER static mask gt(vec a, vec b) {return _mm256_cmp_ps(a, b, _CMP_GT_OQ);}
+			GLM_FUNC_QUALIFIER static mask both(mask a, mask b) {return _mm256_and_ps(a, b);}
+			GLM_FUNC_QUALIFIER static vec select(mask m, vec a, vec b) {return _mm256_blendv_ps(b, a, m);}
+			GLM_FUNC_QUALIFIER static unsigned int bits(mask m) {return static_cast<unsigned int>(_mm256_movemask_ps(m));}
+		};
+#	endif
+
+	// Narrows [near, far] to the part of the ray inside one slab
+	template<typename L>
+	GLM_FUNC_QUALIFIER void intersect_slab(typename L::vec t1, typename L::vec t2, typename L::vec& near, typename L::vec& far)
+	{
+		near = L::max(L::min(t1, t2), near);
+		far = L::min(L::max(t1, t2), far);
+	}
+
+	// Whether the slabs leave any of [0, MaxDistance]. An axis Dir is zero
+	// along puts both slab distances at +inf when Orig is outside that slab,
+	// so near must also be finite for an unbounded ray not to hit at infinity
+	template<typename L>
+	GLM_FUNC_QUALIFIER typename L::mask slab_hit(typename L::vec near, typename L::vec far)
+	{
+		return L::both(L::le(near, far), L::lt(near, L::set(std::numeric_limits<float>::infinity())));
+	}
+
+	// Runs a kernel over count shapes or rays, widest lanes first
+	template<typename kernel>
+	GLM_FUNC_QUALIFIER std::size_t batch_intersect(kernel const& k, std::size_t count, uint32* hits, float* distance)
+	{
+		std::memset(hits, 0, (count + 31) / 32 * sizeof(uint32));
+
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			for(; i + 8 <= count; i += 8)
+			{
+				intersect_lanes8::vec t;
+				hits[i / 32] |= intersect_lanes8::bits(k(intersect_lanes8(), i, t)) << (i % 32);
+				if(distance)
+					intersect_lanes8::store(distance + i, t);
+			}
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 4 <= count; i += 4)
+			{
+				intersect_lanes4::vec t;
+				hits[i / 32] |= intersect_lanes4::bits(k(intersect_lanes4(), i, t)) << (i % 32);
+				if(distance)
+					intersect_lanes4::store(distance + i, t);
+			}
+#		endif
+		for(; i < count; ++i)
+		{
+			float t;
+			hits[i / 32] |= intersect_lanes1::bits(k(intersect_lanes1(), i, t)) << (i % 32);
+			if(distance)
+				distance[i] = t;
+		}
+
+		std::size_t total = 0;
+		for(std::size_t w = 0; w < (count + 31) / 32; ++w)
+			total += static_cast<std::size_t>(bitCount(hits[w]));
+		return total;
+	}
+
+	struct intersect_ray_aabb
+	{
+		vec2 Orig, Inv;
+		float MaxDistance;
+		float const *MinX, *MinY, *MaxX, *MaxY;
+
+		template<typename L>
+		GLM_FUNC_QUALIFIER typename L::mask operator()(L, std::size_t i, typename L::vec& t) const
+		{
+			typename L::vec const ox = L::set(Orig.x), oy = L::set(Orig.y);
+			typename L::vec const ix = L::set(Inv.x), iy = L::set(Inv.y);
+			typename L::vec near = L::set(0.0f), far = L::set(MaxDistance);
+			intersect_slab<L>(L::mul(L::sub(L::load(MinX + i), ox), ix), L::mul(L::sub(L::load(MaxX + i), ox), ix), near, far);
+			intersect_slab<L>(L::mul(L::sub(L::load(MinY + i), oy), iy), L::mul(L::sub(L::load(MaxY + i), oy), iy), near, far);
+
+			typename L::mask const hit = slab_hit<L>(near, far);
+			t = L::select(hit, near, L::set(std::numeric_limits<float>::infinity()));
+			return hit;
+		}
+	};
+
+	// Solves |oc + t d|^2 = r^2 with oc = Orig - center: b = oc.d, c = oc.oc - r^2,
+	// entry and exit at (-b -/+ sqrt(b^2 - a c)) / a for a = d.d
+	template<typename L>
+	GLM_FUNC_QUALIFIER typename L::mask intersect_quadratic(typename L::vec b, typename L::vec c, typename L::vec a, typename L::vec neg_inv_a, float MaxDistance, typename L::vec& t)
+	{
+		typename L::vec const zero = L::set(0.0f);
+		typename L::vec const disc = L::sub(L::mul(b, b), L::mul(a, c));
+		typename L::vec const root = L::sqrt(L::max(disc, zero));
+		typename L::vec const entry = L::max(L::mul(L::add(b, root), neg_inv_a), zero);
+		typename L::vec const exit = L::mul(L::sub(b, root), neg_inv_a);
+
+		typename L::mask const hit = L::both(L::both(L::ge(disc, zero), L::ge(exit, zero)), L::le(entry, L::set(MaxDistance)));
+		t = L::select(hit, entry, L::set(std::numeric_limits<float>::infinity()));
+		return hit;
+	}
+
+	struct intersect_ray_circle
+	{
+		vec2 Orig, Dir;
+		float A, NegInvA, MaxDistance;
+		float const *CenterX, *CenterY, *Radius;
+
+		template<typename L>
+		GLM_FUNC_QUALIFIER typename L::mask operator()(L, std::size_t i, typename L::vec& t) const
+		{
+			typename L::vec const ocx = L::sub(L::set(Orig.x), L::load(CenterX + i));
+			typename L::vec const ocy = L::sub(L::set(Orig.y), L::load(CenterY + i));
+			typename L::vec const r = L::load(Radius + i);
+			typename L::vec const b = L::add(L::mul(ocx, L::set(Dir.x)), L::mul(ocy, L::set(Dir.y)));
+			typename L::vec const c = L::sub(L::add(L::mul(ocx, ocx), L::mul(ocy, ocy)), L::mul(r, r));
+			return intersect_quadratic<L>(b, c, L::set(A), L::set(NegInvA), MaxDistance, t);
+		}
+	};
+
+	struct intersect_ray_obb
+	{
+		vec2 Orig, Dir;
+		float MaxDistance;
+		float const *CenterX, *CenterY, *AxisX, *AxisY, *HalfX, *HalfY;
+
+		template<typename L>
+		GLM_FUNC_QUALIFIER typename L::mask operator()(L, std::size_t i, typename L::vec& t) const
+		{
+			typename L::vec const ax = L::load(AxisX + i), ay = L::load(AxisY + i);
+			typename L::vec const dx = L::set(Dir.x), dy = L::set(Dir.y);
+			typename L::vec const px = L::sub(L::set(Orig.x), L::load(CenterX + i));
+			typename L::vec const py = L::sub(L::set(Orig.y), L::load(CenterY + i));
+
+			// The ray in the box's frame
+			typename L::vec const lx = L::add(L::mul(px, ax), L::mul(py, ay));
+			typename L::vec const ly = L::sub(L::mul(py, ax), L::mul(px, ay));
+			typename L::vec const ix = L::div(L::set(1.0f), L::add(L::mul(dx, ax), L::mul(dy, ay)));
+			typename L::vec const iy = L::div(L::set(1.0f), L::sub(L::mul(dy, ax), L::mul(dx, ay)));
+
+			typename L::vec const hx = L::load(HalfX + i), hy = L::load(HalfY + i);
+			typename L::vec const zero = L::set(0.0f);
+			typename L::vec near = zero, far = L::set(MaxDistance);
+			intersect_slab<L>(L::mul(L::sub(L::sub(zero, hx), lx), ix), L::mul(L::sub(hx, lx), ix), near, far);
+			intersect_slab<L>(L::mul(L::sub(L::sub(zero, hy), ly), iy), L::mul(L::sub(hy, ly), iy), near, far);
+
+			typename L::mask const hit = slab_hit<L>(near, far);
+			t = L::select(hit, near, L::set(std::numeric_limits<float>::infinity()));
+			return hit;
+		}
+	};
+
+	// With e = b - a and w = a - Orig: t = cross(w, e) / cross(Dir, e) along
+	// the ray, u = cross(w, Dir) / cross(Dir, e) along the segment. A parallel
+	// segment divides by zero and fails the range tests.
+	struct intersect_ray_segment
+	{
+		vec2 Orig, Dir;
+		float MaxDistance;
+		float const *AX, *AY, *BX, *BY;
+
+		template<typename L>
+		GLM_FUNC_QUALIFIER typename L::mask operator()(L, std::size_t i, typename L::vec& t) const
+		{
+			typename L::vec const a_x = L::load(AX + i), a_y = L::load(AY + i);
+			typename L::vec const ex = L::sub(L::load(BX + i), a_x), ey = L::sub(L::load(BY + i), a_y);
+			typename L::vec const wx = L::sub(a_x, L::set(Orig.x)), wy = L::sub(a_y, L::set(Orig.y));
+			typename L::vec const dx = L::set(Dir.x), dy = L::set(Dir.y);
+
+			typename L::vec const inv = L::div(L::set(1.0f), L::sub(L::mul(dx, ey), L::mul(dy, ex)));
+			typename L::vec const s = L::mul(L::sub(L::mul(wx, ey), L::mul(wy, ex)), inv);
+			typename L::vec const u = L::mul(L::sub(L::mul(wx, dy), L::mul(wy, dx)), inv);
+
+			typename L::vec const zero = L::set(0.0f);
+			typename L::mask const hit = L::both(
+				L::both(L::ge(s, zero), L::le(s, L::set(MaxDistance))),
+				L::both(L::ge(u, zero), L::le(u, L::set(1.0f))));
+			t = L::select(hit, s, L::set(std::numeric_limits<float>::infinity()));
+			return hit;
+		}
+	};
+
+	struct intersect_rays_aabb
+	{
+		vec2 Min, Max;
+		float MaxDistance;
+		float const *OrigX, *OrigY, *DirX, *DirY;
+
+		template<typename L>
+		GLM_FUNC_QUALIFIER typename L::mask operator()(L, std::size_t i, typename L::vec& t) const
+		{
+			typename L::vec const ox = L::load(OrigX + i), oy = L::load(OrigY + i);
+			typename L::vec const ix = L::div(L::set(1.0f), L::load(DirX + i));
+			typename L::vec const iy = L::div(L::set(1.0f), L::load(DirY + i));
+			typename L::vec near = L::set(0.0f), far = L::set(MaxDistance);
+			intersect_slab<L>(L::mul(L::sub(L::set(Min.x), ox), ix), L::mul(L::sub(L::set(Max.x), ox), ix), near, far);
+			intersect_slab<L>(L::mul(L::sub(L::set(Min.y), oy), iy), L::mul(L::sub(L::set(Max.y), oy), iy), near, far);
+
+			typename L::mask const hit = slab_hit<L>(near, far);
+			t = L::select(hit, near, L::set(std::numeric_limits<float>::infinity()));
+			return hit;
+		}
+	};
+
+	struct intersect_rays_circle
+	{
+		vec2 Center;
+		float Radius, MaxDistance;
+		float const *OrigX, *OrigY, *DirX, *DirY;
+
+		template<typename L>
+		GLM_FUNC_QUALIFIER typename L::mask operator()(L, std::size_t i, typename L::vec& t) const
+		{
+			typename L::vec const dx = L::load(DirX + i), dy = L::load(DirY + i);
+			typename L::vec const ocx = L::sub(L::load(OrigX + i), L::set(Center.x));
+			typename L::vec const ocy = L::sub(L::load(OrigY + i), L::set(Center.y));
+			typename L::vec const a = L::add(L::mul(dx, dx), L::mul(dy, dy));
+			typename L::vec const b = L::add(L::mul(ocx, dx), L::mul(ocy, dy));
+			typename L::vec const c = L::sub(L::add(L::mul(ocx, ocx), L::mul(ocy, ocy)), L::set(Radius * Radius));
+			return intersect_quadratic<L>(b, c, a, L::div(L::set(-1.0f), a), MaxDistance, t);
+		}
+	};
+
+	struct intersect_ray_sphere
+	{
+		vec3 Orig, Dir;
+		float A, NegInvA, MaxDistance;
+		float const *CenterX, *CenterY, *CenterZ, *Radius;
+
+		template<typename L>
+		GLM_FUNC_QUALIFIER typename L::mask operator()(L, std::size_t i, typename L::vec& t) const
+		{
+			typename L::vec const ocx = L::sub(L::set(Orig.x), L::load(CenterX + i));
+			typename L::vec const ocy = L::sub(L::set(Orig.y), L::load(CenterY + i));
+			typename L::vec const ocz = L::sub(L::set(Orig.z), L::load(CenterZ + i));
+			typename L::vec const r = L::load(Radius + i);
+			typename L::vec const b = L::add(L::add(L::mul(ocx, L::set(Dir.x)), L::mul(ocy, L::set(Dir.y))), L::mul(ocz, L::set(Dir.z)));
+			typename L::vec const c = L::sub(L::add(L::add(L::mul(ocx, ocx), L::mul(ocy, ocy)), L::mul(ocz, ocz)), L::mul(r, r));
+			return intersect_quadratic<L>(b, c, L::set(A), L::set(NegInvA), MaxDistance, t);
+		}
+	};
+
+	// Moller-Trumbore, as intersectRayTriangle
+	struct intersect_ray_triangle
+	{
+		vec3 Orig, Dir;
+		float MaxDistance;
+		float const *V0X, *V0Y, *V0Z, *V1X, *V1Y, *V1Z, *V2X, *V2Y, *V2Z;
+
+		template<typename L>
+		GLM_FUNC_QUALIFIER typename L::mask operator()(L, std::size_t i, typename L::vec& t) const
+		{
+			typedef typename L::vec v;
+			v const dx = L::set(Dir.x), dy = L::set(Dir.y), dz = L::set(Dir.z);
+			v const v0x = L::load(V0X + i), v0y = L::load(V0Y + i), v0z = L::load(V0Z + i);
+			v const e1x = L::sub(L::load(V1X + i), v0x), e1y = L::sub(L::load(V1Y + i), v0y), e1z = L::sub(L::load(V1Z + i), v0z);
+			v const e2x = L::sub(L::load(V2X + i), v0x), e2y = L::sub(L::load(V2Y + i), v0y), e2z = L::sub(L::load(V2Z + i), v0z);
+
+			// p = cross(Dir, edge2), det = dot(edge1, p)
+			v const px = L::sub(L::mul(dy, e2z), L::mul(dz, e2y));
+			v const py = L::sub(L::mul(dz, e2x), L::mul(dx, e2z));
+			v const pz = L::sub(L::mul(dx, e2y), L::mul(dy, e2x));
+			v const det = L::add(L::add(L::mul(e1x, px), L::mul(e1y, py)), L::mul(e1z, pz));
+			v const inv = L::div(L::set(1.0f), det);
+
+			v const sx = L::sub(L::set(Orig.x), v0x), sy = L::sub(L::set(Orig.y), v0y), sz = L::sub(L::set(Orig.z), v0z);
+			v const u = L::mul(L::add(L::add(L::mul(sx, px), L::mul(sy, py)), L::mul(sz, pz)), inv);
+
+			// q = cross(s, edge1)
+			v const qx = L::sub(L::mul(sy, e1z), L::mul(sz, e1y));
+			v const qy = L::sub(L::mul(sz, e1x), L::mul(sx, e1z));
+			v const qz = L::sub(L::mul(sx, e1y), L::mul(sy, e1x));
+			v const w = L::mul(L::add(L::add(L::mul(dx, qx), L::mul(dy, qy)), L::mul(dz, qz)), inv);
+			v const s = L::mul(L::add(L::add(L::mul(e2x, qx), L::mul(e2y, qy)), L::mul(e2z, qz)), inv);
+
+			v const zero = L::set(0.0f);
+			typename L::mask const hit = L::both(
+				L::both(L::gt(L::abs(det), L::set(std::numeric_limits<float>::epsilon())), L::both(L::ge(u, zero), L::ge(w, zero))),
+				L::both(L::le(L::add(u, w), L::set(1.0f)), L::both(L::ge(s, zero), L::le(s, L::set(MaxDistance)))));
+			t = L::select(hit, s, L::set(std::numeric_limits<float>::infinity()));
+			return hit;
+		}
+	};
+
+	struct intersect_ray_plane
+	{
+		vec3 Orig, Dir;
+		float MaxDistance;
+		float const *PointX, *PointY, *PointZ, *NormalX, *NormalY, *NormalZ;
+
+		template<typename L>
+		GLM_FUNC_QUALIFIER typename L::mask operator()(L, std::size_t i, typename L::vec& t) const
+		{
+			typedef typename L::vec v;
+			v const nx = L::load(NormalX + i), ny = L::load(NormalY + i), nz = L::load(NormalZ + i);
+			v const d = L::add(L::add(L::mul(L::set(Dir.x), nx), L::mul(L::set(Dir.y), ny)), L::mul(L::set(Dir.z), nz));
+			v const wx = L::sub(L::load(PointX + i), L::set(Orig.x));
+			v const wy = L::sub(L::load(PointY + i), L::set(Orig.y));
+			v const wz = L::sub(L::load(PointZ + i), L::set(Orig.z));
+			v const s = L::div(L::add(L::add(L::mul(wx, nx), L::mul(wy, ny)), L::mul(wz, nz)), d);
+
+			typename L::mask const hit = L::both(
+				L::lt(d, L::set(-std::numeric_limits<float>::epsilon())),
+				L::both(L::ge(s, L::set(0.0f)), L::le(s, L::set(MaxDistance))));
+			t = L::select(hit, s, L::set(std::numeric_limits<float>::infinity()));
+			return hit;
+		}
+	};
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER std::size_t batchIntersectRayAABB(
+		vec2 const& Orig, vec2 const& Dir, float MaxDistance,
+		float const* min_x, float const* min_y, float const* max_x, float const* max_y,
+		std::size_t count, uint32* hits, float* distance)
+	{
+		detail::intersect_ray_aabb const Kernel = {Orig, vec2(1.0f) / Dir, MaxDistance, min_x, min_y, max_x, max_y};
+		return detail::batch_intersect(Kernel, count, hits, distance);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t batchIntersectRayCircle(
+		vec2 const& Orig, vec2 const& Dir, float MaxDistance,
+		float const* center_x, float const* center_y, float const* radius,
+		std::size_t count, uint32* hits, float* distance)
+	{
+		float const A = Dir.x * Dir.x + Dir.y * Dir.y;
+		detail::intersect_ray_circle const Kernel = {Orig, Dir, A, -1.0f / A, MaxDistance, center_x, center_y, radius};
+		return detail::batch_intersect(Kernel, count, hits, distance);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t batchIntersectRayOBB(
+		vec2 const& Orig, vec2 const& Dir, float MaxDistance,
+		float const* center_x, float const* center_y, float const* axis_x, float const* axis_y,
+		float const* half_x, float const* half_y,
+		std::size_t count, uint32* hits, float* distance)
+	{
+		detail::intersect_ray_obb const Kernel = {Orig, Dir, MaxDistance, center_x, center_y, axis_x, axis_y, half_x, half_y};
+		return detail::batch_intersect(Kernel, count, hits, distance);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t batchIntersectRaySegment(
+		vec2 const& Orig, vec2 const& Dir, float MaxDistance,
+		float const* a_x, float const* a_y, float const* b_x, float const* b_y,
+		std::size_t count, uint32* hits, float* distance)
+	{
+		detail::intersect_ray_segment const Kernel = {Orig, Dir, MaxDistance, a_x, a_y, b_x, b_y};
+		return detail::batch_intersect(Kernel, count, hits, distance);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t batchIntersectRaysAABB(
+		float const* orig_x, float const* orig_y, float const* dir_x, float const* dir_y, float MaxDistance,
+		vec2 const& Min, vec2 const& Max,
+		std::size_t count, uint32* hits, float* distance)
+	{
+		detail::intersect_rays_aabb const Kernel = {Min, Max, MaxDistance, orig_x, orig_y, dir_x, dir_y};
+		return detail::batch_intersect(Kernel, count, hits, distance);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t batchIntersectRaysCircle(
+		float const* orig_x, float const* orig_y, float const* dir_x, float const* dir_y, float MaxDistance,
+		vec2 const& Center, float Radius,
+		std::size_t count, uint32* hits, float* distance)
+	{
+		detail::intersect_rays_circle const Kernel = {Center, Radius, MaxDistance, orig_x, orig_y, dir_x, dir_y};
+		return detail::batch_intersect(Kernel, count, hits, distance);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t batchIntersectRaySphere(
+		vec3 const& Orig, vec3 const& Dir, float MaxDistance,
+		float const* center_x, float const* center_y, float const* center_z, float const* radius,
+		std::size_t count, uint32* hits, float* distance)
+	{
+		float const A = Dir.x * Dir.x + Dir.y * Dir.y + Dir.z * Dir.z;
+		detail::intersect_ray_sphere const Kernel = {Orig, Dir, A, -1.0f / A, MaxDistance, center_x, center_y, center_z, radius};
+		return detail::batch_intersect(Kernel, count, hits, distance);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t batchIntersectRayTriangle(
+		vec3 const& Orig, vec3 const& Dir, float MaxDistance,
+		float const* v0_x, float const* v0_y, float const* v0_z,
+		float const* v1_x, float const* v1_y, float const* v1_z,
+		float const* v2_x, float const* v2_y, float const* v2_z,
+		std::size_t count, uint32* hits, float* distance)
+	{
+		detail::intersect_ray_triangle const Kernel = {Orig, Dir, MaxDistance, v0_x, v0_y, v0_z, v1_x, v1_y, v1_z, v2_x, v2_y, v2_z};
+		return detail::batch_intersect(Kernel, count, hits, distance);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t batchIntersectRayPlane(
+		vec3 const& Orig, vec3 const& Dir, float MaxDistance,
+		float const* point_x, float const* point_y, float const* point_z,
+		float const* normal_x, float const* normal_y, float const* normal_z,
+		std::size_t count, uint32* hits, float* distance)
+	{
+		detail::intersect_ray_plane const Kernel = {Orig, Dir, MaxDistance, point_x, point_y, point_z, normal_x, normal_y, normal_z};
+		return detail::batch_intersect(Kernel, count, hits, distance);
+	}
+}//namespace glm
@@ -0,0 +1,71 @@
+/// @ref gtx_batch_math
+/// @file glm/gtx/batch_math.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_batch_math GLM_GTX_batch_math
+/// @ingroup gtx
+///
+/// Include <glm/gtx/batch_math.hpp> to use the features of this extension.
+///
+/// Elementwise sin, cos, atan2, exp and log over float arrays. With
+/// GLM_FORCE_INTRINSICS (or one of the GLM_FORCE_SSE2 / GLM_FORCE_AVX2
+/// family) the arrays are processed 4 or 8 lanes at a time by the kernels in
+/// glm/simd, and the tail runs the same polynomials one value at a time, so
+/// results do not depend on the array length or alignment. Without
+/// intrinsics each value goes to libm instead: one lane at a time the
+/// polynomials are slower than the library.
+///
+/// Accuracy of the kernels, against the double precision libm result
+/// rounded to float: batchSin, batchCos, batchSinCos max 2 ulp (absolute
+/// error below 1e-7 near the zeros) for |x| <= 8192, batchAtan2 max 3 ulp,
+/// batchExp and batchLog max 1 ulp. See glm/simd/trigonometric.h and
+/// glm/simd/exponential.h for the edge cases.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_batch_math is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_batch_math extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_batch_math
+	/// @{
+
+	/// out[i] = sin(x[i]) for i in [0, count). out may alias x.
+	/// From GLM_GTX_batch_math extension.
+	GLM_FUNC_DECL void batchSin(float const* x, float* out, std::size_t count);
+
+	/// out[i] = cos(x[i]) for i in [0, count). out may alias x.
+	/// From GLM_GTX_batch_math extension.
+	GLM_FUNC_DECL void batchCos(float const* x, float* out, std::size_t count);
+
+	/// Both at the cost of one: the range reduction is shared.
+	/// From GLM_GTX_batch_math extension.
+	GLM_FUNC_DECL void batchSinCos(float const* x, float* sin_out, float* cos_out, std::size_t count);
+
+	/// out[i] = atan2(y[i], x[i]) in [-pi, pi], for i in [0, count).
+	/// From GLM_GTX_batch_math extension.
+	GLM_FUNC_DECL void batchAtan2(float const* y, float const* x, float* out, std::size_t count);
+
+	/// out[i] = exp(x[i]) for i in [0, count). out may alias x.
+	/// From GLM_GTX_batch_math extension.
+	GLM_FUNC_DECL void batchExp(float const* x, float* out, std::size_t count);
+
+	/// out[i] = log(x[i]) for i in [0, count). out may alias x.
+	/// From GLM_GTX_batch_math extension.
+	GLM_FUNC_DECL void batchLog(float const* x, float* out, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "batch_math.inl"
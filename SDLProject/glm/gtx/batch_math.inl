@@ -0,0 +1,278 @@
+/// @ref gtx_batch_math
+
+#include "../simd/trigonometric.h"
+#include "../simd/exponential.h"
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// One lane of the glm/simd kernels, operation for operation
+	GLM_FUNC_QUALIFIER void batch_sincos(float x, float& s, float& c)
+	{
+		float a = std::abs(x);
+		if(!(a <= 1.6e9f)) // inf, NaN or a quadrant index that would overflow
+		{
+			s = std::sin(x);
+			c = std::cos(x);
+			return;
+		}
+
+		int const j = (static_cast<int>(a * sincos_four_over_pi) + 1) & ~1;
+		float const y = static_cast<float>(j);
+		a = a + y * sincos_dp1;
+		a = a + y * sincos_dp2;
+		a = a + y * sincos_dp3;
+		float const z = a * a;
+
+		float pc = ((cos_p0 * z + cos_p1) * z + cos_p2) * z * z;
+		pc = pc - z * 0.5f + 1.0f;
+		float const ps = ((sin_p0 * z + sin_p1) * z + sin_p2) * z * a + a;
+
+		bool const swap = (j & 2) != 0;
+		s = swap ? pc : ps;
+		c = swap ? ps : pc;
+		if(((j & 4) != 0) != std::signbit(x))
+			s = -s;
+		if(((j - 2) & 4) == 0)
+			c = -c;
+	}
+
+	GLM_FUNC_QUALIFIER float batch_atan2(float y, float x)
+	{
+		if(x != x || y != y)
+			return x + y;
+		float const ax = std::abs(x);
+		float const ay = std::abs(y);
+		bool const swap = ay > ax;
+		float const den = ax > ay ? ax : ay;
+		float a = den != 0.0f ? (ax < ay ? ax : ay) / den : 0.0f;
+
+		float offset = 0.0f;
+		if(a > atan_tan_pi_8)
+		{
+			a = (a - 1.0f) / (a + 1.0f);
+			offset = 0.78539816339744830962f;
+		}
+		float const z = a * a;
+		float r = (((atan_p0 * z + atan_p1) * z + atan_p2) * z + atan_p3) * z * a + a + offset;
+
+		if(swap)
+			r = 1.57079632679489661923f - r;
+		if(std::signbit(x))
+			r = 3.14159265358979323846f - r;
+		return std::signbit(y) ? -r : r;
+	}
+
+	GLM_FUNC_QUALIFIER float batch_pow2i(int n)
+	{
+		int const bits = (n + 127) << 23;
+		float f;
+		std::memcpy(&f, &bits, sizeof(f));
+		return f;
+	}
+
+	GLM_FUNC_QUALIFIER float batch_exp(float x)
+	{
+		if(x != x)
+			return x;
+		x = x < exp_hi ? x : exp_hi;
+		x = x > exp_lo ? x : exp_lo;
+
+		int const n = static_cast<int>(std::floor(x * exp_log2e + 0.5f));
+		float const fn = static_cast<float>(n);
+		x = x - fn * exp_c1;
+		x = x - fn * exp_c2;
+		float const z = x * x;
+
+		float p = ((((exp_p0 * x + exp_p1) * x + exp_p2) * x + exp_p3) * x + exp_p4) * x + exp_p5;
+		p = p * z + x + 1.0f;
+
+		int const n1 = n >> 1;
+		return p * batch_pow2i(n1) * batch_pow2i(n - n1);
+	}
+
+	GLM_FUNC_QUALIFIER float batch_log(float x)
+	{
+		if(!(x >= 0.0f))
+			return std::numeric_limits<float>::quiet_NaN();
+		if(x == 0.0f)
+			return -std::numeric_limits<float>::infinity();
+		if(x == std::numeric_limits<float>::infinity())
+			return x;
+
+		x = x > std::numeric_limits<float>::min() ? x : std::numeric_limits<float>::min();
+		unsigned int bits;
+		std::memcpy(&bits, &x, sizeof(bits));
+		float e = static_cast<float>(static_cast<int>(bits >> 23) - 126);
+		bits = (bits & 0x007fffffu) | 0x3f000000u;
+		std::memcpy(&x, &bits, sizeof(x));
+
+		if(x < log_sqrt_half)
+		{
+			e = e - 1.0f;
+			x = x - 1.0f + x;
+		}
+		else
+			x = x - 1.0f;
+		float const z = x * x;
+
+		float p = ((((((((log_p0 * x + log_p1) * x + log_p2) * x + log_p3) * x + log_p4) * x + log_p5) * x + log_p6) * x + log_p7) * x + log_p8);
+		p = p * x * z;
+		p = p + e * exp_c2;
+		p = p - z * 0.5f;
+		return x + p + e * exp_c1;
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void batchSinCos(float const* x, float* sin_out, float* cos_out, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			for(; i + 8 <= count; i += 8)
+			{
+				glm_f32vec8 s, c;
+				glm_vec8_sincos(_mm256_loadu_ps(x + i), &s, &c);
+				_mm256_storeu_ps(sin_out + i, s);
+				_mm256_storeu_ps(cos_out + i, c);
+			}
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_f32vec4 s, c;
+				glm_vec4_sincos(_mm_loadu_ps(x + i), &s, &c);
+				_mm_storeu_ps(sin_out + i, s);
+				_mm_storeu_ps(cos_out + i, c);
+			}
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i < count; ++i)
+				detail::batch_sincos(x[i], sin_out[i], cos_out[i]);
+#		else
+			for(; i < count; ++i)
+			{
+				sin_out[i] = std::sin(x[i]);
+				cos_out[i] = std::cos(x[i]);
+			}
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void batchSin(float const* x, float* out, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			for(; i + 8 <= count; i += 8)
+			{
+				glm_f32vec8 s, c;
+				glm_vec8_sincos(_mm256_loadu_ps(x + i), &s, &c);
+				_mm256_storeu_ps(out + i, s);
+			}
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 4 <= count; i += 4)
+				_mm_storeu_ps(out + i, glm_vec4_sin(_mm_loadu_ps(x + i)));
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i < count; ++i)
+			{
+				float s, c;
+				detail::batch_sincos(x[i], s, c);
+				out[i] = s;
+			}
+#		else
+			for(; i < count; ++i)
+				out[i] = std::sin(x[i]);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void batchCos(float const* x, float* out, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			for(; i + 8 <= count; i += 8)
+			{
+				glm_f32vec8 s, c;
+				glm_vec8_sincos(_mm256_loadu_ps(x + i), &s, &c);
+				_mm256_storeu_ps(out + i, c);
+			}
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 4 <= count; i += 4)
+				_mm_storeu_ps(out + i, glm_vec4_cos(_mm_loadu_ps(x + i)));
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i < count; ++i)
+			{
+				float s, c;
+				detail::batch_sincos(x[i], s, c);
+				out[i] = c;
+			}
+#		else
+			for(; i < count; ++i)
+				out[i] = std::cos(x[i]);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void batchAtan2(float const* y, float const* x, float* out, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			for(; i + 8 <= count; i += 8)
+				_mm256_storeu_ps(out + i, glm_vec8_atan2(_mm256_loadu_ps(y + i), _mm256_loadu_ps(x + i)));
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 4 <= count; i += 4)
+				_mm_storeu_ps(out + i, glm_vec4_atan2(_mm_loadu_ps(y + i), _mm_loadu_ps(x + i)));
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i < count; ++i)
+				out[i] = detail::batch_atan2(y[i], x[i]);
+#		else
+			for(; i < count; ++i)
+				out[i] = std::atan2(y[i], x[i]);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void batchExp(float const* x, float* out, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			for(; i + 8 <= count; i += 8)
+				_mm256_storeu_ps(out + i, glm_vec8_exp(_mm256_loadu_ps(x + i)));
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 4 <= count; i += 4)
+				_mm_storeu_ps(out + i, glm_vec4_exp(_mm_loadu_ps(x + i)));
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i < count; ++i)
+				out[i] = detail::batch_exp(x[i]);
+#		else
+			for(; i < count; ++i)
+				out[i] = std::exp(x[i]);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void batchLog(float const* x, float* out, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			for(; i + 8 <= count; i += 8)
+				_mm256_storeu_ps(out + i, glm_vec8_log(_mm256_loadu_ps(x + i)));
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 4 <= count; i += 4)
+				_mm_storeu_ps(out + i, glm_vec4_log(_mm_loadu_ps(x + i)));
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i < count; ++i)
+				out[i] = detail::batch_log(x[i]);
+#		else
+			for(; i < count; ++i)
+				out[i] = std::log(x[i]);
+#		endif
+	}
+}//namespace glm
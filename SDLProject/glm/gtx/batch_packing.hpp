@@ -0,0 +1,72 @@
+/// @ref gtx_batch_packing
+/// @file glm/gtx/batch_packing.hpp
+///
+/// @see core (dependence)
+/// @see gtc_packing (extended)
+///
+/// @defgroup gtx_batch_packing GLM_GTX_batch_packing
+/// @ingroup gtx
+///
+/// Include <glm/gtx/batch_packing.hpp> to use the features of this extension.
+///
+/// Array versions of the gtc_packing conversions, for building compact
+/// vertex streams. With GLM_FORCE_INTRINSICS (or one of the GLM_FORCE_SSE2
+/// family) the arrays are converted 4 to 16 values at a time; half floats
+/// use the F16C instructions when the compiler targets them (-mf16c, or an
+/// -march that includes them) and integer SSE2 otherwise. Without
+/// intrinsics, and for the tail, the same conversions run one value at a
+/// time, so every path gives the same bits.
+///
+/// Half floats round to nearest even like F16C: overflow gives infinity,
+/// NaN stays NaN with its top payload bits. Where the gtc_packing
+/// functions round halfway cases away from zero, the normalized packers
+/// here round them to even; no other value differs.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../ext/scalar_uint_sized.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_batch_packing is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_batch_packing extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_batch_packing
+	/// @{
+
+	/// out[i] = packHalf1x16(v[i]) for i in [0, count).
+	/// From GLM_GTX_batch_packing extension.
+	GLM_FUNC_DECL void batchPackHalf(float const* v, uint16* out, std::size_t count);
+
+	/// out[i] = unpackHalf1x16(p[i]) for i in [0, count).
+	/// From GLM_GTX_batch_packing extension.
+	GLM_FUNC_DECL void batchUnpackHalf(uint16 const* p, float* out, std::size_t count);
+
+	/// out[i] = packUnorm1x16(v[i]): v clamped to [0, 1], scaled to 65535.
+	/// From GLM_GTX_batch_packing extension.
+	GLM_FUNC_DECL void batchPackUnorm16(float const* v, uint16* out, std::size_t count);
+
+	/// out[i] = packUnorm1x8(v[i]): v clamped to [0, 1], scaled to 255.
+	/// From GLM_GTX_batch_packing extension.
+	GLM_FUNC_DECL void batchPackUnorm8(float const* v, uint8* out, std::size_t count);
+
+	/// out[i] = packSnorm1x16(v[i]): v clamped to [-1, 1], scaled to 32767.
+	/// From GLM_GTX_batch_packing extension.
+	GLM_FUNC_DECL void batchPackSnorm16(float const* v, uint16* out, std::size_t count);
+
+	/// out[i] = packSnorm1x8(v[i]): v clamped to [-1, 1], scaled to 127.
+	/// From GLM_GTX_batch_packing extension.
+	GLM_FUNC_DECL void batchPackSnorm8(float const* v, uint8* out, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "batch_packing.inl"
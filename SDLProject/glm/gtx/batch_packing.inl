@@ -0,0 +1,218 @@
+/// @ref gtx_batch_packing
+
+#include <cmath>
+#include <cstring>
+
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && defined(__F16C__)
+#	include <immintrin.h>
+#endif
+
+namespace glm{
+namespace detail
+{
+	// Rebias and round to nearest even in the integer domain; subnormal
+	// results come from adding 0.5f, which lines the kept bits up with the
+	// float's mantissa and lets the FPU do the rounding
+	GLM_FUNC_QUALIFIER uint16 batch_pack_half(float v)
+	{
+		uint32 f;
+		std::memcpy(&f, &v, sizeof(f));
+		uint32 const sign = f & 0x80000000u;
+		f ^= sign;
+
+		uint32 h;
+		if(f >= 0x47800000u) // 2^16 and above, infinity and NaN
+			h = f > 0x7f800000u ? 0x7e00u | ((f >> 13) & 0x3ffu) : 0x7c00u;
+		else if(f < 0x38800000u) // below 2^-14, the smallest normal half
+		{
+			float x;
+			std::memcpy(&x, &f, sizeof(x));
+			x += 0.5f;
+			std::memcpy(&h, &x, sizeof(h));
+			h -= 0x3f000000u;
+		}
+		else
+			h = (f + 0xc8000fffu + ((f >> 13) & 1u)) >> 13;
+		return static_cast<uint16>(h | (sign >> 16));
+	}
+
+	// The exponent and mantissa shifted into place and scaled by 2^112 to
+	// rebias, which also normalizes subnormal halves exactly
+	GLM_FUNC_QUALIFIER float batch_unpack_half(uint16 p)
+	{
+		uint32 const expmant = p & 0x7fffu;
+		uint32 bits = expmant << 13;
+		float x;
+		std::memcpy(&x, &bits, sizeof(x));
+		x *= 5.192296858534827628530496329220096e33f;
+		std::memcpy(&bits, &x, sizeof(bits));
+
+		bits |= static_cast<uint32>(p & 0x8000u) << 16;
+		if(expmant > 0x7bffu)
+			bits |= 0x7f800000u;
+		if(expmant > 0x7c00u)
+			bits |= 0x00400000u; // quiet, as F16C does
+		std::memcpy(&x, &bits, sizeof(x));
+		return x;
+	}
+
+	// Clamped with the operand order of maxps/minps, so NaN packs as Min
+	GLM_FUNC_QUALIFIER int batch_pack_norm(float v, float Min, float Scale)
+	{
+		v = v > Min ? v : Min;
+		v = v < 1.0f ? v : 1.0f;
+		return static_cast<int>(std::nearbyint(v * Scale));
+	}
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		GLM_FUNC_QUALIFIER glm_i32vec4 batch_pack_norm4(float const* v, float Min, float Scale)
+		{
+			glm_f32vec4 const x = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(v), _mm_set1_ps(Min)), _mm_set1_ps(1.0f));
+			return _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(Scale)));
+		}
+
+#		ifndef __F16C__
+			GLM_FUNC_QUALIFIER glm_i32vec4 batch_pack_half4(glm_f32vec4 v)
+			{
+				glm_i32vec4 const sign = _mm_and_si128(_mm_castps_si128(v), _mm_set1_epi32(static_cast<int>(0x80000000u)));
+				glm_i32vec4 const f = _mm_xor_si128(_mm_castps_si128(v), sign);
+
+				glm_i32vec4 const nan = _mm_or_si128(_mm_set1_epi32(0x7e00), _mm_and_si128(_mm_srli_epi32(f, 13), _mm_set1_epi32(0x3ff)));
+				glm_i32vec4 const is_nan = _mm_cmpgt_epi32(f, _mm_set1_epi32(0x7f800000));
+				glm_i32vec4 const special = _mm_or_si128(_mm_and_si128(is_nan, nan), _mm_andnot_si128(is_nan, _mm_set1_epi32(0x7c00)));
+
+				glm_f32vec4 const subnormal_sum = _mm_add_ps(_mm_castsi128_ps(f), _mm_set1_ps(0.5f));
+				glm_i32vec4 const subnormal = _mm_sub_epi32(_mm_castps_si128(subnormal_sum), _mm_set1_epi32(0x3f000000));
+
+				glm_i32vec4 const odd = _mm_and_si128(_mm_srli_epi32(f, 13), _mm_set1_epi32(1));
+				glm_i32vec4 const normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(f, _mm_set1_epi32(static_cast<int>(0xc8000fffu))), odd), 13);
+
+				glm_i32vec4 const is_subnormal = _mm_cmpgt_epi32(_mm_set1_epi32(0x38800000), f);
+				glm_i32vec4 const is_finite = _mm_cmpgt_epi32(_mm_set1_epi32(0x47800000), f);
+				glm_i32vec4 const finite = _mm_or_si128(_mm_and_si128(is_subnormal, subnormal), _mm_andnot_si128(is_subnormal, normal));
+				glm_i32vec4 const h = _mm_or_si128(_mm_and_si128(is_finite, finite), _mm_andnot_si128(is_finite, special));
+
+				// Sign extended into the high half, so packs_epi32 keeps the bits
+				return _mm_or_si128(h, _mm_srai_epi32(sign, 16));
+			}
+
+			GLM_FUNC_QUALIFIER glm_f32vec4 batch_unpack_half4(glm_i32vec4 p)
+			{
+				glm_i32vec4 const expmant = _mm_and_si128(p, _mm_set1_epi32(0x7fff));
+				glm_f32vec4 const scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expmant, 13)), _mm_set1_ps(5.192296858534827628530496329220096e33f));
+
+				glm_i32vec4 const sign = _mm_slli_epi32(_mm_xor_si128(p, expmant), 16);
+				glm_i32vec4 const exponent = _mm_and_si128(_mm_cmpgt_epi32(expmant, _mm_set1_epi32(0x7bff)), _mm_set1_epi32(0x7f800000));
+				glm_i32vec4 const quiet = _mm_and_si128(_mm_cmpgt_epi32(expmant, _mm_set1_epi32(0x7c00)), _mm_set1_epi32(0x00400000));
+				return _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(_mm_or_si128(sign, exponent), quiet)));
+			}
+#		endif
+#	endif
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void batchPackHalf(float const* v, uint16* out, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if (GLM_ARCH & GLM_ARCH_AVX_BIT) && defined(__F16C__)
+			for(; i + 8 <= count; i += 8)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(v + i), _MM_FROUND_TO_NEAREST_INT));
+#		endif
+#		if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && defined(__F16C__)
+			for(; i + 4 <= count; i += 4)
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_cvtps_ph(_mm_loadu_ps(v + i), _MM_FROUND_TO_NEAREST_INT));
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 8 <= count; i += 8)
+			{
+				glm_i32vec4 const a = detail::batch_pack_half4(_mm_loadu_ps(v + i));
+				glm_i32vec4 const b = detail::batch_pack_half4(_mm_loadu_ps(v + i + 4));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi32(a, b));
+			}
+#		endif
+		for(; i < count; ++i)
+			out[i] = detail::batch_pack_half(v[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void batchUnpackHalf(uint16 const* p, float* out, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if (GLM_ARCH & GLM_ARCH_AVX_BIT) && defined(__F16C__)
+			for(; i + 8 <= count; i += 8)
+				_mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i))));
+#		endif
+#		if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && defined(__F16C__)
+			for(; i + 4 <= count; i += 4)
+				_mm_storeu_ps(out + i, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(p + i))));
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 8 <= count; i += 8)
+			{
+				glm_i32vec4 const h = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i));
+				_mm_storeu_ps(out + i, detail::batch_unpack_half4(_mm_unpacklo_epi16(h, _mm_setzero_si128())));
+				_mm_storeu_ps(out + i + 4, detail::batch_unpack_half4(_mm_unpackhi_epi16(h, _mm_setzero_si128())));
+			}
+#		endif
+		for(; i < count; ++i)
+			out[i] = detail::batch_unpack_half(p[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void batchPackUnorm16(float const* v, uint16* out, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			// packs_epi32 saturates signed, so pack v - 32768 and flip the top bit back
+			glm_i32vec4 const bias = _mm_set1_epi32(32768);
+			for(; i + 8 <= count; i += 8)
+			{
+				glm_i32vec4 const a = _mm_sub_epi32(detail::batch_pack_norm4(v + i, 0.0f, 65535.0f), bias);
+				glm_i32vec4 const b = _mm_sub_epi32(detail::batch_pack_norm4(v + i + 4, 0.0f, 65535.0f), bias);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_xor_si128(_mm_packs_epi32(a, b), _mm_set1_epi16(static_cast<short>(0x8000))));
+			}
+#		endif
+		for(; i < count; ++i)
+			out[i] = static_cast<uint16>(detail::batch_pack_norm(v[i], 0.0f, 65535.0f));
+	}
+
+	GLM_FUNC_QUALIFIER void batchPackUnorm8(float const* v, uint8* out, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 16 <= count; i += 16)
+			{
+				glm_i32vec4 const ab = _mm_packs_epi32(detail::batch_pack_norm4(v + i, 0.0f, 255.0f), detail::batch_pack_norm4(v + i + 4, 0.0f, 255.0f));
+				glm_i32vec4 const cd = _mm_packs_epi32(detail::batch_pack_norm4(v + i + 8, 0.0f, 255.0f), detail::batch_pack_norm4(v + i + 12, 0.0f, 255.0f));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(ab, cd));
+			}
+#		endif
+		for(; i < count; ++i)
+			out[i] = static_cast<uint8>(detail::batch_pack_norm(v[i], 0.0f, 255.0f));
+	}
+
+	GLM_FUNC_QUALIFIER void batchPackSnorm16(float const* v, uint16* out, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 8 <= count; i += 8)
+			{
+				glm_i32vec4 const a = detail::batch_pack_norm4(v + i, -1.0f, 32767.0f);
+				glm_i32vec4 const b = detail::batch_pack_norm4(v + i + 4, -1.0f, 32767.0f);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi32(a, b));
+			}
+#		endif
+		for(; i < count; ++i)
+			out[i] = static_cast<uint16>(detail::batch_pack_norm(v[i], -1.0f, 32767.0f));
+	}
+
+	GLM_FUNC_QUALIFIER void batchPackSnorm8(float const* v, uint8* out, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 16 <= count; i += 16)
+			{
+				glm_i32vec4 const ab = _mm_packs_epi32(detail::batch_pack_norm4(v + i, -1.0f, 127.0f), detail::batch_pack_norm4(v + i + 4, -1.0f, 127.0f));
+				glm_i32vec4 const cd = _mm_packs_epi32(detail::batch_pack_norm4(v + i + 8, -1.0f, 127.0f), detail::batch_pack_norm4(v + i + 12, -1.0f, 127.0f));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi16(ab, cd));
+			}
+#		endif
+		for(; i < count; ++i)
+			out[i] = static_cast<uint8>(detail::batch_pack_norm(v[i], -1.0f, 127.0f));
+	}
+}//namespace glm
@@ -0,0 +1,63 @@
+/// @ref gtx_fast_hash
+/// @file glm/gtx/fast_hash.hpp
+///
+/// @see core (dependence)
+/// @see gtx_hash (replaced)
+///
+/// @defgroup gtx_fast_hash GLM_GTX_fast_hash
+/// @ingroup gtx
+///
+/// Include <glm/gtx/fast_hash.hpp> to use the features of this extension.
+///
+/// Hashing of glm vectors for hash tables keyed by grid cells, tile
+/// coordinates and the like. gtx_hash folds std::hash of each component
+/// together with hash_combine, which is slow and leaves the low bits of
+/// nearby integer or float keys correlated. Here the component bits are
+/// packed into 64-bit words, two per word for 32-bit and smaller types, and
+/// each word goes through the murmur3 64-bit finalizer. A vec2 of ints or
+/// floats costs one finalizer, a vec3 or vec4 two; every input bit affects
+/// every output bit.
+///
+/// Float components hash by value: 0 and -0 hash the same, as they compare
+/// equal. The hashes are the same on every platform, but not meant to be
+/// stored: they may change between versions.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../ext/scalar_uint_sized.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_fast_hash is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_fast_hash extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_fast_hash
+	/// @{
+
+	/// 64-bit hash of a vector of integers, floats or bools. Different
+	/// seeds give independent hash functions.
+	/// From GLM_GTX_fast_hash extension.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL uint64 fastHash(vec<L, T, Q> const& v, uint64 seed = 0);
+
+	/// Hash functor for unordered containers, e.g.
+	/// std::unordered_map<ivec2, T, fast_hasher<ivec2> >.
+	/// From GLM_GTX_fast_hash extension.
+	template<typename genType>
+	struct fast_hasher
+	{
+		GLM_FUNC_DECL std::size_t operator()(genType const& v) const;
+	};
+
+	/// @}
+}//namespace glm
+
+#include "fast_hash.inl"
@@ -0,0 +1,96 @@
+/// @ref gtx_fast_hash
+
+#include <cstring>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// The murmur3 64-bit finalizer: a bijection with full avalanche
+	GLM_FUNC_QUALIFIER uint64 hash_finalize(uint64 h)
+	{
+		h ^= h >> 33;
+		h *= 0xff51afd7ed558ccdull;
+		h ^= h >> 33;
+		h *= 0xc4ceb9fe1a85ec53ull;
+		h ^= h >> 33;
+		return h;
+	}
+
+	// The bits of one component, zero extended. Floats hash by value, so
+	// -0 is folded onto 0.
+	template<typename T, bool is_float = std::numeric_limits<T>::is_iec559, std::size_t size = sizeof(T)>
+	struct hash_bits
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(T x)
+		{
+			return static_cast<uint64>(x) & (~uint64(0) >> (64 - 8 * size));
+		}
+	};
+
+	template<typename T>
+	struct hash_bits<T, false, 8>
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(T x)
+		{
+			return static_cast<uint64>(x);
+		}
+	};
+
+	template<typename T>
+	struct hash_bits<T, true, 4>
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(T x)
+		{
+			uint32 Bits = 0;
+			if(x != static_cast<T>(0))
+				std::memcpy(&Bits, &x, sizeof(Bits));
+			return Bits;
+		}
+	};
+
+	template<typename T>
+	struct hash_bits<T, true, 8>
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(T x)
+		{
+			uint64 Bits = 0;
+			if(x != static_cast<T>(0))
+				std::memcpy(&Bits, &x, sizeof(Bits));
+			return Bits;
+		}
+	};
+
+	// Components per 64-bit word
+	template<typename T>
+	struct hash_packing
+	{
+		static const length_t value = sizeof(T) <= 4 ? 2 : 1;
+	};
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER uint64 fastHash(vec<L, T, Q> const& v, uint64 seed)
+	{
+		length_t const Packing = detail::hash_packing<T>::value;
+
+		uint64 Hash = seed;
+		for(length_t i = 0; i < L; i += Packing)
+		{
+			uint64 Word = detail::hash_bits<T>::call(v[i]);
+			if(Packing == 2 && i + 1 < L)
+				Word |= detail::hash_bits<T>::call(v[i + 1]) << 32;
+			Hash = detail::hash_finalize(Hash ^ Word);
+		}
+		return Hash;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	struct fast_hasher<vec<L, T, Q> >
+	{
+		GLM_FUNC_QUALIFIER std::size_t operator()(vec<L, T, Q> const& v) const
+		{
+			return static_cast<std::size_t>(fastHash(v));
+		}
+	};
+}//namespace glm
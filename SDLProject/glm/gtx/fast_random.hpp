@@ -0,0 +1,133 @@
+/// @ref gtx_fast_random
+/// @file glm/gtx/fast_random.hpp
+///
+/// @see core (dependence)
+/// @see gtc_random (replaced)
+/// @see gtx_batch_math (dependence)
+///
+/// @defgroup gtx_fast_random GLM_GTX_fast_random
+/// @ingroup gtx
+///
+/// Include <glm/gtx/fast_random.hpp> to use the features of this extension.
+///
+/// A seedable random engine for the cases gtc_random is too slow for, such
+/// as particle emitters spawning 100k particles a frame. gtc_random builds
+/// every value out of std::rand() calls, which share one global state (and
+/// a lock in some C libraries) and return 15 to 31 bits of a weak
+/// generator.
+///
+/// xoshiro128 runs 8 interleaved xoshiro128++ streams, each a jump of 2^64
+/// values ahead of the previous, so one step produces 8 words and the batch
+/// functions advance all 8 streams together: 4 or 8 lanes at a time with
+/// GLM_FORCE_INTRINSICS (or one of the GLM_FORCE_SSE2 / GLM_FORCE_AVX2
+/// family), one value at a time otherwise. Both produce the same values for
+/// the same seed and sequence of calls, as long as the build does not
+/// contract multiply-adds into FMA.
+///
+/// Gaussian values come from a 128 layer ziggurat (Marsaglia and Tsang):
+/// about 99% of them cost one word, a table lookup and a multiplication;
+/// the rest fall back to exp and log.
+///
+/// An engine is not thread safe. threadRandom() gives each thread its own.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../ext/scalar_uint_sized.hpp"
+#include "./batch_math.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_fast_random is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_fast_random extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_fast_random
+	/// @{
+
+	/// 8 xoshiro128++ streams, advanced together.
+	/// Plain data: seed it with seedRandom() before use.
+	struct xoshiro128
+	{
+		/// state[word][stream]
+		uint32 state[4][8];
+
+		/// Words of the last step not yet returned by fastRand(), from buffer[cursor] on.
+		uint32 buffer[8];
+		uint32 cursor;
+	};
+
+	/// Resets the engine to a state derived from seed with splitmix64.
+	/// From GLM_GTX_fast_random extension.
+	GLM_FUNC_DECL void seedRandom(xoshiro128& engine, uint64 seed);
+
+	/// The calling thread's engine, seeded from std::random_device the first
+	/// time the thread asks for it unless seedThreadRandom() came first.
+	/// From GLM_GTX_fast_random extension.
+	GLM_FUNC_DECL xoshiro128& threadRandom();
+
+	/// Reseeds the calling thread's engine, for reproducible runs.
+	/// From GLM_GTX_fast_random extension.
+	GLM_FUNC_DECL void seedThreadRandom(uint64 seed);
+
+	/// The next 32 random bits.
+	/// From GLM_GTX_fast_random extension.
+	GLM_FUNC_DECL uint32 fastRand(xoshiro128& engine);
+
+	/// Uniform in [Min, Max), with 24 random bits.
+	/// From GLM_GTX_fast_random extension.
+	GLM_FUNC_DECL float fastLinearRand(xoshiro128& engine, float Min, float Max);
+
+	/// Normally distributed with the given mean and standard deviation.
+	/// From GLM_GTX_fast_random extension.
+	GLM_FUNC_DECL float fastGaussRand(xoshiro128& engine, float Mean, float Deviation);
+
+	/// Uniform on the circle of the given radius.
+	/// From GLM_GTX_fast_random extension.
+	GLM_FUNC_DECL vec2 fastCircularRand(xoshiro128& engine, float Radius);
+
+	/// Uniform over the disk of the given radius.
+	/// From GLM_GTX_fast_random extension.
+	GLM_FUNC_DECL vec2 fastDiskRand(xoshiro128& engine, float Radius);
+
+	/// Uniform on the sphere of the given radius.
+	/// From GLM_GTX_fast_random extension.
+	GLM_FUNC_DECL vec3 fastSphericalRand(xoshiro128& engine, float Radius);
+
+	/// The batch functions fill count values. They draw whole steps of the
+	/// engine and leave the words buffered for fastRand() untouched.
+
+	/// out[i] = 32 random bits.
+	/// From GLM_GTX_fast_random extension.
+	GLM_FUNC_DECL void batchRand(xoshiro128& engine, uint32* out, std::size_t count);
+
+	/// out[i] uniform in [Min, Max).
+	/// From GLM_GTX_fast_random extension.
+	GLM_FUNC_DECL void batchLinearRand(xoshiro128& engine, float Min, float Max, float* out, std::size_t count);
+
+	/// out[i] normally distributed with the given mean and standard deviation.
+	/// From GLM_GTX_fast_random extension.
+	GLM_FUNC_DECL void batchGaussRand(xoshiro128& engine, float Mean, float Deviation, float* out, std::size_t count);
+
+	/// (x[i], y[i]) uniform on the circle of the given radius.
+	/// From GLM_GTX_fast_random extension.
+	GLM_FUNC_DECL void batchCircularRand(xoshiro128& engine, float Radius, float* x, float* y, std::size_t count);
+
+	/// (x[i], y[i]) uniform over the disk of the given radius.
+	/// From GLM_GTX_fast_random extension.
+	GLM_FUNC_DECL void batchDiskRand(xoshiro128& engine, float Radius, float* x, float* y, std::size_t count);
+
+	/// (x[i], y[i], z[i]) uniform on the sphere of the given radius.
+	/// From GLM_GTX_fast_random extension.
+	GLM_FUNC_DECL void batchSphericalRand(xoshiro128& engine, float Radius, float* x, float* y, float* z, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "fast_random.inl"
@@ -0,0 +1,664 @@
+/// @ref gtx_fast_random
+
+#include <cmath>
+#include <cstring>
+#include <random>
+
+namespace glm{
+namespace detail
+{
+	static float const fast_random_two_pi = 6.28318530717958647692f;
+
+	// 2^-24: a word's top 24 bits as a float in [0, 1)
+	static float const fast_random_ulp = 5.9604644775390625e-8f;
+
+	// Start of the ziggurat's tail; with 128 layers each has area 9.91256303526217e-3
+	static float const ziggurat_r = 3.442619855899f;
+
+	GLM_FUNC_QUALIFIER uint64 fast_random_splitmix(uint64& x)
+	{
+		uint64 z = (x += 0x9e3779b97f4a7c15ull);
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+		return z ^ (z >> 31);
+	}
+
+	GLM_FUNC_QUALIFIER uint32 fast_random_rotl(uint32 x, int k)
+	{
+		return (x << k) | (x >> (32 - k));
+	}
+
+	// One xoshiro128++ step of a single stream
+	GLM_FUNC_QUALIFIER uint32 fast_random_next(uint32 (&s)[4])
+	{
+		uint32 const result = fast_random_rotl(s[0] + s[3], 7) + s[0];
+		uint32 const t = s[1] << 9;
+		s[2] ^= s[0];
+		s[3] ^= s[1];
+		s[1] ^= s[2];
+		s[0] ^= s[3];
+		s[2] ^= t;
+		s[3] = fast_random_rotl(s[3], 11);
+		return result;
+	}
+
+	// Advances a stream by 2^64 steps
+	GLM_FUNC_QUALIFIER void fast_random_jump(uint32 (&s)[4])
+	{
+		static uint32 const jump[4] = {0x8764000bu, 0xf542d2d3u, 0x6fa035c3u, 0x77f2db5bu};
+
+		uint32 t[4] = {0, 0, 0, 0};
+		for(int i = 0; i < 4; ++i)
+		for(int b = 0; b < 32; ++b)
+		{
+			if(jump[i] & (1u << b))
+			{
+				t[0] ^= s[0];
+				t[1] ^= s[1];
+				t[2] ^= s[2];
+				t[3] ^= s[3];
+			}
+			fast_random_next(s);
+		}
+		for(int i = 0; i < 4; ++i)
+			s[i] = t[i];
+	}
+
+	GLM_FUNC_QUALIFIER float fast_random_unit(uint32 w)
+	{
+		return static_cast<float>(static_cast<int>(w >> 8)) * fast_random_ulp;
+	}
+
+	// In (0, 1], for log
+	GLM_FUNC_QUALIFIER float fast_random_open_unit(uint32 w)
+	{
+		return static_cast<float>(static_cast<int>((w >> 8) + 1)) * fast_random_ulp;
+	}
+
+	// The 8 streams held in registers for the length of a batch
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		struct fast_random_lanes
+		{
+			__m256i s0, s1, s2, s3;
+
+			GLM_FUNC_QUALIFIER explicit fast_random_lanes(xoshiro128 const& engine)
+				: s0(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(engine.state[0])))
+				, s1(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(engine.state[1])))
+				, s2(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(engine.state[2])))
+				, s3(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(engine.state[3])))
+			{}
+
+			GLM_FUNC_QUALIFIER static __m256i rotl(__m256i x, int k)
+			{
+				return _mm256_or_si256(_mm256_slli_epi32(x, k), _mm256_srli_epi32(x, 32 - k));
+			}
+
+			GLM_FUNC_QUALIFIER __m256i next()
+			{
+				__m256i const result = _mm256_add_epi32(rotl(_mm256_add_epi32(s0, s3), 7), s0);
+				__m256i const t = _mm256_slli_epi32(s1, 9);
+				s2 = _mm256_xor_si256(s2, s0);
+				s3 = _mm256_xor_si256(s3, s1);
+				s1 = _mm256_xor_si256(s1, s2);
+				s0 = _mm256_xor_si256(s0, s3);
+				s2 = _mm256_xor_si256(s2, t);
+				s3 = rotl(s3, 11);
+				return result;
+			}
+
+			GLM_FUNC_QUALIFIER void next(uint32* words)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(words), next());
+			}
+
+			GLM_FUNC_QUALIFIER void store(xoshiro128& engine) const
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(engine.state[0]), s0);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(engine.state[1]), s1);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(engine.state[2]), s2);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(engine.state[3]), s3);
+			}
+		};
+
+		GLM_FUNC_QUALIFIER glm_f32vec8 fast_random_unit8(__m256i w)
+		{
+			return _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(w, 8)), _mm256_set1_ps(fast_random_ulp));
+		}
+#	elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+		// Streams 0-3 in the low registers, 4-7 in the high ones
+		struct fast_random_lanes
+		{
+			__m128i s0[2], s1[2], s2[2], s3[2];
+
+			GLM_FUNC_QUALIFIER explicit fast_random_lanes(xoshiro128 const& engine)
+			{
+				for(int h = 0; h < 2; ++h)
+				{
+					s0[h] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(engine.state[0] + h * 4));
+					s1[h] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(engine.state[1] + h * 4));
+					s2[h] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(engine.state[2] + h * 4));
+					s3[h] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(engine.state[3] + h * 4));
+				}
+			}
+
+			GLM_FUNC_QUALIFIER static __m128i rotl(__m128i x, int k)
+			{
+				return _mm_or_si128(_mm_slli_epi32(x, k), _mm_srli_epi32(x, 32 - k));
+			}
+
+			GLM_FUNC_QUALIFIER __m128i next(int h)
+			{
+				__m128i const result = _mm_add_epi32(rotl(_mm_add_epi32(s0[h], s3[h]), 7), s0[h]);
+				__m128i const t = _mm_slli_epi32(s1[h], 9);
+				s2[h] = _mm_xor_si128(s2[h], s0[h]);
+				s3[h] = _mm_xor_si128(s3[h], s1[h]);
+				s1[h] = _mm_xor_si128(s1[h], s2[h]);
+				s0[h] = _mm_xor_si128(s0[h], s3[h]);
+				s2[h] = _mm_xor_si128(s2[h], t);
+				s3[h] = rotl(s3[h], 11);
+				return result;
+			}
+
+			GLM_FUNC_QUALIFIER void next(uint32* words)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(words), next(0));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(words + 4), next(1));
+			}
+
+			GLM_FUNC_QUALIFIER void store(xoshiro128& engine) const
+			{
+				for(int h = 0; h < 2; ++h)
+				{
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(engine.state[0] + h * 4), s0[h]);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(engine.state[1] + h * 4), s1[h]);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(engine.state[2] + h * 4), s2[h]);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(engine.state[3] + h * 4), s3[h]);
+				}
+			}
+		};
+
+		GLM_FUNC_QUALIFIER glm_f32vec4 fast_random_unit4(__m128i w)
+		{
+			return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(w, 8)), _mm_set1_ps(fast_random_ulp));
+		}
+#	else
+		struct fast_random_lanes
+		{
+			uint32 s[8][4];
+
+			GLM_FUNC_QUALIFIER explicit fast_random_lanes(xoshiro128 const& engine)
+			{
+				for(int l = 0; l < 8; ++l)
+				for(int i = 0; i < 4; ++i)
+					s[l][i] = engine.state[i][l];
+			}
+
+			GLM_FUNC_QUALIFIER void next(uint32* words)
+			{
+				for(int l = 0; l < 8; ++l)
+					words[l] = fast_random_next(s[l]);
+			}
+
+			GLM_FUNC_QUALIFIER void store(xoshiro128& engine) const
+			{
+				for(int l = 0; l < 8; ++l)
+				for(int i = 0; i < 4; ++i)
+					engine.state[i][l] = s[l][i];
+			}
+		};
+#	endif
+
+	// Words for the rare values that need more than one, drawn from the
+	// batch's streams after the current step
+	struct fast_random_spare
+	{
+		fast_random_lanes& lanes;
+		uint32 words[8];
+		int cursor;
+
+		GLM_FUNC_QUALIFIER explicit fast_random_spare(fast_random_lanes& l) : lanes(l), cursor(8) {}
+
+		GLM_FUNC_QUALIFIER uint32 operator()()
+		{
+			if(cursor == 8)
+			{
+				lanes.next(words);
+				cursor = 0;
+			}
+			return words[cursor++];
+		}
+	};
+
+	struct fast_random_engine_source
+	{
+		xoshiro128& engine;
+
+		GLM_FUNC_QUALIFIER uint32 operator()()
+		{
+			return fastRand(engine);
+		}
+	};
+
+	// Layer i spans [0, x_i) and lies between heights f[i] and f[i - 1];
+	// layer 0 is the base strip including the tail, layer 1 the top. A word
+	// picks the layer with its low 7 bits, the sign with bit 7 and the
+	// position with its top 24 bits, which are accepted at once when below
+	// k[i] = 2^24 x_(i-1) / x_i.
+	struct ziggurat_tables
+	{
+		uint32 k[128];
+		float w[128]; // x_i / 2^24, the base strip's width for layer 0
+		float f[128]; // exp(-x_i^2 / 2)
+
+		GLM_FUNC_QUALIFIER ziggurat_tables()
+		{
+			double const m = 16777216.0;
+			double const v = 9.91256303526217e-3;
+			double x = 3.442619855899;
+			double previous = x;
+			double const q = v / std::exp(-0.5 * x * x);
+
+			k[0] = static_cast<uint32>(x / q * m);
+			k[1] = 0;
+			w[0] = static_cast<float>(q / m);
+			w[127] = static_cast<float>(x / m);
+			f[0] = 1.0f;
+			f[127] = static_cast<float>(std::exp(-0.5 * x * x));
+
+			for(int i = 126; i >= 1; --i)
+			{
+				x = std::sqrt(-2.0 * std::log(v / x + std::exp(-0.5 * x * x)));
+				k[i + 1] = static_cast<uint32>(x / previous * m);
+				previous = x;
+				f[i] = static_cast<float>(std::exp(-0.5 * x * x));
+				w[i] = static_cast<float>(x / m);
+			}
+		}
+	};
+
+	GLM_FUNC_QUALIFIER ziggurat_tables const& ziggurat()
+	{
+		static ziggurat_tables const Tables;
+		return Tables;
+	}
+
+	GLM_FUNC_QUALIFIER bool ziggurat_fast(ziggurat_tables const& t, uint32 word, float& x)
+	{
+		uint32 const i = word & 127u;
+		uint32 const m = word >> 8;
+		// Sign bit from bit 7 without a branch, which would mispredict half the time
+		uint32 bits;
+		float const magnitude = static_cast<float>(static_cast<int>(m)) * t.w[i];
+		std::memcpy(&bits, &magnitude, sizeof(bits));
+		bits ^= (word & 128u) << 24;
+		std::memcpy(&x, &bits, sizeof(x));
+		return m < t.k[i];
+	}
+
+	template<typename source>
+	GLM_FUNC_QUALIFIER float ziggurat_slow(ziggurat_tables const& t, uint32 word, source& next)
+	{
+		for(;;)
+		{
+			float x;
+			if(ziggurat_fast(t, word, x))
+				return x;
+
+			uint32 const i = word & 127u;
+			if(i == 0)
+			{
+				float tail, y;
+				do
+				{
+					tail = -std::log(fast_random_open_unit(next())) / ziggurat_r;
+					y = -std::log(fast_random_open_unit(next()));
+				}
+				while(y + y < tail * tail);
+				return word & 128u ? -(ziggurat_r + tail) : ziggurat_r + tail;
+			}
+			if(t.f[i] + fast_random_unit(next()) * (t.f[i - 1] - t.f[i]) < std::exp(-0.5f * x * x))
+				return x;
+			word = next();
+		}
+	}
+
+	// Ziggurat fast path for one step's words: out[l] = x * Deviation + Mean,
+	// returning a bit per stream whose value still needs ziggurat_slow
+	GLM_FUNC_QUALIFIER unsigned int ziggurat_fast8(ziggurat_tables const& t, uint32 const* words, float Mean, float Deviation, float* out)
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			__m256i const w = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(words));
+			__m256i const i = _mm256_and_si256(w, _mm256_set1_epi32(127));
+			__m256i const m = _mm256_srli_epi32(w, 8);
+			__m256i const k = _mm256_i32gather_epi32(reinterpret_cast<int const*>(t.k), i, 4);
+			glm_f32vec8 const width = _mm256_i32gather_ps(t.w, i, 4);
+			glm_f32vec8 const sign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(w, _mm256_set1_epi32(128)), 24));
+			glm_f32vec8 const x = _mm256_xor_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(m), width), sign);
+			_mm256_storeu_ps(out, _mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(Deviation)), _mm256_set1_ps(Mean)));
+			return ~static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(k, m)))) & 0xffu;
+#		else
+			unsigned int rejected = 0;
+			for(int l = 0; l < 8; ++l)
+			{
+				float x;
+				if(!ziggurat_fast(t, words[l], x))
+					rejected |= 1u << l;
+				out[l] = x * Deviation + Mean;
+			}
+			return rejected;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void fast_random_circle(uint32 w, float Radius, float& x, float& y)
+	{
+		float s, c;
+		batch_sincos(fast_random_unit(w) * fast_random_two_pi, s, c);
+		x = c * Radius;
+		y = s * Radius;
+	}
+
+	GLM_FUNC_QUALIFIER void fast_random_disk(uint32 w_radius, uint32 w_angle, float Radius, float& x, float& y)
+	{
+		float s, c;
+		batch_sincos(fast_random_unit(w_angle) * fast_random_two_pi, s, c);
+		float const r = std::sqrt(fast_random_unit(w_radius)) * Radius;
+		x = c * r;
+		y = s * r;
+	}
+
+	GLM_FUNC_QUALIFIER void fast_random_sphere(uint32 w_z, uint32 w_angle, float Radius, float& x, float& y, float& z)
+	{
+		float s, c;
+		batch_sincos(fast_random_unit(w_angle) * fast_random_two_pi, s, c);
+		float const h = fast_random_unit(w_z) * 2.0f - 1.0f;
+		float const r = std::sqrt(1.0f - h * h) * Radius;
+		x = c * r;
+		y = s * r;
+		z = h * Radius;
+	}
+
+	struct fast_random_thread
+	{
+		xoshiro128 engine;
+		bool seeded;
+	};
+
+	GLM_FUNC_QUALIFIER fast_random_thread& fast_random_this_thread()
+	{
+		static thread_local fast_random_thread Thread;
+		return Thread;
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void seedRandom(xoshiro128& engine, uint64 seed)
+	{
+		uint32 s[4];
+		for(int i = 0; i < 4; i += 2)
+		{
+			uint64 const z = detail::fast_random_splitmix(seed);
+			s[i] = static_cast<uint32>(z);
+			s[i + 1] = static_cast<uint32>(z >> 32);
+		}
+		if((s[0] | s[1] | s[2] | s[3]) == 0)
+			s[0] = 1;
+
+		for(int l = 0; l < 8; ++l)
+		{
+			if(l > 0)
+				detail::fast_random_jump(s);
+			for(int i = 0; i < 4; ++i)
+				engine.state[i][l] = s[i];
+		}
+		engine.cursor = 8;
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro128& threadRandom()
+	{
+		detail::fast_random_thread& Thread = detail::fast_random_this_thread();
+		if(!Thread.seeded)
+		{
+			std::random_device Device;
+			uint64 const High = Device();
+			seedRandom(Thread.engine, (High << 32) ^ Device());
+			Thread.seeded = true;
+		}
+		return Thread.engine;
+	}
+
+	GLM_FUNC_QUALIFIER void seedThreadRandom(uint64 seed)
+	{
+		detail::fast_random_thread& Thread = detail::fast_random_this_thread();
+		seedRandom(Thread.engine, seed);
+		Thread.seeded = true;
+	}
+
+	GLM_FUNC_QUALIFIER uint32 fastRand(xoshiro128& engine)
+	{
+		if(engine.cursor >= 8)
+		{
+			detail::fast_random_lanes lanes(engine);
+			lanes.next(engine.buffer);
+			lanes.store(engine);
+			engine.cursor = 0;
+		}
+		return engine.buffer[engine.cursor++];
+	}
+
+	GLM_FUNC_QUALIFIER float fastLinearRand(xoshiro128& engine, float Min, float Max)
+	{
+		return detail::fast_random_unit(fastRand(engine)) * (Max - Min) + Min;
+	}
+
+	GLM_FUNC_QUALIFIER float fastGaussRand(xoshiro128& engine, float Mean, float Deviation)
+	{
+		detail::fast_random_engine_source next = {engine};
+		return detail::ziggurat_slow(detail::ziggurat(), fastRand(engine), next) * Deviation + Mean;
+	}
+
+	GLM_FUNC_QUALIFIER vec2 fastCircularRand(xoshiro128& engine, float Radius)
+	{
+		vec2 Result;
+		detail::fast_random_circle(fastRand(engine), Radius, Result.x, Result.y);
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER vec2 fastDiskRand(xoshiro128& engine, float Radius)
+	{
+		uint32 const w_radius = fastRand(engine);
+		vec2 Result;
+		detail::fast_random_disk(w_radius, fastRand(engine), Radius, Result.x, Result.y);
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER vec3 fastSphericalRand(xoshiro128& engine, float Radius)
+	{
+		uint32 const w_z = fastRand(engine);
+		vec3 Result;
+		detail::fast_random_sphere(w_z, fastRand(engine), Radius, Result.x, Result.y, Result.z);
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER void batchRand(xoshiro128& engine, uint32* out, std::size_t count)
+	{
+		detail::fast_random_lanes lanes(engine);
+		std::size_t i = 0;
+		for(; i + 8 <= count; i += 8)
+			lanes.next(out + i);
+		if(i < count)
+		{
+			uint32 words[8];
+			lanes.next(words);
+			for(std::size_t l = 0; i + l < count; ++l)
+				out[i + l] = words[l];
+		}
+		lanes.store(engine);
+	}
+
+	GLM_FUNC_QUALIFIER void batchLinearRand(xoshiro128& engine, float Min, float Max, float* out, std::size_t count)
+	{
+		detail::fast_random_lanes lanes(engine);
+		float const Range = Max - Min;
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			for(; i + 8 <= count; i += 8)
+			{
+				glm_f32vec8 const u = detail::fast_random_unit8(lanes.next());
+				_mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_mul_ps(u, _mm256_set1_ps(Range)), _mm256_set1_ps(Min)));
+			}
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 8 <= count; i += 8)
+			for(int h = 0; h < 2; ++h)
+			{
+				glm_f32vec4 const u = detail::fast_random_unit4(lanes.next(h));
+				_mm_storeu_ps(out + i + h * 4, _mm_add_ps(_mm_mul_ps(u, _mm_set1_ps(Range)), _mm_set1_ps(Min)));
+			}
+#		endif
+		uint32 words[8];
+		for(; i < count; i += 8)
+		{
+			lanes.next(words);
+			for(std::size_t l = 0; l < 8 && i + l < count; ++l)
+				out[i + l] = detail::fast_random_unit(words[l]) * Range + Min;
+		}
+		lanes.store(engine);
+	}
+
+	GLM_FUNC_QUALIFIER void batchGaussRand(xoshiro128& engine, float Mean, float Deviation, float* out, std::size_t count)
+	{
+		detail::ziggurat_tables const& Tables = detail::ziggurat();
+		detail::fast_random_lanes lanes(engine);
+		detail::fast_random_spare spare(lanes);
+		uint32 words[8];
+		float partial[8];
+		for(std::size_t i = 0; i < count; i += 8)
+		{
+			std::size_t const n = count - i < 8 ? count - i : 8;
+			float* const dst = n == 8 ? out + i : partial;
+			lanes.next(words);
+			unsigned int rejected = detail::ziggurat_fast8(Tables, words, Mean, Deviation, dst);
+			for(std::size_t l = 0; rejected != 0 && l < n; ++l, rejected >>= 1)
+				if(rejected & 1u)
+					dst[l] = detail::ziggurat_slow(Tables, words[l], spare) * Deviation + Mean;
+			if(dst == partial)
+				for(std::size_t l = 0; l < n; ++l)
+					out[i + l] = partial[l];
+		}
+		lanes.store(engine);
+	}
+
+	GLM_FUNC_QUALIFIER void batchCircularRand(xoshiro128& engine, float Radius, float* x, float* y, std::size_t count)
+	{
+		detail::fast_random_lanes lanes(engine);
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			for(; i + 8 <= count; i += 8)
+			{
+				glm_f32vec8 s, c;
+				glm_vec8_sincos(_mm256_mul_ps(detail::fast_random_unit8(lanes.next()), _mm256_set1_ps(detail::fast_random_two_pi)), &s, &c);
+				_mm256_storeu_ps(x + i, _mm256_mul_ps(c, _mm256_set1_ps(Radius)));
+				_mm256_storeu_ps(y + i, _mm256_mul_ps(s, _mm256_set1_ps(Radius)));
+			}
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 8 <= count; i += 8)
+			for(int h = 0; h < 2; ++h)
+			{
+				glm_f32vec4 s, c;
+				glm_vec4_sincos(_mm_mul_ps(detail::fast_random_unit4(lanes.next(h)), _mm_set1_ps(detail::fast_random_two_pi)), &s, &c);
+				_mm_storeu_ps(x + i + h * 4, _mm_mul_ps(c, _mm_set1_ps(Radius)));
+				_mm_storeu_ps(y + i + h * 4, _mm_mul_ps(s, _mm_set1_ps(Radius)));
+			}
+#		endif
+		uint32 words[8];
+		for(; i < count; i += 8)
+		{
+			lanes.next(words);
+			for(std::size_t l = 0; l < 8 && i + l < count; ++l)
+				detail::fast_random_circle(words[l], Radius, x[i + l], y[i + l]);
+		}
+		lanes.store(engine);
+	}
+
+	// Two steps per 8 values: the first gives the radii, the second the angles
+	GLM_FUNC_QUALIFIER void batchDiskRand(xoshiro128& engine, float Radius, float* x, float* y, std::size_t count)
+	{
+		detail::fast_random_lanes lanes(engine);
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			for(; i + 8 <= count; i += 8)
+			{
+				glm_f32vec8 const r = _mm256_mul_ps(_mm256_sqrt_ps(detail::fast_random_unit8(lanes.next())), _mm256_set1_ps(Radius));
+				glm_f32vec8 s, c;
+				glm_vec8_sincos(_mm256_mul_ps(detail::fast_random_unit8(lanes.next()), _mm256_set1_ps(detail::fast_random_two_pi)), &s, &c);
+				_mm256_storeu_ps(x + i, _mm256_mul_ps(c, r));
+				_mm256_storeu_ps(y + i, _mm256_mul_ps(s, r));
+			}
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 8 <= count; i += 8)
+			{
+				glm_f32vec4 r[2];
+				for(int h = 0; h < 2; ++h)
+					r[h] = _mm_mul_ps(_mm_sqrt_ps(detail::fast_random_unit4(lanes.next(h))), _mm_set1_ps(Radius));
+				for(int h = 0; h < 2; ++h)
+				{
+					glm_f32vec4 s, c;
+					glm_vec4_sincos(_mm_mul_ps(detail::fast_random_unit4(lanes.next(h)), _mm_set1_ps(detail::fast_random_two_pi)), &s, &c);
+					_mm_storeu_ps(x + i + h * 4, _mm_mul_ps(c, r[h]));
+					_mm_storeu_ps(y + i + h * 4, _mm_mul_ps(s, r[h]));
+				}
+			}
+#		endif
+		uint32 radii[8], angles[8];
+		for(; i < count; i += 8)
+		{
+			lanes.next(radii);
+			lanes.next(angles);
+			for(std::size_t l = 0; l < 8 && i + l < count; ++l)
+				detail::fast_random_disk(radii[l], angles[l], Radius, x[i + l], y[i + l]);
+		}
+		lanes.store(engine);
+	}
+
+	// Two steps per 8 values: the first gives the heights, the second the angles
+	GLM_FUNC_QUALIFIER void batchSphericalRand(xoshiro128& engine, float Radius, float* x, float* y, float* z, std::size_t count)
+	{
+		detail::fast_random_lanes lanes(engine);
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			for(; i + 8 <= count; i += 8)
+			{
+				glm_f32vec8 const h = _mm256_sub_ps(_mm256_mul_ps(detail::fast_random_unit8(lanes.next()), _mm256_set1_ps(2.0f)), _mm256_set1_ps(1.0f));
+				glm_f32vec8 const r = _mm256_mul_ps(_mm256_sqrt_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(h, h))), _mm256_set1_ps(Radius));
+				glm_f32vec8 s, c;
+				glm_vec8_sincos(_mm256_mul_ps(detail::fast_random_unit8(lanes.next()), _mm256_set1_ps(detail::fast_random_two_pi)), &s, &c);
+				_mm256_storeu_ps(x + i, _mm256_mul_ps(c, r));
+				_mm256_storeu_ps(y + i, _mm256_mul_ps(s, r));
+				_mm256_storeu_ps(z + i, _mm256_mul_ps(h, _mm256_set1_ps(Radius)));
+			}
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 8 <= count; i += 8)
+			{
+				glm_f32vec4 h[2];
+				for(int k = 0; k < 2; ++k)
+					h[k] = _mm_sub_ps(_mm_mul_ps(detail::fast_random_unit4(lanes.next(k)), _mm_set1_ps(2.0f)), _mm_set1_ps(1.0f));
+				for(int k = 0; k < 2; ++k)
+				{
+					glm_f32vec4 const r = _mm_mul_ps(_mm_sqrt_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(h[k], h[k]))), _mm_set1_ps(Radius));
+					glm_f32vec4 s, c;
+					glm_vec4_sincos(_mm_mul_ps(detail::fast_random_unit4(lanes.next(k)), _mm_set1_ps(detail::fast_random_two_pi)), &s, &c);
+					_mm_storeu_ps(x + i + k * 4, _mm_mul_ps(c, r));
+					_mm_storeu_ps(y + i + k * 4, _mm_mul_ps(s, r));
+					_mm_storeu_ps(z + i + k * 4, _mm_mul_ps(h[k], _mm_set1_ps(Radius)));
+				}
+			}
+#		endif
+		uint32 heights[8], angles[8];
+		for(; i < count; i += 8)
+		{
+			lanes.next(heights);
+			lanes.next(angles);
+			for(std::size_t l = 0; l < 8 && i + l < count; ++l)
+				detail::fast_random_sphere(heights[l], angles[l], Radius, x[i + l], y[i + l], z[i + l]);
+		}
+		lanes.store(engine);
+	}
+}//namespace glm
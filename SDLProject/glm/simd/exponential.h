@@ -1,9 +1,45 @@
 /// @ref simd
 /// @file glm/simd/experimental.h
+///
+/// glm_vec4_exp and glm_vec4_log are Cephes-style single precision
+/// polynomials. Measured against the double precision libm result rounded
+/// to float:
+///   glm_vec4_exp  max 1 ulp over [-87.3, 88.7]; overflows to +inf above and flushes to 0 below -104.5
+///   glm_vec4_log  max 1 ulp over the positive normals; log(0) = -inf, log(x < 0) = NaN, log(+inf) = +inf
+/// Denormal inputs to log are treated as the smallest normal.
 
 #pragma once
 
 #include "platform.h"
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// Shared by the SSE2 and AVX2 kernels and the scalar fallback in gtx/batch_math
+	static float const exp_hi = 89.0f;
+	static float const exp_lo = -104.5f;
+	static float const exp_log2e = 1.44269504088896341f;
+	static float const exp_c1 = 0.693359375f;
+	static float const exp_c2 = -2.12194440e-4f;
+	static float const exp_p0 = 1.9875691500e-4f;
+	static float const exp_p1 = 1.3981999507e-3f;
+	static float const exp_p2 = 8.3334519073e-3f;
+	static float const exp_p3 = 4.1665795894e-2f;
+	static float const exp_p4 = 1.6666665459e-1f;
+	static float const exp_p5 = 5.0000001201e-1f;
+	static float const log_sqrt_half = 0.707106781186547524f;
+	static float const log_p0 = 7.0376836292e-2f;
+	static float const log_p1 = -1.1514610310e-1f;
+	static float const log_p2 = 1.1676998740e-1f;
+	static float const log_p3 = -1.2420140846e-1f;
+	static float const log_p4 = 1.4249322787e-1f;
+	static float const log_p5 = -1.6668057665e-1f;
+	static float const log_p6 = 2.0000714765e-1f;
+	static float const log_p7 = -2.4999993993e-1f;
+	static float const log_p8 = 3.3333331174e-1f;
+}//namespace detail
+}//namespace glm
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
@@ -17,4 +53,138 @@ GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sqrt_lowp(glm_f32vec4 x)
 	return _mm_mul_ps(_mm_rsqrt_ps(x), x);
 }
 
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_exp(glm_f32vec4 x)
+{
+	glm_f32vec4 const is_nan = _mm_cmpunord_ps(x, x);
+	x = _mm_min_ps(x, _mm_set1_ps(glm::detail::exp_hi));
+	x = _mm_max_ps(x, _mm_set1_ps(glm::detail::exp_lo));
+
+	// x = n ln2 + r with |r| <= ln2 / 2, ln2 split in two for the subtraction
+	glm_i32vec4 const n = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(glm::detail::exp_log2e)));
+	glm_f32vec4 const fn = _mm_cvtepi32_ps(n);
+	x = _mm_sub_ps(x, _mm_mul_ps(fn, _mm_set1_ps(glm::detail::exp_c1)));
+	x = _mm_sub_ps(x, _mm_mul_ps(fn, _mm_set1_ps(glm::detail::exp_c2)));
+	glm_f32vec4 const z = _mm_mul_ps(x, x);
+
+	glm_f32vec4 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(glm::detail::exp_p0), x), _mm_set1_ps(glm::detail::exp_p1));
+	p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(glm::detail::exp_p2));
+	p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(glm::detail::exp_p3));
+	p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(glm::detail::exp_p4));
+	p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(glm::detail::exp_p5));
+	p = _mm_add_ps(_mm_add_ps(_mm_mul_ps(p, z), x), _mm_set1_ps(1.0f));
+
+	// 2^n applied in two halves so that n = 128 overflows to inf and n < -126 gives denormals instead of garbage
+	glm_i32vec4 const n1 = _mm_srai_epi32(n, 1);
+	glm_i32vec4 const n2 = _mm_sub_epi32(n, n1);
+	glm_f32vec4 const s1 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n1, _mm_set1_epi32(127)), 23));
+	glm_f32vec4 const s2 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n2, _mm_set1_epi32(127)), 23));
+	return _mm_or_ps(_mm_mul_ps(_mm_mul_ps(p, s1), s2), is_nan);
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_log(glm_f32vec4 x)
+{
+	glm_f32vec4 const zero = _mm_setzero_ps();
+	glm_f32vec4 const one = _mm_set1_ps(1.0f);
+	glm_f32vec4 const is_zero = _mm_cmpeq_ps(x, zero);
+	glm_f32vec4 const is_invalid = _mm_cmpnge_ps(x, zero); // negative or NaN
+	glm_f32vec4 const is_inf = _mm_cmpeq_ps(x, _mm_set1_ps(std::numeric_limits<float>::infinity()));
+
+	// x = m 2^e with m in [sqrt(1/2), sqrt(2))
+	x = _mm_max_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x00800000)));
+	glm_i32vec4 const bits = _mm_castps_si128(x);
+	glm_f32vec4 e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126)));
+	x = _mm_or_ps(_mm_castsi128_ps(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff))), _mm_set1_ps(0.5f));
+
+	glm_f32vec4 const small = _mm_cmplt_ps(x, _mm_set1_ps(glm::detail::log_sqrt_half));
+	e = _mm_sub_ps(e, _mm_and_ps(small, one));
+	x = _mm_add_ps(_mm_sub_ps(x, one), _mm_and_ps(small, x));
+	glm_f32vec4 const z = _mm_mul_ps(x, x);
+
+	glm_f32vec4 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(glm::detail::log_p0), x), _mm_set1_ps(glm::detail::log_p1));
+	p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(glm::detail::log_p2));
+	p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(glm::detail::log_p3));
+	p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(glm::detail::log_p4));
+	p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(glm::detail::log_p5));
+	p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(glm::detail::log_p6));
+	p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(glm::detail::log_p7));
+	p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(glm::detail::log_p8));
+	p = _mm_mul_ps(_mm_mul_ps(p, x), z);
+
+	p = _mm_add_ps(p, _mm_mul_ps(e, _mm_set1_ps(glm::detail::exp_c2)));
+	p = _mm_sub_ps(p, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+	glm_f32vec4 r = _mm_add_ps(_mm_add_ps(x, p), _mm_mul_ps(e, _mm_set1_ps(glm::detail::exp_c1)));
+
+	r = _mm_or_ps(_mm_andnot_ps(is_inf, r), _mm_and_ps(is_inf, _mm_set1_ps(std::numeric_limits<float>::infinity())));
+	r = _mm_or_ps(r, is_invalid);
+	return _mm_or_ps(_mm_andnot_ps(is_zero, r), _mm_and_ps(is_zero, _mm_set1_ps(-std::numeric_limits<float>::infinity())));
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_vec8_exp(glm_f32vec8 x)
+{
+	glm_f32vec8 const is_nan = _mm256_cmp_ps(x, x, _CMP_UNORD_Q);
+	x = _mm256_min_ps(x, _mm256_set1_ps(glm::detail::exp_hi));
+	x = _mm256_max_ps(x, _mm256_set1_ps(glm::detail::exp_lo));
+
+	__m256i const n = _mm256_cvtps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(glm::detail::exp_log2e)));
+	glm_f32vec8 const fn = _mm256_cvtepi32_ps(n);
+	x = _mm256_sub_ps(x, _mm256_mul_ps(fn, _mm256_set1_ps(glm::detail::exp_c1)));
+	x = _mm256_sub_ps(x, _mm256_mul_ps(fn, _mm256_set1_ps(glm::detail::exp_c2)));
+	glm_f32vec8 const z = _mm256_mul_ps(x, x);
+
+	glm_f32vec8 p = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(glm::detail::exp_p0), x), _mm256_set1_ps(glm::detail::exp_p1));
+	p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(glm::detail::exp_p2));
+	p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(glm::detail::exp_p3));
+	p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(glm::detail::exp_p4));
+	p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(glm::detail::exp_p5));
+	p = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(p, z), x), _mm256_set1_ps(1.0f));
+
+	__m256i const n1 = _mm256_srai_epi32(n, 1);
+	__m256i const n2 = _mm256_sub_epi32(n, n1);
+	glm_f32vec8 const s1 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n1, _mm256_set1_epi32(127)), 23));
+	glm_f32vec8 const s2 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n2, _mm256_set1_epi32(127)), 23));
+	return _mm256_or_ps(_mm256_mul_ps(_mm256_mul_ps(p, s1), s2), is_nan);
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_vec8_log(glm_f32vec8 x)
+{
+	glm_f32vec8 const zero = _mm256_setzero_ps();
+	glm_f32vec8 const one = _mm256_set1_ps(1.0f);
+	glm_f32vec8 const inf = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+	glm_f32vec8 const is_zero = _mm256_cmp_ps(x, zero, _CMP_EQ_OQ);
+	glm_f32vec8 const is_invalid = _mm256_cmp_ps(x, zero, _CMP_NGE_UQ);
+	glm_f32vec8 const is_inf = _mm256_cmp_ps(x, inf, _CMP_EQ_OQ);
+
+	x = _mm256_max_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x00800000)));
+	__m256i const bits = _mm256_castps_si256(x);
+	glm_f32vec8 e = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(126)));
+	x = _mm256_or_ps(_mm256_castsi256_ps(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff))), _mm256_set1_ps(0.5f));
+
+	glm_f32vec8 const small = _mm256_cmp_ps(x, _mm256_set1_ps(glm::detail::log_sqrt_half), _CMP_LT_OQ);
+	e = _mm256_sub_ps(e, _mm256_and_ps(small, one));
+	x = _mm256_add_ps(_mm256_sub_ps(x, one), _mm256_and_ps(small, x));
+	glm_f32vec8 const z = _mm256_mul_ps(x, x);
+
+	glm_f32vec8 p = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(glm::detail::log_p0), x), _mm256_set1_ps(glm::detail::log_p1));
+	p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(glm::detail::log_p2));
+	p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(glm::detail::log_p3));
+	p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(glm::detail::log_p4));
+	p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(glm::detail::log_p5));
+	p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(glm::detail::log_p6));
+	p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(glm::detail::log_p7));
+	p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(glm::detail::log_p8));
+	p = _mm256_mul_ps(_mm256_mul_ps(p, x), z);
+
+	p = _mm256_add_ps(p, _mm256_mul_ps(e, _mm256_set1_ps(glm::detail::exp_c2)));
+	p = _mm256_sub_ps(p, _mm256_mul_ps(z, _mm256_set1_ps(0.5f)));
+	glm_f32vec8 r = _mm256_add_ps(_mm256_add_ps(x, p), _mm256_mul_ps(e, _mm256_set1_ps(glm::detail::exp_c1)));
+
+	r = _mm256_blendv_ps(r, inf, is_inf);
+	r = _mm256_or_ps(r, is_invalid);
+	return _mm256_blendv_ps(r, _mm256_set1_ps(-std::numeric_limits<float>::infinity()), is_zero);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -27,9 +27,29 @@
 
 #include <SDL2/SDL.h>
 #include <SDL_opengl.h>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#define GLM_ENABLE_EXPERIMENTAL
 #include "glm/mat4x4.hpp"
 #include "glm/gtc/matrix_transform.hpp"
+#include "glm/gtx/affine_2d.hpp"
 #include "ShaderProgram.h"
+#include "SpriteVertex.h"
+#include "Curve.h"
+#include "TransformHierarchy.h"
+#include "ViewCulling.h"
+#include "RenderQueue.h"
+#include "CommandBuffer.h"
+#include "StreamBuffer.h"
+#include "FramePipeline.h"
+#include "Texture.h"
+#include "Mipmap.h"
+#include "BlockCompression.h"
+#include "VirtualTexture.h"
+#include "TextureCache.h"
+#include "Benchmark.h"
+#include "SelfTest.h"
 #include "stb_image.h"
 
 enum AppStatus { RUNNING, TERMINATED };
@@ -60,6 +80,11 @@ constexpr GLint NUMBER_OF_TEXTURES = 1, // to be generated, that is
 constexpr char KIMI_SPRITE_FILEPATH[]    = "/Users/avyanshgupta/Desktop/kimi.png",
                TOTSUKO_SPRITE_FILEPATH[] = "/Users/avyanshgupta/Desktop/totsuko.png";
 
+constexpr char COMPRESSED_TEXTURE_EXTENSION[] = ".bct";
+
+// Decoded textures are kept here between runs; delete the folder to reset it
+constexpr char TEXTURE_CACHE_DIRECTORY[] = "texture_cache";
+
 constexpr glm::vec3 INIT_SCALE       = glm::vec3(5.0f, 5.98f, 0.0f),
                     INIT_POS_KIMI    = glm::vec3(2.0f, 0.0f, 0.0f),
                     INIT_POS_TOTSUKO = glm::vec3(-2.0f, 0.0f, 0.0f);
@@ -71,14 +96,68 @@ constexpr float G_SHRINK_FACTOR   = 0.99f;
 constexpr float ROT_ANGLE         = glm::radians(1.5f); // Smaller rotation angle
 constexpr int   G_MAX_FRAME       = 40;
 
+// The camera never moves, so both matrices are baked in at compile time
+constexpr glm::mat4 VIEW_MATRIX       = glm::mat4(1.0f),
+                    PROJECTION_MATRIX = glm::ortho(-5.0f, 5.0f, -3.75f, 3.75f, -1.0f, 1.0f);
+
 SDL_Window* g_display_window;
+SDL_GLContext g_gl_context;
 AppStatus g_app_status = RUNNING;
 ShaderProgram g_shader_program = ShaderProgram();
-
-glm::mat4 g_view_matrix,
-          g_kimi_matrix,
-          g_totsuko_matrix,
-          g_projection_matrix;
+TextureCache g_texture_cache;
+
+// Totsuko hangs off Kimi, so it follows Kimi's scaling without redoing it
+TransformHierarchy g_transforms;
+TransformNode g_kimi_node,
+              g_totsuko_node;
+
+// Everything drawn, by transform node and texture, and the world-space
+// rectangle the camera sees, for culling
+constexpr size_t SPRITE_COUNT = 2;
+TransformNode g_sprite_nodes[SPRITE_COUNT];
+GLuint *g_sprite_textures[SPRITE_COUNT];
+glm::vec2 g_view_min, g_view_max;
+
+// Totsuko goes on the layer above Kimi so it is always drawn over it
+constexpr unsigned SPRITE_LAYERS[SPRITE_COUNT] = { 0, 1 };
+RenderQueue g_render_queue;
+CommandList g_command_list;
+
+// What render() needs of a simulated frame, copied out at the end of each
+// update. The render thread draws from one of these while the next frame
+// is simulated into another.
+struct RenderState
+{
+    glm::affine2d sprite_world[SPRITE_COUNT];
+    glm::vec2     sprite_min[SPRITE_COUNT], sprite_max[SPRITE_COUNT]; // world-space bounds, for culling
+};
+
+// Frames the simulation may run ahead of what is on screen; 2 lets it work
+// while the renderer waits on vsync. Override with --pipeline-depth <0-3>.
+constexpr unsigned DEFAULT_PIPELINE_DEPTH = 2;
+FramePipeline g_frame_pipeline;
+RenderState g_render_states[FRAME_PIPELINE_MAX_DEPTH];
+
+// Unit quad shared by every sprite
+constexpr size_t SPRITE_QUAD_VERTICES = 6;
+
+constexpr float SPRITE_QUAD_POSITIONS[SPRITE_QUAD_VERTICES * 2] = {
+    -0.5f, -0.5f, 0.5f, -0.5f, 0.5f, 0.5f,  // triangle 1
+    -0.5f, -0.5f, 0.5f, 0.5f, -0.5f, 0.5f   // triangle 2
+};
+
+// Textures
+constexpr float SPRITE_QUAD_TEX_COORDS[SPRITE_QUAD_VERTICES * 2] = {
+    0.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f,     // triangle 1
+    0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.0f,     // triangle 2
+};
+
+// Sprite vertices are packed each frame straight into mapped GL memory.
+// The client-side copy, packed once at start-up, is only drawn from when
+// the stream cannot be used.
+constexpr size_t VERTEX_STREAM_REGION_SIZE = 64 * 1024;
+StreamBuffer g_vertex_stream;
+SpriteVertex g_sprite_quad[SPRITE_QUAD_VERTICES];
 
 float g_previous_ticks = 0.0f;
 int g_frame_counter = 0;
@@ -90,8 +169,58 @@ GLuint g_kimi_texture_id,
 constexpr float CIRCLE_RADIUS = 2.0f; // Radius for circular motion
 float g_totsuko_angle = 0.0f; // Angle for circular motion
 
-GLuint load_texture(const char* filepath)
+bool has_extension(const char* filepath, const char* extension)
+{
+    size_t path_length = strlen(filepath), extension_length = strlen(extension);
+    return path_length >= extension_length &&
+           strcmp(filepath + path_length - extension_length, extension) == 0;
+}
+
+GLuint load_compressed_texture(const char* filepath)
 {
+    CompressedTexture texture;
+    if (!read_compressed_texture(texture, filepath))
+    {
+        LOG("Unable to load compressed texture. Make sure the path is correct.");
+        assert(false);
+    }
+
+    GLuint textureID;
+    glGenTextures(NUMBER_OF_TEXTURES, &textureID);
+    glBindTexture(GL_TEXTURE_2D, textureID);
+
+    if (!upload_compressed_texture(texture)) LOG("S3TC not supported, decoded " << filepath << " on the CPU.");
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, texture.levels.size() > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    // Alpha was baked in by the encoder, whatever the caller asked for
+    set_texture_alpha_mode(textureID, texture.alpha_mode);
+
+    return textureID;
+}
+
+GLuint load_texture(const char* filepath, AlphaMode alpha_mode = PREMULTIPLIED_ALPHA,
+                    MipFilter mip_filter = MIP_FILTER_KAISER)
+{
+    if (has_extension(filepath, COMPRESSED_TEXTURE_EXTENSION)) return load_compressed_texture(filepath);
+
+    GLuint textureID;
+    glGenTextures(NUMBER_OF_TEXTURES, &textureID);
+    glBindTexture(GL_TEXTURE_2D, textureID);
+
+    CachedTexture cached;
+    if (g_texture_cache.lookup(filepath, alpha_mode, mip_filter, cached))
+    {
+        upload_cached_texture(cached);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, cached.levels.size() > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        set_texture_alpha_mode(textureID, cached.alpha_mode);
+
+        return textureID;
+    }
+
     int width, height, number_of_components;
     unsigned char* image = stbi_load(filepath, &width, &height, &number_of_components, STBI_rgb_alpha);
 
@@ -101,15 +230,24 @@ GLuint load_texture(const char* filepath)
         assert(false);
     }
 
-    GLuint textureID;
-    glGenTextures(NUMBER_OF_TEXTURES, &textureID);
+    // Mips are filtered from the straight-alpha source, then the whole
+    // chain is premultiplied in one pass
+    MipChain chain = generate_mip_chain(image, width, height, mip_filter);
+    stbi_image_free(image);
+
+    // Straight alpha bleeds dark fringes under linear filtering, so convert
+    // on import and let the premultiplied blend state handle it
+    if (alpha_mode == PREMULTIPLIED_ALPHA) premultiply_alpha(chain.pixels.data(), chain.pixels.size() / 4);
+    else if (alpha_mode == ADDITIVE)       premultiply_additive(chain.pixels.data(), chain.pixels.size() / 4);
+
     glBindTexture(GL_TEXTURE_2D, textureID);
-    glTexImage2D(GL_TEXTURE_2D, LEVEL_OF_DETAIL, GL_RGBA, width, height, TEXTURE_BORDER, GL_RGBA, GL_UNSIGNED_BYTE, image);
+    upload_mip_chain(chain);
+    g_texture_cache.store(filepath, alpha_mode, mip_filter, chain);
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, mip_filter == MIP_FILTER_NONE ? GL_LINEAR : GL_LINEAR_MIPMAP_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-    stbi_image_free(image);
+    set_texture_alpha_mode(textureID, alpha_mode);
 
     return textureID;
 }
@@ -123,8 +261,8 @@ void initialise()
                                       WINDOW_WIDTH, WINDOW_HEIGHT,
                                       SDL_WINDOW_OPENGL);
 
-    SDL_GLContext context = SDL_GL_CreateContext(g_display_window);
-    SDL_GL_MakeCurrent(g_display_window, context);
+    g_gl_context = SDL_GL_CreateContext(g_display_window);
+    SDL_GL_MakeCurrent(g_display_window, g_gl_context);
 
     if (g_display_window == nullptr)
     {
@@ -141,23 +279,32 @@ void initialise()
 
     g_shader_program.load(V_SHADER_PATH, F_SHADER_PATH);
 
-    g_kimi_matrix       = glm::mat4(1.0f); // Start upright, no initial rotation
-    g_totsuko_matrix    = glm::mat4(1.0f);
-    g_view_matrix       = glm::mat4(1.0f);
-    g_projection_matrix = glm::ortho(-5.0f, 5.0f, -3.75f, 3.75f, -1.0f, 1.0f);
+    g_kimi_node    = g_transforms.create(); // Start upright, no initial rotation
+    g_totsuko_node = g_transforms.create(g_kimi_node);
 
-    g_shader_program.set_projection_matrix(g_projection_matrix);
-    g_shader_program.set_view_matrix(g_view_matrix);
+    g_shader_program.set_projection_matrix(PROJECTION_MATRIX);
+    g_shader_program.set_view_matrix(VIEW_MATRIX);
+    get_visible_rect(PROJECTION_MATRIX * VIEW_MATRIX, g_view_min, g_view_max);
 
     glUseProgram(g_shader_program.get_program_id());
 
+    pack_sprite_vertices(SPRITE_QUAD_POSITIONS, SPRITE_QUAD_TEX_COORDS, g_sprite_quad, SPRITE_QUAD_VERTICES);
+    if (!g_vertex_stream.create(GL_ARRAY_BUFFER, VERTEX_STREAM_REGION_SIZE)) g_vertex_stream.destroy();
+
     glClearColor(BG_RED, BG_BLUE, BG_GREEN, BG_OPACITY);
 
+    g_texture_cache.open(TEXTURE_CACHE_DIRECTORY);
+
     g_kimi_texture_id   = load_texture(KIMI_SPRITE_FILEPATH);
     g_totsuko_texture_id = load_texture(TOTSUKO_SPRITE_FILEPATH);
 
+    g_sprite_nodes[0] = g_kimi_node;    g_sprite_textures[0] = &g_kimi_texture_id;
+    g_sprite_nodes[1] = g_totsuko_node; g_sprite_textures[1] = &g_totsuko_texture_id;
+
+    g_texture_cache.print_report();
+
     glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    apply_blend_state(PREMULTIPLIED_ALPHA);
 }
 
 void process_input()
@@ -171,14 +318,31 @@ void process_input()
         }
     }
 }
-constexpr glm::vec3 TOTSUKO_SCALE = glm::vec3(0.99f, 0.99f, 1.0f);
-constexpr glm::vec3 KIMI_SCALE = glm::vec3(1.0f, 1.0f, 1.0f); // Fixed scale for Kimi
+constexpr glm::vec2 TOTSUKO_SCALE = glm::vec2(0.99f, 0.99f);
+constexpr glm::vec2 KIMI_SCALE = glm::vec2(1.0f, 1.0f); // Fixed scale for Kimi
 constexpr float ORBIT_SPEED = 1.0f; // Adjust this for speed of orbit
 constexpr float RADIUS = 2.0f;       // Distance from Kimi to Totsuko
 
-float g_angle = 0.0f; // Angle for Totsuko's orbit
-float g_x_offset = 0.0f; // X offset for Totsuko's position
-float g_y_offset = 0.0f; // Y offset for Totsuko's position
+constexpr int ORBIT_POINT_COUNT = 16; // Points the orbit path passes through
+
+// Totsuko's orbit is a closed spline through points on the circle, walked by
+// arc length so the speed stays even; reshape the points to change the path
+SplinePath make_orbit_path()
+{
+    glm::vec2 points[ORBIT_POINT_COUNT];
+    for (int i = 0; i < ORBIT_POINT_COUNT; i++)
+    {
+        float angle = glm::two_pi<float>() * i / ORBIT_POINT_COUNT;
+        points[i] = RADIUS * glm::vec2(glm::cos(angle), glm::sin(angle));
+    }
+
+    SplinePath path;
+    path.build(points, ORBIT_POINT_COUNT, true);
+    return path;
+}
+
+SplinePath g_orbit_path = make_orbit_path();
+float g_orbit_distance = 0.0f; // How far along the orbit Totsuko has travelled
 
 
 
@@ -200,82 +364,206 @@ void update()
             g_frame_counter = 0;
         }
 
-        glm::vec3 scale_vector = glm::vec3(
-            g_is_growing ? G_GROWTH_FACTOR : G_SHRINK_FACTOR,
+        glm::vec2 scale_vector = glm::vec2(
             g_is_growing ? G_GROWTH_FACTOR : G_SHRINK_FACTOR,
-            1.0f);
+            g_is_growing ? G_GROWTH_FACTOR : G_SHRINK_FACTOR);
 
         // Create transformation matrix for Kimi (no translation or rotation)
-        g_kimi_matrix = glm::mat4(1.0f); // Reset model matrix for Kimi
-        g_kimi_matrix = glm::scale(g_kimi_matrix, scale_vector * KIMI_SCALE); // Apply scaling effect
+        g_transforms.set_local(g_kimi_node, glm::scale(glm::affine2d(1.0f), scale_vector * KIMI_SCALE)); // Apply scaling effect
+
+        // Step 2: Move Totsuko along the orbit, at ORBIT_SPEED radians a second
+        g_orbit_distance = glm::mod(g_orbit_distance + ORBIT_SPEED * RADIUS * delta_time, g_orbit_path.get_length());
 
-        // Step 2: Update Totsuko's angle for orbit
-        g_angle += ORBIT_SPEED * delta_time; // Increment angle for orbit
+        // Step 3: Look up Totsuko's position on the orbit
+        glm::vec2 orbit_offset = g_orbit_path.evaluate(g_orbit_distance / g_orbit_path.get_length());
 
-        // Step 3: Calculate new x, y position using trigonometry for Totsuko's orbit
-        g_x_offset = RADIUS * glm::cos(g_angle);
-        g_y_offset = RADIUS * glm::sin(g_angle);
+        // Step 4: Update Totsuko's transformation relative to Kimi
+        glm::affine2d totsuko_local = glm::translate(glm::affine2d(1.0f), orbit_offset); // Orbit around Kimi
+        g_transforms.set_local(g_totsuko_node, glm::scale(totsuko_local, TOTSUKO_SCALE)); // Scale Totsuko
 
-        // Step 4: Update Totsuko's transformation matrix
-        g_totsuko_matrix = glm::mat4(1.0f); // Reset model matrix for Totsuko
-        g_totsuko_matrix = glm::translate(g_kimi_matrix, glm::vec3(g_x_offset, g_y_offset, 0.0f)); // Orbit around Kimi
-        g_totsuko_matrix = glm::scale(g_totsuko_matrix, TOTSUKO_SCALE); // Scale Totsuko
+        g_transforms.update();
     
     
 
 }
 
-void draw_object(glm::mat4 &object_model_matrix, GLuint &object_texture_id)
+void write_render_state(RenderState &state)
 {
-    g_shader_program.set_model_matrix(object_model_matrix);
-    glBindTexture(GL_TEXTURE_2D, object_texture_id);
-    glDrawArrays(GL_TRIANGLES, 0, 6); // Drawing the two triangles for each object
+    for (size_t i = 0; i < SPRITE_COUNT; i++) state.sprite_world[i] = g_transforms.get_world(g_sprite_nodes[i]);
+    g_transforms.get_world_bounds(g_sprite_nodes, SPRITE_COUNT, glm::vec2(-0.5f), glm::vec2(0.5f),
+                                  state.sprite_min, state.sprite_max);
 }
 
-void render()
+void record_object(CommandBuffer &commands, const glm::affine2d &object_model_matrix)
+{
+    // Sprites only ever move in the xy plane, so the model matrix is kept as
+    // a 2D affine transform and only widened to a mat4 for the upload
+    commands.set_model_matrix(object_model_matrix);
+    commands.draw_arrays(GL_TRIANGLES, 0, 6); // Drawing the two triangles for each object
+}
+
+void render(const RenderState &state)
 {
     glClear(GL_COLOR_BUFFER_BIT);
 
-    float vertices[] = {
-        -0.5f, -0.5f, 0.5f, -0.5f, 0.5f, 0.5f,  // triangle 1
-        -0.5f, -0.5f, 0.5f, 0.5f, -0.5f, 0.5f   // triangle 2
-    };
+    // Pack this frame's vertices into the stream, falling back to the
+    // client-side quad if it has no room or no GL buffer can take them
+    size_t stream_offset = 0;
+    SpriteVertex *streamed = g_vertex_stream.get_buffer() != 0 && has_native_half_float_vertices()
+        ? (SpriteVertex *) g_vertex_stream.allocate(sizeof(g_sprite_quad), stream_offset)
+        : nullptr;
+    if (streamed != nullptr)
+    {
+        pack_sprite_vertices(SPRITE_QUAD_POSITIONS, SPRITE_QUAD_TEX_COORDS, streamed, SPRITE_QUAD_VERTICES);
+        g_vertex_stream.commit();
+        bind_sprite_vertices(g_shader_program, g_vertex_stream.get_buffer(), stream_offset);
+    }
+    else
+    {
+        bind_sprite_vertices(g_shader_program, g_sprite_quad, SPRITE_QUAD_VERTICES);
+    }
 
-    // Textures
-    float texture_coordinates[] = {
-        0.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f,     // triangle 1
-        0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.0f,     // triangle 2
-    };
+    // Only the sprites whose quads reach the screen are drawn
+    uint32_t visible[SPRITE_COUNT];
+    size_t visible_count = cull_boxes(state.sprite_min, state.sprite_max, SPRITE_COUNT, g_view_min, g_view_max, visible);
 
-    glVertexAttribPointer(g_shader_program.get_position_attribute(), 2, GL_FLOAT, false,
-                          0, vertices);
-    glEnableVertexAttribArray(g_shader_program.get_position_attribute());
+    // Queue them by sort key, so the blend state and texture are only
+    // changed where the sorted keys change
+    g_render_queue.clear();
+    for (size_t i = 0; i < visible_count; i++)
+    {
+        GLuint texture_id = *g_sprite_textures[visible[i]];
+        g_render_queue.push(make_draw_key(SPRITE_LAYERS[visible[i]], get_texture_alpha_mode(texture_id), 0, texture_id, 0.0f),
+                            visible[i]);
+    }
+    g_render_queue.sort();
 
-    glVertexAttribPointer(g_shader_program.get_tex_coordinate_attribute(), 2, GL_FLOAT,
-                          false, 0, texture_coordinates);
-    glEnableVertexAttribArray(g_shader_program.get_tex_coordinate_attribute());
-    
-    draw_object(g_kimi_matrix, g_kimi_texture_id);
-    draw_object(g_totsuko_matrix, g_totsuko_texture_id);
-    
-    // We disable two attribute arrays now
-    glDisableVertexAttribArray(g_shader_program.get_position_attribute());
-    glDisableVertexAttribArray(g_shader_program.get_tex_coordinate_attribute());
+    // Record the draws on as many threads as the queue warrants, then issue
+    // them here, where the context is current
+    g_command_list.record(g_render_queue.get_size(), [&state](CommandBuffer &commands, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            const DrawItem &item = g_render_queue.get_items()[i];
+            commands.set_blend_state(get_draw_key_alpha_mode(item.key));
+            commands.bind_texture(get_draw_key_texture(item.key));
+            record_object(commands, state.sprite_world[item.index]);
+        }
+    });
+
+    CommandReplayState replay_state; // premultiplied blending, as set in initialise()
+    g_command_list.replay(g_shader_program, replay_state);
+    if (replay_state.blend_state != PREMULTIPLIED_ALPHA) apply_blend_state(PREMULTIPLIED_ALPHA);
+
+    unbind_sprite_vertices(g_shader_program);
+    if (g_vertex_stream.get_buffer() != 0) g_vertex_stream.end_frame();
 
     SDL_GL_SwapWindow(g_display_window);
 }
 
+/**
+ * Offline path: SDLProject --compress <image> <output.bct> [bc1|bc3]
+ * Builds the premultiplied mip chain exactly as load_texture() would and
+ * stores it block-compressed, then prints a quality/speed report.
+ */
+int compress_texture(const char* source_path, const char* target_path, BlockFormat format)
+{
+    int width, height, number_of_components;
+    unsigned char* image = stbi_load(source_path, &width, &height, &number_of_components, STBI_rgb_alpha);
+
+    if (image == NULL)
+    {
+        LOG("Unable to load image. Make sure the path is correct.");
+        return 1;
+    }
+
+    MipChain chain = generate_mip_chain(image, width, height, MIP_FILTER_KAISER);
+    stbi_image_free(image);
+
+    premultiply_alpha(chain.pixels.data(), chain.pixels.size() / 4);
+
+    if (!write_compressed_texture(compress_mip_chain(chain, format, PREMULTIPLIED_ALPHA), target_path))
+    {
+        LOG("Unable to write " << target_path);
+        return 1;
+    }
+
+    print_compression_report(chain, format, PREMULTIPLIED_ALPHA);
+    return 0;
+}
+
 int main(int argc, char* argv[])
 {
+    if (argc >= 4 && strcmp(argv[1], "--compress") == 0)
+    {
+        BlockFormat format = (argc >= 5 && strcmp(argv[4], "bc1") == 0) ? BLOCK_FORMAT_BC1 : BLOCK_FORMAT_BC3;
+        return compress_texture(argv[2], argv[3], format);
+    }
+
+    // Offline path: SDLProject --build-virtual-texture <image> <output.vt>
+    if (argc >= 4 && strcmp(argv[1], "--build-virtual-texture") == 0)
+    {
+        if (build_virtual_texture_file(argv[2], argv[3])) return 0;
+
+        LOG("Unable to build " << argv[3] << " from " << argv[2]);
+        return 1;
+    }
+
+    // Offline path: SDLProject --benchmark [name], every benchmark without one
+    if (argc >= 2 && strcmp(argv[1], "--benchmark") == 0) return run_benchmark(argc >= 3 ? argv[2] : nullptr) ? 0 : 1;
+
+    // Offline path: SDLProject --self-test [name], nonzero exit on any failure
+    if (argc >= 2 && strcmp(argv[1], "--self-test") == 0) return run_self_test(argc >= 3 ? argv[2] : nullptr) ? 0 : 1;
+
+    // SDLProject --pipeline-depth <0-3>: frames the simulation may run ahead
+    unsigned pipeline_depth = DEFAULT_PIPELINE_DEPTH;
+    if (argc >= 2 && strcmp(argv[1], "--pipeline-depth") == 0)
+    {
+        char *end = nullptr;
+        unsigned long depth = argc >= 3 && isdigit((unsigned char) argv[2][0]) ? strtoul(argv[2], &end, 10) : 0;
+        if (end == nullptr || *end != '\0' || depth > FRAME_PIPELINE_MAX_DEPTH)
+        {
+            LOG("Usage: SDLProject --pipeline-depth <0-" << FRAME_PIPELINE_MAX_DEPTH << ">");
+            return 1;
+        }
+        pipeline_depth = (unsigned) depth;
+    }
+
     initialise();
 
+    // From here on GL belongs to whichever thread renders, so the context
+    // is released and taken up again there
+    SDL_GL_MakeCurrent(g_display_window, nullptr);
+    g_frame_pipeline.start(pipeline_depth,
+        [](size_t slot) { render(g_render_states[slot]); },
+        []() { SDL_GL_MakeCurrent(g_display_window, g_gl_context); },
+        []()
+        {
+            if (g_vertex_stream.get_buffer() != 0)
+            {
+                g_vertex_stream.print_report();
+                g_vertex_stream.destroy();
+            }
+            SDL_GL_MakeCurrent(g_display_window, nullptr);
+        },
+        // SDL's Cocoa backend completes the render thread's context updates
+        // on the main queue, which only runs while events are pumped
+        []() { SDL_PumpEvents(); });
+
     while (g_app_status == RUNNING)
     {
+        // Waits for a free slot before sampling input, so the latency
+        // measured runs from the input to the swap that shows it
+        RenderState &state = g_render_states[g_frame_pipeline.begin_frame()];
         process_input();
         update();
-        render();
+        write_render_state(state);
+        g_frame_pipeline.submit_frame();
     }
 
+    g_frame_pipeline.stop();
+    g_frame_pipeline.print_report();
+
     SDL_Quit();
     return 0;
 }
@@ -0,0 +1,22 @@
+uniform sampler2D pageCache;
+uniform sampler2D pageTable;
+uniform vec2 virtualSize;
+uniform vec2 tableSize;
+uniform float pageSize;
+uniform float pageBorder;
+uniform float cacheSize;
+varying vec2 texCoordVar;
+
+void main() {
+    // Which level-0 page we are in, and where the table says its data lives
+    vec2 page = texCoordVar * virtualSize / pageSize;
+    vec2 cell = min(floor(page), tableSize - 1.0);
+    vec4 entry = floor(texture2D(pageTable, (cell + 0.5) / tableSize) * 255.0 + 0.5);
+
+    // Position inside the resident page, which may be from a coarser level
+    float scale = exp2(entry.z);
+    vec2 in_page = page / scale - floor(cell / scale);
+    vec2 texel = entry.xy * (pageSize + 2.0 * pageBorder) + pageBorder + in_page * pageSize;
+
+    gl_FragColor = texture2D(pageCache, texel / cacheSize);
+}